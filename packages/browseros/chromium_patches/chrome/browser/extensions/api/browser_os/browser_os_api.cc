@@ -1,22 +1,25 @@
 diff --git a/chrome/browser/extensions/api/browser_os/browser_os_api.cc b/chrome/browser/extensions/api/browser_os/browser_os_api.cc
 new file mode 100644
-index 0000000000000..84988d84caa41
+index 0000000000000..4543c85dcbe82
 --- /dev/null
 +++ b/chrome/browser/extensions/api/browser_os/browser_os_api.cc
-@@ -0,0 +1,1317 @@
+@@ -0,0 +1,2000 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
 +
 +#include "chrome/browser/extensions/api/browser_os/browser_os_api.h"
 +
++#include <algorithm>
 +#include <set>
 +#include <string>
 +#include <unordered_map>
 +#include <utility>
 +#include <vector>
 +
++#include "base/containers/span.h"
 +#include "base/functional/bind.h"
++#include "base/notreached.h"
 +#include "base/threading/platform_thread.h"
 +#include "chrome/browser/browser_process.h"
 +#include "chrome/browser/profiles/profile.h"
@@ -24,16 +27,30 @@ index 0000000000000..84988d84caa41
 +#include "base/json/json_writer.h"
 +#include "base/strings/utf_string_conversions.h"
 +#include "base/strings/string_number_conversions.h"
++#include "base/task/sequenced_task_runner.h"
 +#include "base/base64.h"
 +#include "base/time/time.h"
++#include "base/timer/elapsed_timer.h"
++#include "base/types/optional_util.h"
 +#include "base/values.h"
 +#include "base/version_info/version_info.h"
 +#include "components/metrics/browseros_metrics/browseros_metrics.h"
 +#include "chrome/browser/extensions/api/browser_os/browser_os_api_helpers.h"
 +#include "chrome/browser/extensions/api/browser_os/browser_os_api_utils.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_ax_tree_cache.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_ax_tree_encoder.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_ax_tree_projection.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_boilerplate.h"
 +#include "chrome/browser/extensions/api/browser_os/browser_os_change_detector.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_change_tracker.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_content_extraction_job.h"
 +#include "chrome/browser/extensions/api/browser_os/browser_os_content_processor.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_extraction_cache.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_live_snapshot.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_page_budget.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_perf.h"
 +#include "chrome/browser/extensions/api/browser_os/browser_os_snapshot_processor.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_timeout_model.h"
 +#include "chrome/browser/extensions/extension_tab_util.h"
 +#include "chrome/browser/extensions/window_controller.h"
 +#include "chrome/browser/ui/browser.h"
@@ -46,6 +63,7 @@ index 0000000000000..84988d84caa41
 +#include "content/public/browser/render_widget_host_view.h"
 +#include "content/browser/renderer_host/render_widget_host_view_base.h"
 +#include "content/public/browser/web_contents.h"
++#include "extensions/browser/event_router.h"
 +#include "third_party/blink/public/common/input/web_input_event.h"
 +#include "third_party/blink/public/common/input/web_mouse_event.h"
 +#include "ui/accessibility/ax_action_data.h"
@@ -66,128 +84,16 @@ index 0000000000000..84988d84caa41
 +#include "ui/gfx/codec/png_codec.h"
 +#include "ui/gfx/image/image.h"
 +#include "ui/snapshot/snapshot.h"
++#include "url/gurl.h"
++#include "url/origin.h"
 +
 +namespace extensions {
 +namespace api {
 +
 +namespace {
 +
-+// Serializes ui::AXNodeData to base::Value::Dict with all fields
-+base::Value::Dict SerializeAXNodeData(const ui::AXNodeData& node) {
-+  base::Value::Dict dict;
-+
-+  // Core identity
-+  dict.Set("id", node.id);
-+  dict.Set("role", ui::ToString(node.role));
-+
-+  // Hierarchy
-+  if (!node.child_ids.empty()) {
-+    base::Value::List children;
-+    for (int32_t child_id : node.child_ids) {
-+      children.Append(child_id);
-+    }
-+    dict.Set("childIds", std::move(children));
-+  }
-+
-+  // State bitfield converted to string array
-+  base::Value::List states;
-+  for (int i = static_cast<int>(ax::mojom::State::kMinValue);
-+       i <= static_cast<int>(ax::mojom::State::kMaxValue); ++i) {
-+    auto state = static_cast<ax::mojom::State>(i);
-+    if (node.HasState(state)) {
-+      states.Append(ui::ToString(state));
-+    }
-+  }
-+  if (!states.empty()) {
-+    dict.Set("states", std::move(states));
-+  }
-+
-+  // Actions bitfield converted to string array
-+  base::Value::List actions;
-+  for (int i = static_cast<int>(ax::mojom::Action::kMinValue);
-+       i <= static_cast<int>(ax::mojom::Action::kMaxValue); ++i) {
-+    auto action = static_cast<ax::mojom::Action>(i);
-+    if (node.HasAction(action)) {
-+      actions.Append(ui::ToString(action));
-+    }
-+  }
-+  if (!actions.empty()) {
-+    dict.Set("actions", std::move(actions));
-+  }
-+
-+  // String attributes map with enum keys converted to strings
-+  if (node.string_attributes.size() > 0) {
-+    base::Value::Dict attrs;
-+    for (const auto& [key, value] : node.string_attributes) {
-+      attrs.Set(ui::ToString(key), value);
-+    }
-+    dict.Set("stringAttributes", std::move(attrs));
-+  }
-+
-+  // Int attributes map
-+  if (node.int_attributes.size() > 0) {
-+    base::Value::Dict attrs;
-+    for (const auto& [key, value] : node.int_attributes) {
-+      attrs.Set(ui::ToString(key), value);
-+    }
-+    dict.Set("intAttributes", std::move(attrs));
-+  }
-+
-+  // Float attributes map
-+  if (node.float_attributes.size() > 0) {
-+    base::Value::Dict attrs;
-+    for (const auto& [key, value] : node.float_attributes) {
-+      attrs.Set(ui::ToString(key), static_cast<double>(value));
-+    }
-+    dict.Set("floatAttributes", std::move(attrs));
-+  }
-+
-+  // Bool attributes map
-+  if (node.bool_attributes && node.bool_attributes->Size() > 0) {
-+    base::Value::Dict attrs;
-+    node.bool_attributes->ForEach([&attrs](ax::mojom::BoolAttribute key, bool value) {
-+      attrs.Set(ui::ToString(key), value);
-+    });
-+    dict.Set("boolAttributes", std::move(attrs));
-+  }
-+
-+  // IntList attributes map
-+  if (node.intlist_attributes.size() > 0) {
-+    base::Value::Dict attrs;
-+    for (const auto& [key, values] : node.intlist_attributes) {
-+      base::Value::List list;
-+      for (int v : values) {
-+        list.Append(v);
-+      }
-+      attrs.Set(ui::ToString(key), std::move(list));
-+    }
-+    dict.Set("intListAttributes", std::move(attrs));
-+  }
-+
-+  // StringList attributes map
-+  if (node.stringlist_attributes.size() > 0) {
-+    base::Value::Dict attrs;
-+    for (const auto& [key, values] : node.stringlist_attributes) {
-+      base::Value::List list;
-+      for (const auto& v : values) {
-+        list.Append(v);
-+      }
-+      attrs.Set(ui::ToString(key), std::move(list));
-+    }
-+    dict.Set("stringListAttributes", std::move(attrs));
-+  }
-+
-+  // HTML attributes (name-value pairs)
-+  if (!node.html_attributes.empty()) {
-+    base::Value::Dict attrs;
-+    for (const auto& [name, value] : node.html_attributes) {
-+      attrs.Set(name, value);
-+    }
-+    dict.Set("htmlAttributes", std::move(attrs));
-+  }
-+
-+  return dict;
-+}
++// Nodes per page for cursor calls that do not repeat pageSize
++constexpr size_t kDefaultPageSize = 5000;
 +
 +// Serializes ui::AXTreeData to base::Value::Dict
 +base::Value::Dict SerializeAXTreeData(const ui::AXTreeData& tree_data) {
@@ -230,6 +136,67 @@ index 0000000000000..84988d84caa41
 +  return dict;
 +}
 +
++// Builds a getAccessibilityTree result from |entries|, a range of the nodes
++// |projection| selects from |tree_update|. |child_ids| holds the projected
++// children of each of |entries| and is only read for the dict format.
++browser_os::AccessibilityTree BuildAccessibilityTree(
++    const ui::AXTreeUpdate& tree_update,
++    const AXTreeProjection& projection,
++    base::span<const AXTreeProjection::Entry> entries,
++    base::span<const std::vector<int32_t>> child_ids,
++    browser_os::AccessibilityTreeFormat format) {
++  browser_os::AccessibilityTree result;
++  result.root_id = tree_update.root_id;
++  base::ElapsedTimer timer;
++
++  if (format == browser_os::AccessibilityTreeFormat::kColumnar) {
++    result.columnar =
++        AXTreeColumnarEncoder::Encode(tree_update, projection, entries);
++    LogPerfRecord("ax_tree_columnar", entries.size(), result.columnar->size(),
++                  timer.Elapsed());
++  } else {
++    // Serialize the selected nodes with the requested AX data
++    base::Value::Dict nodes;
++    for (size_t i = 0; i < entries.size(); ++i) {
++      const ui::AXNodeData& node_data = tree_update.nodes[entries[i].index];
++      nodes.Set(base::NumberToString(node_data.id),
++                SerializeAXNodeData(node_data, projection, child_ids[i]));
++    }
++    result.nodes.emplace();
++    result.nodes->additional_properties = std::move(nodes);
++    LogPerfRecord("ax_tree_dict", entries.size(), entries.size(),
++                  timer.Elapsed());
++  }
++
++  // Serialize tree-level metadata
++  browser_os::AccessibilityTree::TreeData tree_data_obj;
++  tree_data_obj.additional_properties = SerializeAXTreeData(tree_update.tree_data);
++  result.tree_data = std::move(tree_data_obj);
++  return result;
++}
++
++// Builds the page of |pinned| that starts at node |offset|.
++browser_os::AccessibilityTree BuildAccessibilityTreePage(
++    const BrowserOSAXTreeCache::PinnedTree& pinned,
++    size_t offset,
++    size_t page_size,
++    browser_os::AccessibilityTreeFormat format) {
++  size_t total = pinned.entries.size();
++  size_t end = std::min(total, offset + page_size);
++  size_t count = end - offset;
++  browser_os::AccessibilityTree result = BuildAccessibilityTree(
++      pinned.tree_update, pinned.projection,
++      base::span(pinned.entries).subspan(offset, count),
++      base::span(pinned.child_ids).subspan(offset, count), format);
++  result.version = pinned.version;
++  result.page_start = static_cast<int>(offset);
++  result.total_nodes = static_cast<int>(total);
++  if (end < total) {
++    result.next_cursor = BrowserOSAXTreeCache::MakeCursor(pinned.version, end);
++  }
++  return result;
++}
++
 +// Helper to find which PrefService contains a preference
 +// Tries Local State first, then Profile prefs
 +PrefService* FindPrefService(const std::string& pref_name, Profile* profile) {
@@ -246,6 +213,96 @@ index 0000000000000..84988d84caa41
 +  return nullptr;
 +}
 +
++// IDs of interactive snapshots, unique across every function taking one
++uint32_t NextSnapshotId() {
++  static uint32_t next_snapshot_id = 1;
++  return next_snapshot_id++;
++}
++
++// Screens below the viewport that |options| asks for, or nullopt for the
++// whole page
++std::optional<int> GetScreensAhead(
++    const browser_os::InteractiveSnapshotOptions& options) {
++  switch (options.scope) {
++    case browser_os::SnapshotScope::kViewport:
++      return 0;
++    case browser_os::SnapshotScope::kScreens:
++      return std::max(0, options.screens.value_or(1));
++    case browser_os::SnapshotScope::kFull:
++      return std::nullopt;
++    case browser_os::SnapshotScope::kNone:
++      if (options.viewport_only.value_or(false)) {
++        return 0;
++      }
++      return std::nullopt;
++  }
++  NOTREACHED();
++}
++
++// Keys sendKeys can send
++bool IsSupportedKey(const std::string& key) {
++  // A simple check instead of std::set to avoid exit-time destructor
++  return key == "Enter" || key == "Delete" || key == "Backspace" ||
++         key == "Tab" || key == "Escape" || key == "ArrowUp" ||
++         key == "ArrowDown" || key == "ArrowLeft" || key == "ArrowRight" ||
++         key == "Home" || key == "End" || key == "PageUp" ||
++         key == "PageDown";
++}
++
++// Reads the waitForQuiet settings of |options|. Returns an error message
++// for invalid ones.
++std::optional<std::string> ReadQuietOptions(
++    const std::optional<browser_os::InteractionOptions>& options,
++    bool& wait_for_quiet,
++    BrowserOSQuiescenceWatcher::Options& quiet_options) {
++  wait_for_quiet = options && options->wait_for_quiet.value_or(false);
++  if (!wait_for_quiet) {
++    return std::nullopt;
++  }
++  if ((options->quiet_window_ms && *options->quiet_window_ms <= 0) ||
++      (options->max_wait_ms && *options->max_wait_ms <= 0)) {
++    return "quietWindowMs and maxWaitMs must be positive";
++  }
++  if (options->quiet_window_ms) {
++    quiet_options.quiet_window = base::Milliseconds(*options->quiet_window_ms);
++  }
++  if (options->max_wait_ms) {
++    quiet_options.max_wait = base::Milliseconds(*options->max_wait_ms);
++  }
++  return std::nullopt;
++}
++
++// Interaction whose learned timeout bounds how long an executeActions step
++// waits for the page to take its action. Accessibility actions act like the
++// JavaScript fallbacks.
++InteractionKind DeliveryKind(browser_os::ActionType type) {
++  switch (type) {
++    case browser_os::ActionType::kClick:
++      return InteractionKind::kHtmlClick;
++    case browser_os::ActionType::kInputText:
++      return InteractionKind::kJavaScriptType;
++    case browser_os::ActionType::kClear:
++      return InteractionKind::kClear;
++    case browser_os::ActionType::kSendKeys:
++      return InteractionKind::kKeyPress;
++    case browser_os::ActionType::kNone:
++      break;
++  }
++  NOTREACHED();
++}
++
++browser_os::PageChanges ToPageChanges(const ChangeSummary& summary) {
++  browser_os::PageChanges changes;
++  changes.navigation_occurred = summary.navigation_occurred;
++  changes.focus_changed = summary.focus_changed;
++  changes.new_tab_opened = summary.new_tab_opened;
++  changes.ax_updates = static_cast<int>(summary.ax_updates);
++  changes.nodes_added = static_cast<int>(summary.nodes_added);
++  changes.nodes_removed = static_cast<int>(summary.nodes_removed);
++  changes.timed_out = summary.timed_out;
++  return changes;
++}
++
 +// Helper to determine preference type name from value
 +std::string GetPrefTypeName(const base::Value* value) {
 +  switch (value->type()) {
@@ -267,9 +324,6 @@ index 0000000000000..84988d84caa41
 +
 +}  // namespace
 +
-+// Static member initialization
-+uint32_t BrowserOSGetInteractiveSnapshotFunction::next_snapshot_id_ = 1;
-+
 +// Constructor and destructor implementations
 +BrowserOSGetInteractiveSnapshotFunction::BrowserOSGetInteractiveSnapshotFunction() = default;
 +BrowserOSGetInteractiveSnapshotFunction::~BrowserOSGetInteractiveSnapshotFunction() = default;
@@ -290,6 +344,52 @@ index 0000000000000..84988d84caa41
 +  
 +  content::WebContents* web_contents = tab_info->web_contents;
 +
++  std::optional<std::string> cursor;
++  if (params->options) {
++    if (params->options->format != browser_os::AccessibilityTreeFormat::kNone) {
++      format_ = params->options->format;
++    }
++    std::optional<AXTreeProjection> projection =
++        AXTreeProjection::FromOptions(*params->options, &error_message);
++    if (!projection) {
++      return RespondNow(Error(error_message));
++    }
++    projection_ = std::move(*projection);
++    if (params->options->page_size) {
++      if (*params->options->page_size <= 0) {
++        return RespondNow(Error("pageSize must be positive"));
++      }
++      page_size_ = static_cast<size_t>(*params->options->page_size);
++    }
++    cursor = params->options->cursor;
++  }
++
++  // Later pages come from the tree pinned by the first call
++  if (cursor) {
++    std::string version;
++    size_t offset = 0;
++    if (!BrowserOSAXTreeCache::ParseCursor(*cursor, &version, &offset)) {
++      return RespondNow(Error("Invalid cursor"));
++    }
++    auto* cache = BrowserOSAXTreeCache::FromWebContents(web_contents);
++    const BrowserOSAXTreeCache::PinnedTree* pinned =
++        cache ? cache->Get(version) : nullptr;
++    if (!pinned) {
++      return RespondNow(
++          Error("Accessibility tree expired; request it again without a "
++                "cursor"));
++    }
++    if (offset > pinned->entries.size()) {
++      return RespondNow(Error("Cursor out of range"));
++    }
++    return RespondNow(ArgumentList(
++        browser_os::GetAccessibilityTree::Results::Create(
++            BuildAccessibilityTreePage(
++                *pinned, offset, page_size_.value_or(kDefaultPageSize),
++                format_))));
++  }
++  web_contents_ = web_contents->GetWeakPtr();
++
 +  // Enable accessibility if needed
 +  content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
 +  if (!rfh) {
@@ -297,13 +397,13 @@ index 0000000000000..84988d84caa41
 +  }
 +
 +  // Request accessibility tree snapshot
-+  // Use WebContents with extended properties to get a full tree
++  // The projection decides the mode; with no options it asks for extended
++  // properties and inline text boxes to get a full tree
 +  web_contents->RequestAXTreeSnapshot(
 +      base::BindOnce(
 +          &BrowserOSGetAccessibilityTreeFunction::OnAccessibilityTreeReceived,
 +          this),
-+      ui::AXMode(ui::AXMode::kWebContents | ui::AXMode::kExtendedProperties |
-+                 ui::AXMode::kInlineTextBoxes),
++      projection_.GetAXMode(),
 +      /* max_nodes= */ 0,  // No limit
 +      /* timeout= */ base::TimeDelta(),
 +      content::WebContents::AXTreeSnapshotPolicy::kAll);
@@ -313,24 +413,30 @@ index 0000000000000..84988d84caa41
 +
 +void BrowserOSGetAccessibilityTreeFunction::OnAccessibilityTreeReceived(
 +    ui::AXTreeUpdate& tree_update) {
-+  browser_os::AccessibilityTree result;
-+  result.root_id = tree_update.root_id;
-+
-+  // Serialize all nodes with complete AX data
-+  base::Value::Dict nodes;
-+  for (const auto& node_data : tree_update.nodes) {
-+    nodes.Set(base::NumberToString(node_data.id),
-+              SerializeAXNodeData(node_data));
++  // Paginated: pin the tree for the calls that follow and return page one
++  if (page_size_) {
++    if (!web_contents_) {
++      Respond(Error("Tab was closed"));
++      return;
++    }
++    BrowserOSAXTreeCache::CreateForWebContents(web_contents_.get());
++    const BrowserOSAXTreeCache::PinnedTree& pinned =
++        BrowserOSAXTreeCache::FromWebContents(web_contents_.get())
++            ->Pin(std::move(tree_update), projection_);
++    Respond(ArgumentList(browser_os::GetAccessibilityTree::Results::Create(
++        BuildAccessibilityTreePage(pinned, 0, *page_size_, format_))));
++    return;
 +  }
-+  result.nodes.additional_properties = std::move(nodes);
 +
-+  // Serialize tree-level metadata
-+  browser_os::AccessibilityTree::TreeData tree_data_obj;
-+  tree_data_obj.additional_properties = SerializeAXTreeData(tree_update.tree_data);
-+  result.tree_data = std::move(tree_data_obj);
-+
-+  Respond(ArgumentList(
-+      browser_os::GetAccessibilityTree::Results::Create(result)));
++  std::vector<AXTreeProjection::Entry> entries =
++      projection_.Select(tree_update);
++  std::vector<std::vector<int32_t>> child_ids;
++  if (format_ != browser_os::AccessibilityTreeFormat::kColumnar) {
++    child_ids = AXTreeProjection::GetChildIds(tree_update, entries);
++  }
++  Respond(ArgumentList(browser_os::GetAccessibilityTree::Results::Create(
++      BuildAccessibilityTree(tree_update, projection_, entries, child_ids,
++                             format_))));
 +}
 +
 +// Implementation of BrowserOSGetInteractiveSnapshotFunction
@@ -360,25 +466,48 @@ index 0000000000000..84988d84caa41
 +  // Store tab ID for mapping
 +  tab_id_ = tab_info->tab_id;
 +
++  // Resolve the snapshot scope
++  if (params->options) {
++    screens_ahead_ = GetScreensAhead(*params->options);
++    stream_ = params->options->stream.value_or(false);
++  }
++
 +  // Check frame stability before requesting snapshot
 +  content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
 +  if (!rfh || !rfh->IsRenderFrameLive() || !rfh->IsActive()) {
 +    LOG(WARNING) << "[browseros] Frame not stable for AX snapshot - skipping";
 +    browser_os::InteractiveSnapshot empty_snapshot;
-+    empty_snapshot.snapshot_id = next_snapshot_id_++;
++    empty_snapshot.snapshot_id = NextSnapshotId();
 +    empty_snapshot.timestamp = base::Time::Now().InMillisecondsFSinceUnixEpoch();
 +    empty_snapshot.processing_time_ms = 0;
 +    return RespondNow(ArgumentList(
 +        browser_os::GetInteractiveSnapshot::Results::Create(empty_snapshot)));
 +  }
 +  
++  // Serve from the tab's live tree when it can describe the whole page. The
++  // first call only attaches the engine and takes the full snapshot path.
++  bool incremental = !params->options || !params->options->incremental ||
++                     *params->options->incremental;
++  if (incremental) {
++    BrowserOSLiveSnapshotEngine::CreateForWebContents(web_contents);
++    auto* engine = BrowserOSLiveSnapshotEngine::FromWebContents(web_contents);
++    if (engine->CanServeSnapshot()) {
++      snapshot_id_ = NextSnapshotId();
++      engine->BuildSnapshot(
++          tab_id_, snapshot_id_, screens_ahead_,
++          base::BindOnce(
++              &BrowserOSGetInteractiveSnapshotFunction::OnSnapshotProcessed,
++              this));
++      return RespondLater();
++    }
++  }
++  
 +  // Request accessibility tree snapshot
 +  web_contents->RequestAXTreeSnapshot(
 +      base::BindOnce(
 +          &BrowserOSGetInteractiveSnapshotFunction::OnAccessibilityTreeReceived,
 +          this),
-+      ui::AXMode(ui::AXMode::kWebContents | ui::AXMode::kExtendedProperties |
-+                 ui::AXMode::kInlineTextBoxes),
++      kInteractiveSnapshotAXMode,
 +      /* max_nodes= */ 0,  // No limit
 +      /* timeout= */ base::TimeDelta(),
 +      content::WebContents::AXTreeSnapshotPolicy::kAll);
@@ -393,7 +522,7 @@ index 0000000000000..84988d84caa41
 +  if (!web_contents_) {
 +    LOG(WARNING) << "[browseros] WebContents gone during AX snapshot callback";
 +    browser_os::InteractiveSnapshot empty_snapshot;
-+    empty_snapshot.snapshot_id = next_snapshot_id_++;
++    empty_snapshot.snapshot_id = NextSnapshotId();
 +    empty_snapshot.timestamp = base::Time::Now().InMillisecondsFSinceUnixEpoch();
 +    empty_snapshot.processing_time_ms = 0;
 +    Respond(ArgumentList(
@@ -405,7 +534,7 @@ index 0000000000000..84988d84caa41
 +  if (!rfh || !rfh->IsRenderFrameLive()) {
 +    LOG(WARNING) << "[browseros] Frame became unstable during AX snapshot callback";
 +    browser_os::InteractiveSnapshot empty_snapshot;
-+    empty_snapshot.snapshot_id = next_snapshot_id_++;
++    empty_snapshot.snapshot_id = NextSnapshotId();
 +    empty_snapshot.timestamp = base::Time::Now().InMillisecondsFSinceUnixEpoch();
 +    empty_snapshot.processing_time_ms = 0;
 +    Respond(ArgumentList(
@@ -414,11 +543,20 @@ index 0000000000000..84988d84caa41
 +  }
 +  
 +  // Simple API layer - just delegates to the processor
++  snapshot_id_ = NextSnapshotId();
++  SnapshotProcessor::ChunkCallback chunk_callback;
++  if (stream_) {
++    chunk_callback = base::BindRepeating(
++        &BrowserOSGetInteractiveSnapshotFunction::DispatchSnapshotChunk,
++        base::WrapRefCounted(this), /*done=*/false);
++  }
 +  SnapshotProcessor::ProcessAccessibilityTree(
 +      tree_update,
 +      tab_id_,
-+      next_snapshot_id_++,
++      snapshot_id_,
 +      web_contents_,
++      screens_ahead_,
++      std::move(chunk_callback),
 +      base::BindOnce(
 +          &BrowserOSGetInteractiveSnapshotFunction::OnSnapshotProcessed,
 +          base::WrapRefCounted(this)));
@@ -426,10 +564,100 @@ index 0000000000000..84988d84caa41
 +
 +void BrowserOSGetInteractiveSnapshotFunction::OnSnapshotProcessed(
 +    SnapshotProcessingResult result) {
++  if (stream_) {
++    // The live engine answers in one piece; stream its elements in
++    // batch-sized chunks so consumers see the same shape either way.
++    constexpr size_t kChunkSize = 100;
++    std::vector<browser_os::InteractiveNode>& elements =
++        result.snapshot.elements;
++    for (size_t i = 0; i < elements.size(); i += kChunkSize) {
++      size_t end = std::min(i + kChunkSize, elements.size());
++      DispatchSnapshotChunk(
++          /*done=*/false,
++          std::vector<browser_os::InteractiveNode>(
++              std::make_move_iterator(elements.begin() + i),
++              std::make_move_iterator(elements.begin() + end)));
++    }
++    elements.clear();
++    DispatchSnapshotChunk(/*done=*/true, {});
++  }
 +  Respond(ArgumentList(
 +      browser_os::GetInteractiveSnapshot::Results::Create(result.snapshot)));
 +}
 +
++void BrowserOSGetInteractiveSnapshotFunction::DispatchSnapshotChunk(
++    bool done,
++    std::vector<browser_os::InteractiveNode> elements) {
++  EventRouter* event_router = EventRouter::Get(browser_context());
++  if (!event_router) {
++    return;
++  }
++  
++  browser_os::SnapshotChunk chunk;
++  chunk.snapshot_id = snapshot_id_;
++  chunk.tab_id = tab_id_;
++  chunk.sequence = chunk_sequence_++;
++  chunk.elements = std::move(elements);
++  chunk.done = done;
++  
++  // Only the extension that asked for the snapshot receives its chunks
++  event_router->DispatchEventToExtension(
++      extension_id(),
++      std::make_unique<Event>(
++          events::UNKNOWN, browser_os::OnSnapshotChunk::kEventName,
++          browser_os::OnSnapshotChunk::Create(chunk), browser_context()));
++}
++
++// Implementation of BrowserOSInteractionFunction
++
++BrowserOSInteractionFunction::BrowserOSInteractionFunction() = default;
++BrowserOSInteractionFunction::~BrowserOSInteractionFunction() = default;
++
++std::optional<std::string> BrowserOSInteractionFunction::BeginInteraction(
++    content::WebContents* web_contents,
++    const std::optional<browser_os::InteractionOptions>& options) {
++  bool wait_for_quiet = false;
++  if (auto error = ReadQuietOptions(options, wait_for_quiet, quiet_options_)) {
++    return error;
++  }
++  if (wait_for_quiet) {
++    watcher_ = std::make_unique<BrowserOSQuiescenceWatcher>(web_contents);
++  }
++  return std::nullopt;
++}
++
++void BrowserOSInteractionFunction::OnActionDone(bool change_detected) {
++  if (!change_detected) {
++    LOG(WARNING) << "[browseros] " << name() << ": No change detected";
++  }
++
++  if (!watcher_) {
++    browser_os::InteractionResponse response;
++    response.success = change_detected;
++    Respond(ArgumentList(CreateResults(response)));
++    return;
++  }
++
++  // Nothing happened at all, so there is nothing to settle
++  if (!change_detected && !watcher_->summary().changed()) {
++    RespondWithChanges(false, watcher_->summary());
++    return;
++  }
++  watcher_->WaitForQuiet(
++      quiet_options_,
++      base::BindOnce(&BrowserOSInteractionFunction::RespondWithChanges, this,
++                     change_detected));
++}
++
++void BrowserOSInteractionFunction::RespondWithChanges(
++    bool change_detected,
++    const ChangeSummary& summary) {
++  browser_os::InteractionResponse response;
++  response.success = change_detected;
++  response.changes = ToPageChanges(summary);
++  Respond(ArgumentList(CreateResults(response)));
++}
++
 +// Implementation of BrowserOSClickFunction
 +
 +ExtensionFunction::ResponseAction BrowserOSClickFunction::Run() {
@@ -462,15 +690,20 @@ index 0000000000000..84988d84caa41
 +  
 +  const NodeInfo& node_info = node_it->second;
 +  
++  if (auto error = BeginInteraction(web_contents, params->options)) {
++    return RespondNow(Error(*error));
++  }
++
 +  // Perform click with change detection
-+  bool change_detected = ClickWithDetection(web_contents, node_info);
-+  
-+  // Create interaction response
-+  browser_os::InteractionResponse response;
-+  response.success = change_detected;
-+  
-+  return RespondNow(ArgumentList(
-+      browser_os::Click::Results::Create(response)));
++  ClickWithDetection(
++      web_contents, node_info,
++      base::BindOnce(&BrowserOSClickFunction::OnActionDone, this));
++  return RespondLater();
++}
++
++base::Value::List BrowserOSClickFunction::CreateResults(
++    const browser_os::InteractionResponse& response) {
++  return browser_os::Click::Results::Create(response);
 +}
 +
 +// Implementation of BrowserOSInputTextFunction
@@ -507,19 +740,20 @@ index 0000000000000..84988d84caa41
 +  
 +  LOG(INFO) << "[browseros] InputText: Starting input for nodeId: " << params->node_id;
 +  
-+  // Use TypeWithDetection which tries both native and JavaScript methods
-+  bool change_detected = TypeWithDetection(web_contents, node_info, params->text);
-+  
-+  if (!change_detected) {
-+    LOG(WARNING) << "[browseros] InputText: No change detected after typing";
++  if (auto error = BeginInteraction(web_contents, params->options)) {
++    return RespondNow(Error(*error));
 +  }
-+  
-+  // Create interaction response
-+  browser_os::InteractionResponse response;
-+  response.success = change_detected;
-+  
-+  return RespondNow(ArgumentList(
-+      browser_os::InputText::Results::Create(response)));
++
++  // Use TypeWithDetection which tries both native and JavaScript methods
++  TypeWithDetection(
++      web_contents, node_info, params->text,
++      base::BindOnce(&BrowserOSInputTextFunction::OnActionDone, this));
++  return RespondLater();
++}
++
++base::Value::List BrowserOSInputTextFunction::CreateResults(
++    const browser_os::InteractionResponse& response) {
++  return browser_os::InputText::Results::Create(response);
 +}
 +
 +// Implementation of BrowserOSClearFunction
@@ -556,19 +790,20 @@ index 0000000000000..84988d84caa41
 +  
 +  LOG(INFO) << "[browseros] Clear: Clearing field for nodeId: " << params->node_id;
 +  
-+  // Use ClearWithDetection which handles focus and clearing
-+  bool change_detected = ClearWithDetection(web_contents, node_info);
-+  
-+  if (!change_detected) {
-+    LOG(WARNING) << "[browseros] Clear: No change detected after clearing";
++  if (auto error = BeginInteraction(web_contents, params->options)) {
++    return RespondNow(Error(*error));
 +  }
-+  
-+  // Create interaction response
-+  browser_os::InteractionResponse response;
-+  response.success = change_detected;
-+  
-+  return RespondNow(ArgumentList(
-+      browser_os::Clear::Results::Create(response)));
++
++  // Use ClearWithDetection which handles focus and clearing
++  ClearWithDetection(
++      web_contents, node_info,
++      base::BindOnce(&BrowserOSClearFunction::OnActionDone, this));
++  return RespondLater();
++}
++
++base::Value::List BrowserOSClearFunction::CreateResults(
++    const browser_os::InteractionResponse& response) {
++  return browser_os::Clear::Results::Create(response);
 +}
 +
 +// Implementation of BrowserOSGetPageLoadStatusFunction
@@ -793,32 +1028,338 @@ index 0000000000000..84988d84caa41
 +  
 +  content::WebContents* web_contents = tab_info->web_contents;
 +  
-+  // Validate the key - use a simple check instead of std::set to avoid exit-time destructor
-+  const std::string& key = params->key;
-+  bool is_supported = (key == "Enter" || key == "Delete" || key == "Backspace" ||
-+                       key == "Tab" || key == "Escape" || key == "ArrowUp" ||
-+                       key == "ArrowDown" || key == "ArrowLeft" || key == "ArrowRight" ||
-+                       key == "Home" || key == "End" || key == "PageUp" || key == "PageDown");
-+  
-+  if (!is_supported) {
++  // Validate the key
++  if (!IsSupportedKey(params->key)) {
 +    return RespondNow(Error("Unsupported key: " + params->key));
 +  }
 +  
 +  LOG(INFO) << "[browseros] SendKeys: Sending key '" << params->key << "'";
 +  
++  if (auto error = BeginInteraction(web_contents, params->options)) {
++    return RespondNow(Error(*error));
++  }
++
 +  // Send the key with change detection
-+  bool change_detected = KeyPressWithDetection(web_contents, params->key);
-+  
-+  if (!change_detected) {
-+    LOG(WARNING) << "[browseros] SendKeys: No change detected after key press";
++  KeyPressWithDetection(
++      web_contents, params->key,
++      base::BindOnce(&BrowserOSSendKeysFunction::OnActionDone, this));
++  return RespondLater();
++}
++
++base::Value::List BrowserOSSendKeysFunction::CreateResults(
++    const browser_os::InteractionResponse& response) {
++  return browser_os::SendKeys::Results::Create(response);
++}
++
++// Implementation of BrowserOSExecuteActionsFunction
++
++BrowserOSExecuteActionsFunction::Step::Step() = default;
++BrowserOSExecuteActionsFunction::Step::~Step() = default;
++BrowserOSExecuteActionsFunction::Step::Step(Step&&) = default;
++BrowserOSExecuteActionsFunction::Step&
++BrowserOSExecuteActionsFunction::Step::operator=(Step&&) = default;
++
++BrowserOSExecuteActionsFunction::BrowserOSExecuteActionsFunction() = default;
++BrowserOSExecuteActionsFunction::~BrowserOSExecuteActionsFunction() = default;
++
++ExtensionFunction::ResponseAction BrowserOSExecuteActionsFunction::Run() {
++  std::optional<browser_os::ExecuteActions::Params> params =
++      browser_os::ExecuteActions::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  // Get the target tab
++  std::string error_message;
++  auto tab_info = GetTabFromOptionalId(params->tab_id, browser_context(),
++                                       include_incognito_information(),
++                                       &error_message);
++  if (!tab_info) {
++    return RespondNow(Error(error_message));
 +  }
-+  
-+  // Create interaction response
-+  browser_os::InteractionResponse response;
-+  response.success = change_detected;
-+  
-+  return RespondNow(ArgumentList(
-+      browser_os::SendKeys::Results::Create(response)));
++  tab_id_ = tab_info->tab_id;
++  web_contents_ = tab_info->web_contents->GetWeakPtr();
++
++  if (params->steps.empty()) {
++    return RespondNow(Error("No steps given"));
++  }
++
++  // Check every step before the first one runs, and copy the nodes so a
++  // snapshot taken meanwhile cannot change them
++  auto tab_it = GetNodeIdMappings().find(tab_id_);
++  steps_.reserve(params->steps.size());
++  for (size_t i = 0; i < params->steps.size(); ++i) {
++    const browser_os::ActionStep& action = params->steps[i];
++    std::string prefix = "Step " + base::NumberToString(i) + ": ";
++    Step& step = steps_.emplace_back();
++    step.type = action.type;
++
++    if (action.type == browser_os::ActionType::kSendKeys) {
++      if (!action.key) {
++        return RespondNow(Error(prefix + "key is required"));
++      }
++      if (!IsSupportedKey(*action.key)) {
++        return RespondNow(Error(prefix + "Unsupported key: " + *action.key));
++      }
++      step.text = *action.key;
++    } else {
++      if (!action.node_id) {
++        return RespondNow(Error(prefix + "nodeId is required"));
++      }
++      if (tab_it == GetNodeIdMappings().end()) {
++        return RespondNow(Error("No snapshot data for this tab"));
++      }
++      auto node_it = tab_it->second.find(*action.node_id);
++      if (node_it == tab_it->second.end()) {
++        return RespondNow(Error(prefix + "Node ID not found"));
++      }
++      step.node = node_it->second;
++    }
++    if (action.type == browser_os::ActionType::kInputText) {
++      if (!action.text) {
++        return RespondNow(Error(prefix + "text is required"));
++      }
++      step.text = *action.text;
++    }
++
++    if (auto error = ReadQuietOptions(action.options, step.wait_for_quiet,
++                                      step.quiet_options)) {
++      return RespondNow(Error(prefix + *error));
++    }
++    step.wait_for_change =
++        action.wait_for_change.value_or(false) || step.wait_for_quiet;
++  }
++
++  // Accessibility actions and key events reach the renderer through
++  // separate channels with no order between them. A step that does not wait
++  // and is followed by one on the other channel waits until the page took
++  // it, so inputText followed by sendKeys("Enter") submits the new value.
++  for (size_t i = 0; i + 1 < steps_.size(); ++i) {
++    bool is_key = steps_[i].type == browser_os::ActionType::kSendKeys;
++    bool next_is_key =
++        steps_[i + 1].type == browser_os::ActionType::kSendKeys;
++    steps_[i].wait_for_delivery =
++        !steps_[i].wait_for_change && is_key != next_is_key;
++  }
++
++  if (params->options) {
++    continue_on_no_change_ =
++        params->options->continue_on_no_change.value_or(false);
++    take_snapshot_ = params->options->snapshot.value_or(false);
++    if (const auto& snapshot_options = params->options->snapshot_options) {
++      screens_ahead_ = GetScreensAhead(*snapshot_options);
++      incremental_snapshot_ = snapshot_options->incremental.value_or(true);
++    }
++  }
++
++  LOG(INFO) << "[browseros] ExecuteActions: Running " << steps_.size()
++            << " steps";
++  started_ = base::TimeTicks::Now();
++  response_.success = true;
++  RunNextStep();
++  return RespondLater();
++}
++
++void BrowserOSExecuteActionsFunction::RunNextStep() {
++  watcher_.reset();
++  if (!web_contents_) {
++    Respond(Error("Tab was closed"));
++    return;
++  }
++  if (next_step_ == steps_.size()) {
++    Finish();
++    return;
++  }
++
++  const Step& step = steps_[next_step_];
++  content::WebContents* web_contents = web_contents_.get();
++  if (step.wait_for_delivery) {
++    BrowserOSChangeTracker::CreateForWebContents(web_contents);
++    auto* tracker = BrowserOSChangeTracker::FromWebContents(web_contents);
++    uint64_t generation = tracker->generation();
++    base::TimeDelta timeout = BrowserOSTimeoutModel::GetTimeout(
++        Profile::FromBrowserContext(browser_context())->GetPrefs(),
++        web_contents->GetPrimaryMainFrame()->GetLastCommittedOrigin(),
++        DeliveryKind(step.type));
++    SendAction(web_contents, step);
++    tracker->WaitForChange(
++        generation, timeout,
++        base::BindOnce(&BrowserOSExecuteActionsFunction::OnStepDelivered,
++                       this));
++    return;
++  }
++  if (!step.wait_for_change) {
++    SendAction(web_contents, step);
++    FinishStep(std::nullopt, nullptr);
++    return;
++  }
++
++  if (step.wait_for_quiet) {
++    watcher_ = std::make_unique<BrowserOSQuiescenceWatcher>(web_contents);
++  }
++  ActionCallback done =
++      base::BindOnce(&BrowserOSExecuteActionsFunction::OnStepDone, this);
++  switch (step.type) {
++    case browser_os::ActionType::kClick:
++      ClickWithDetection(web_contents, step.node, std::move(done));
++      break;
++    case browser_os::ActionType::kInputText:
++      TypeWithDetection(web_contents, step.node, step.text, std::move(done));
++      break;
++    case browser_os::ActionType::kClear:
++      ClearWithDetection(web_contents, step.node, std::move(done));
++      break;
++    case browser_os::ActionType::kSendKeys:
++      KeyPressWithDetection(web_contents, step.text, std::move(done));
++      break;
++    case browser_os::ActionType::kNone:
++      NOTREACHED();
++  }
++}
++
++void BrowserOSExecuteActionsFunction::SendAction(
++    content::WebContents* web_contents,
++    const Step& step) {
++  // Accessibility actions target the node itself, wherever it is on the
++  // page. They stay in order with each other but not with key events, which
++  // go through the widget's input channel.
++  switch (step.type) {
++    case browser_os::ActionType::kClick:
++      AccessibilityDoDefault(web_contents, step.node);
++      break;
++    case browser_os::ActionType::kInputText:
++      AccessibilityFocus(web_contents, step.node);
++      AccessibilitySetValue(web_contents, step.node, step.text);
++      break;
++    case browser_os::ActionType::kClear:
++      AccessibilitySetValue(web_contents, step.node, std::string());
++      break;
++    case browser_os::ActionType::kSendKeys:
++      KeyPress(web_contents, step.text);
++      break;
++    case browser_os::ActionType::kNone:
++      NOTREACHED();
++  }
++}
++
++void BrowserOSExecuteActionsFunction::OnStepDelivered(bool reacted) {
++  // Only ordering was waited for; the step reports no change either way
++  if (!reacted) {
++    VLOG(1) << "[browseros] ExecuteActions: No reaction to step "
++            << next_step_ << " before the next one";
++  }
++  FinishStep(std::nullopt, nullptr);
++}
++
++void BrowserOSExecuteActionsFunction::OnStepDone(bool changed) {
++  if (!watcher_) {
++    FinishStep(changed, nullptr);
++    return;
++  }
++  // Nothing happened at all, so there is nothing to settle
++  if (!changed && !watcher_->summary().changed()) {
++    FinishStep(changed, &watcher_->summary());
++    return;
++  }
++  watcher_->WaitForQuiet(
++      steps_[next_step_].quiet_options,
++      base::BindOnce(&BrowserOSExecuteActionsFunction::OnPageSettled, this,
++                     changed));
++}
++
++void BrowserOSExecuteActionsFunction::OnPageSettled(
++    bool changed,
++    const ChangeSummary& summary) {
++  FinishStep(changed, &summary);
++}
++
++void BrowserOSExecuteActionsFunction::FinishStep(
++    std::optional<bool> changed,
++    const ChangeSummary* summary) {
++  browser_os::ActionStepResult& result = response_.steps.emplace_back();
++  result.executed = true;
++  result.changed = changed;
++  if (summary) {
++    result.changes = ToPageChanges(*summary);
++  }
++  ++next_step_;
++
++  if (changed == false) {
++    LOG(WARNING) << "[browseros] ExecuteActions: No change from step "
++                 << next_step_ - 1;
++    response_.success = false;
++    if (!continue_on_no_change_) {
++      // Later steps most likely expect what this one failed to do
++      for (; next_step_ < steps_.size(); ++next_step_) {
++        response_.steps.emplace_back().executed = false;
++      }
++    }
++  }
++
++  // Posted, so a long run of steps that do not wait never holds the UI
++  // thread, and the watcher is not destroyed from its own callback
++  base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
++      FROM_HERE,
++      base::BindOnce(&BrowserOSExecuteActionsFunction::RunNextStep, this));
++}
++
++void BrowserOSExecuteActionsFunction::Finish() {
++  LOG(INFO) << "[browseros] ExecuteActions: " << steps_.size()
++            << " steps took "
++            << (base::TimeTicks::Now() - started_).InMilliseconds() << " ms";
++  if (!take_snapshot_) {
++    Respond(ArgumentList(
++        browser_os::ExecuteActions::Results::Create(response_)));
++    return;
++  }
++
++  content::RenderFrameHost* rfh = web_contents_->GetPrimaryMainFrame();
++  if (!rfh || !rfh->IsRenderFrameLive() || !rfh->IsActive()) {
++    LOG(WARNING) << "[browseros] Frame not stable for AX snapshot - skipping";
++    Respond(ArgumentList(
++        browser_os::ExecuteActions::Results::Create(response_)));
++    return;
++  }
++
++  if (incremental_snapshot_) {
++    BrowserOSLiveSnapshotEngine::CreateForWebContents(web_contents_.get());
++    auto* engine =
++        BrowserOSLiveSnapshotEngine::FromWebContents(web_contents_.get());
++    if (engine->CanServeSnapshot()) {
++      engine->BuildSnapshot(
++          tab_id_, NextSnapshotId(), screens_ahead_,
++          base::BindOnce(&BrowserOSExecuteActionsFunction::OnSnapshotProcessed,
++                         this));
++      return;
++    }
++  }
++  web_contents_->RequestAXTreeSnapshot(
++      base::BindOnce(
++          &BrowserOSExecuteActionsFunction::OnAccessibilityTreeReceived, this),
++      kInteractiveSnapshotAXMode,
++      /* max_nodes= */ 0,  // No limit
++      /* timeout= */ base::TimeDelta(),
++      content::WebContents::AXTreeSnapshotPolicy::kAll);
++}
++
++void BrowserOSExecuteActionsFunction::OnAccessibilityTreeReceived(
++    ui::AXTreeUpdate& tree_update) {
++  if (!web_contents_) {
++    LOG(WARNING) << "[browseros] WebContents gone during AX snapshot callback";
++    Respond(ArgumentList(
++        browser_os::ExecuteActions::Results::Create(response_)));
++    return;
++  }
++  SnapshotProcessor::ProcessAccessibilityTree(
++      tree_update, tab_id_, NextSnapshotId(), web_contents_.get(),
++      screens_ahead_, SnapshotProcessor::ChunkCallback(),
++      base::BindOnce(&BrowserOSExecuteActionsFunction::OnSnapshotProcessed,
++                     this));
++}
++
++void BrowserOSExecuteActionsFunction::OnSnapshotProcessed(
++    SnapshotProcessingResult result) {
++  response_.snapshot = std::move(result.snapshot);
++  Respond(ArgumentList(
++      browser_os::ExecuteActions::Results::Create(response_)));
 +}
 +
 +// Implementation of BrowserOSCaptureScreenshotFunction
@@ -1002,6 +1543,8 @@ index 0000000000000..84988d84caa41
 +}
 +
 +// BrowserOSGetSnapshotFunction implementation
++BrowserOSGetSnapshotFunction::~BrowserOSGetSnapshotFunction() = default;
++
 +ExtensionFunction::ResponseAction BrowserOSGetSnapshotFunction::Run() {
 +  auto params = browser_os::GetSnapshot::Params::Create(args());
 +  EXTENSION_FUNCTION_VALIDATE(params);
@@ -1016,6 +1559,64 @@ index 0000000000000..84988d84caa41
 +  }
 +  
 +  content::WebContents* web_contents = tab_info->web_contents;
++  std::optional<size_t>& max_chars = extraction_options_.max_chars;
++
++  // Size budget, in characters
++  if (params->options) {
++    const auto& options = *params->options;
++    if ((options.max_chars && *options.max_chars <= 0) ||
++        (options.max_tokens && *options.max_tokens <= 0)) {
++      return RespondNow(Error("maxChars and maxTokens must be positive"));
++    }
++    if (options.max_chars) {
++      max_chars = static_cast<size_t>(*options.max_chars);
++    }
++    if (options.max_tokens) {
++      size_t token_chars = static_cast<size_t>(*options.max_tokens) *
++                           BudgetedSink::kCharsPerToken;
++      max_chars = std::min(max_chars.value_or(token_chars), token_chars);
++    }
++    if (options.skip_boilerplate.value_or(false)) {
++      extraction_options_.boilerplate =
++          BoilerplateRegistry::GetForBrowserContext(browser_context());
++      extraction_options_.page_url = web_contents->GetLastCommittedURL();
++    }
++  }
++
++  // Serve an unchanged page from the cache
++  BrowserOSExtractionCache::CreateForWebContents(web_contents);
++  auto* cache = BrowserOSExtractionCache::FromWebContents(web_contents);
++  cache_variant_ = "page_content";
++  if (max_chars) {
++    cache_variant_ += ":" + base::NumberToString(*max_chars);
++  }
++  if (extraction_options_.boilerplate) {
++    cache_variant_ += ":bp";
++  }
++  // Which subtrees are boilerplate also depends on the other pages of the
++  // origin, so results are only reused at the same registry revision
++  std::string variant = cache_variant_;
++  if (extraction_options_.boilerplate) {
++    variant += ":" + base::NumberToString(
++                         extraction_options_.boilerplate->revision());
++  }
++  if (const BrowserOSExtractionCache::Entry* entry = cache->Get(variant)) {
++    browser_os::PageContent result;
++    result.items = entry->items;
++    result.timestamp = base::Time::Now().InMillisecondsFSinceUnixEpoch();
++    result.processing_time_ms = 0;
++    if (max_chars) {
++      result.truncated = entry->truncated;
++    }
++    if (extraction_options_.boilerplate) {
++      result.omitted_subtrees = static_cast<int>(entry->omitted_subtrees);
++    }
++    return RespondNow(
++        ArgumentList(browser_os::GetSnapshot::Results::Create(result)));
++  }
++  cache_key_ = cache->BeginExtraction();
++
++  extraction_job_ = std::make_unique<ContentExtractionJob>(web_contents);
 +  
 +  // Request accessibility tree snapshot
 +  web_contents->RequestAXTreeSnapshot(
@@ -1035,16 +1636,55 @@ index 0000000000000..84988d84caa41
 +    return;
 +  }
 +
-+  // Extract page content using the processor
-+  base::Time start_time = base::Time::Now();
-+  auto items = ContentProcessor::ExtractPageContent(tree_update);
++  // Extract page content off the UI thread
++  extraction_job_->Start(
++      std::move(tree_update), extraction_options_,
++      base::BindOnce(&BrowserOSGetSnapshotFunction::OnContentExtracted, this));
++}
++
++void BrowserOSGetSnapshotFunction::OnContentExtracted(
++    std::optional<ContentExtractionJob::Result> extraction) {
++  content::WebContents* web_contents = extraction_job_->web_contents();
++  extraction_job_.reset();
++  if (!has_callback()) {
++    return;
++  }
++  if (!extraction) {
++    Respond(Error("Tab navigated or closed during content extraction"));
++    return;
++  }
++
++  if (web_contents) {
++    BrowserOSExtractionCache::Entry entry;
++    entry.items = extraction->items;
++    entry.truncated = extraction->stats.truncated;
++    entry.omitted_subtrees = extraction->stats.omitted_subtrees;
++    std::string variant = cache_variant_;
++    if (extraction_options_.boilerplate) {
++      variant += ":" + base::NumberToString(
++                           extraction->stats.boilerplate_revision);
++    }
++    BrowserOSExtractionCache::FromWebContents(web_contents)
++        ->Put(cache_key_, variant, std::move(entry));
++  }
++
++  LOG(INFO) << "[browseros] getSnapshot queue_ms="
++            << extraction->queue_time.InMilliseconds()
++            << " work_ms=" << extraction->work_time.InMilliseconds();
 +
 +  // Build result
 +  browser_os::PageContent result;
-+  result.items = std::move(items);
++  result.items = std::move(extraction->items);
 +  result.timestamp = base::Time::Now().InMillisecondsFSinceUnixEpoch();
 +  result.processing_time_ms =
-+      (base::Time::Now() - start_time).InMilliseconds();
++      (extraction->queue_time + extraction->work_time).InMilliseconds();
++  if (extraction_options_.max_chars) {
++    result.truncated = extraction->stats.truncated;
++  }
++  if (extraction_options_.boilerplate) {
++    result.omitted_subtrees =
++        static_cast<int>(extraction->stats.omitted_subtrees);
++  }
 +
 +  Respond(ArgumentList(browser_os::GetSnapshot::Results::Create(result)));
 +}
@@ -1237,6 +1877,39 @@ index 0000000000000..84988d84caa41
 +      browser_os::ExecuteJavaScript::Results::Create(result)));
 +}
 +
++// BrowserOSGetInteractionTimeoutsFunction
++ExtensionFunction::ResponseAction
++BrowserOSGetInteractionTimeoutsFunction::Run() {
++  std::optional<browser_os::GetInteractionTimeouts::Params> params =
++      browser_os::GetInteractionTimeouts::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  std::optional<url::Origin> origin;
++  if (params->url) {
++    GURL url(*params->url);
++    if (!url.is_valid()) {
++      return RespondNow(Error("Invalid URL: " + *params->url));
++    }
++    origin = url::Origin::Create(url);
++  }
++
++  Profile* profile = Profile::FromBrowserContext(browser_context());
++  std::vector<browser_os::InteractionTimeout> timeouts;
++  for (const BrowserOSTimeoutModel::Entry& entry :
++       BrowserOSTimeoutModel::GetEntries(profile->GetPrefs(),
++                                         base::OptionalToPtr(origin))) {
++    browser_os::InteractionTimeout& timeout = timeouts.emplace_back();
++    timeout.origin = entry.origin;
++    timeout.interaction = BrowserOSTimeoutModel::KindName(entry.kind);
++    timeout.timeout_ms = static_cast<int>(entry.timeout.InMilliseconds());
++    timeout.samples = static_cast<int>(entry.samples);
++    timeout.learned = entry.learned;
++  }
++
++  return RespondNow(ArgumentList(
++      browser_os::GetInteractionTimeouts::Results::Create(timeouts)));
++}
++
 +// Implementation of BrowserOSClickCoordinatesFunction
 +ExtensionFunction::ResponseAction BrowserOSClickCoordinatesFunction::Run() {
 +  std::optional<browser_os::ClickCoordinates::Params> params =
@@ -1265,8 +1938,13 @@ index 0000000000000..84988d84caa41
 +            << params->x << ", " << params->y << ")";
 +  
 +  // Perform the click with change detection
-+  bool success = ClickCoordinatesWithDetection(web_contents, click_point);
-+  
++  ClickCoordinatesWithDetection(
++      web_contents, click_point,
++      base::BindOnce(&BrowserOSClickCoordinatesFunction::OnActionDone, this));
++  return RespondLater();
++}
++
++void BrowserOSClickCoordinatesFunction::OnActionDone(bool success) {
 +  // Prepare the response
 +  browser_os::InteractionResponse response;
 +  response.success = success;
@@ -1274,7 +1952,7 @@ index 0000000000000..84988d84caa41
 +  LOG(INFO) << "[browseros] ClickCoordinates: Result = " 
 +            << (success ? "success" : "no change detected");
 +  
-+  return RespondNow(ArgumentList(
++  Respond(ArgumentList(
 +      browser_os::ClickCoordinates::Results::Create(response)));
 +}
 +
@@ -1306,8 +1984,13 @@ index 0000000000000..84988d84caa41
 +            << params->x << ", " << params->y << ") and typing: " << params->text;
 +  
 +  // Perform the click and type operation
-+  bool success = TypeAtCoordinatesWithDetection(web_contents, click_point, params->text);
-+  
++  TypeAtCoordinatesWithDetection(
++      web_contents, click_point, params->text,
++      base::BindOnce(&BrowserOSTypeAtCoordinatesFunction::OnActionDone, this));
++  return RespondLater();
++}
++
++void BrowserOSTypeAtCoordinatesFunction::OnActionDone(bool success) {
 +  // Prepare the response
 +  browser_os::InteractionResponse response;
 +  response.success = success;
@@ -1315,7 +1998,7 @@ index 0000000000000..84988d84caa41
 +  LOG(INFO) << "[browseros] TypeAtCoordinates: Result = " 
 +            << (success ? "success" : "failed");
 +  
-+  return RespondNow(ArgumentList(
++  Respond(ArgumentList(
 +      browser_os::TypeAtCoordinates::Results::Create(response)));
 +}
 +
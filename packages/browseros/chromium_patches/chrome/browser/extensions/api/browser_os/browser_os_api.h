@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/extensions/api/browser_os/browser_os_api.h b/chrome/browser/extensions/api/browser_os/browser_os_api.h
 new file mode 100644
-index 0000000000000..e4b1c5f821342
+index 0000000000000..92ca193dd91bf
 --- /dev/null
 +++ b/chrome/browser/extensions/api/browser_os/browser_os_api.h
-@@ -0,0 +1,331 @@
+@@ -0,0 +1,503 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -12,11 +12,20 @@ index 0000000000000..e4b1c5f821342
 +#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_API_H_
 +
 +#include <cstdint>
++#include <memory>
++#include <optional>
++#include <string>
++#include <vector>
 +
 +#include "base/memory/raw_ptr.h"
++#include "base/memory/weak_ptr.h"
 +#include "base/values.h"
 +#include "chrome/browser/extensions/api/browser_os/browser_os_api_utils.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_ax_tree_projection.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_change_detector.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_content_extraction_job.h"
 +#include "chrome/browser/extensions/api/browser_os/browser_os_content_processor.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_extraction_cache.h"
 +#include "chrome/browser/extensions/api/browser_os/browser_os_snapshot_processor.h"
 +#include "extensions/browser/extension_function.h"
 +#include "third_party/skia/include/core/SkBitmap.h"
@@ -48,6 +57,13 @@ index 0000000000000..e4b1c5f821342
 +
 + private:
 +  void OnAccessibilityTreeReceived(ui::AXTreeUpdate& tree_update);
++
++  browser_os::AccessibilityTreeFormat format_ =
++      browser_os::AccessibilityTreeFormat::kDict;
++  AXTreeProjection projection_;
++  // Set for paginated requests
++  std::optional<size_t> page_size_;
++  base::WeakPtr<content::WebContents> web_contents_;
 +};
 +
 +class BrowserOSGetInteractiveSnapshotFunction : public ExtensionFunction {
@@ -67,17 +83,58 @@ index 0000000000000..e4b1c5f821342
 +  void OnAccessibilityTreeReceived(ui::AXTreeUpdate& tree_update);
 +  void OnSnapshotProcessed(SnapshotProcessingResult result);
 +  
-+  // Counter for snapshot IDs
-+  static uint32_t next_snapshot_id_;
++  // Sends |elements| to the calling extension as the next onSnapshotChunk.
++  void DispatchSnapshotChunk(bool done,
++                             std::vector<browser_os::InteractiveNode> elements);
++  
++  // ID of the snapshot being built
++  uint32_t snapshot_id_ = 0;
++  
++  // Whether elements are streamed through onSnapshotChunk
++  bool stream_ = false;
++  int chunk_sequence_ = 0;
 +  
 +  // Tab ID for storing mappings
 +  int tab_id_ = -1;
 +  
++  // Screens below the viewport to include, or nullopt for the whole page
++  std::optional<int> screens_ahead_;
++  
 +  // Web contents for processing and drawing
 +  raw_ptr<content::WebContents> web_contents_ = nullptr;
 +};
 +
-+class BrowserOSClickFunction : public ExtensionFunction {
++// Base of the node and key interactions. With InteractionOptions.waitForQuiet
++// it watches the tab from the action on, responds once the page has settled
++// and reports what changed.
++class BrowserOSInteractionFunction : public ExtensionFunction {
++ protected:
++  BrowserOSInteractionFunction();
++  ~BrowserOSInteractionFunction() override;
++
++  // Reads |options| and starts watching |web_contents| if asked. Call right
++  // before the action. Returns an error message for invalid options.
++  std::optional<std::string> BeginInteraction(
++      content::WebContents* web_contents,
++      const std::optional<browser_os::InteractionOptions>& options);
++
++  // ActionCallback of the action. Responds, after the page settled if
++  // asked.
++  void OnActionDone(bool change_detected);
++
++  // Wraps |response| as the results of this function.
++  virtual base::Value::List CreateResults(
++      const browser_os::InteractionResponse& response) = 0;
++
++ private:
++  void RespondWithChanges(bool change_detected, const ChangeSummary& summary);
++
++  BrowserOSQuiescenceWatcher::Options quiet_options_;
++  // Set while waitForQuiet watches the tab
++  std::unique_ptr<BrowserOSQuiescenceWatcher> watcher_;
++};
++
++class BrowserOSClickFunction : public BrowserOSInteractionFunction {
 + public:
 +  DECLARE_EXTENSION_FUNCTION("browserOS.click", BROWSER_OS_CLICK)
 +
@@ -88,9 +145,13 @@ index 0000000000000..e4b1c5f821342
 +
 +  // ExtensionFunction:
 +  ResponseAction Run() override;
++
++  // BrowserOSInteractionFunction:
++  base::Value::List CreateResults(
++      const browser_os::InteractionResponse& response) override;
 +};
 +
-+class BrowserOSInputTextFunction : public ExtensionFunction {
++class BrowserOSInputTextFunction : public BrowserOSInteractionFunction {
 + public:
 +  DECLARE_EXTENSION_FUNCTION("browserOS.inputText", BROWSER_OS_INPUTTEXT)
 +
@@ -101,9 +162,13 @@ index 0000000000000..e4b1c5f821342
 +
 +  // ExtensionFunction:
 +  ResponseAction Run() override;
++
++  // BrowserOSInteractionFunction:
++  base::Value::List CreateResults(
++      const browser_os::InteractionResponse& response) override;
 +};
 +
-+class BrowserOSClearFunction : public ExtensionFunction {
++class BrowserOSClearFunction : public BrowserOSInteractionFunction {
 + public:
 +  DECLARE_EXTENSION_FUNCTION("browserOS.clear", BROWSER_OS_CLEAR)
 +
@@ -114,6 +179,78 @@ index 0000000000000..e4b1c5f821342
 +
 +  // ExtensionFunction:
 +  ResponseAction Run() override;
++
++  // BrowserOSInteractionFunction:
++  base::Value::List CreateResults(
++      const browser_os::InteractionResponse& response) override;
++};
++
++// Runs a batch of node and key interactions in one call. Only steps that
++// ask for it wait for the page to change; the others go out as
++// accessibility actions right away. Optionally ends with an interactive
++// snapshot.
++class BrowserOSExecuteActionsFunction : public ExtensionFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.executeActions",
++                             BROWSER_OS_EXECUTEACTIONS)
++
++  BrowserOSExecuteActionsFunction();
++
++ protected:
++  ~BrowserOSExecuteActionsFunction() override;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++
++ private:
++  // A step checked up front, with its node resolved
++  struct Step {
++    Step();
++    ~Step();
++    Step(Step&&);
++    Step& operator=(Step&&);
++
++    browser_os::ActionType type = browser_os::ActionType::kNone;
++    // Unset for sendKeys
++    NodeInfo node;
++    // Text of inputText, key of sendKeys
++    std::string text;
++    bool wait_for_change = false;
++    // Set when the next step goes through the other input channel
++    bool wait_for_delivery = false;
++    bool wait_for_quiet = false;
++    BrowserOSQuiescenceWatcher::Options quiet_options;
++  };
++
++  void RunNextStep();
++  // Sends |step| without waiting for the page to react
++  void SendAction(content::WebContents* web_contents, const Step& step);
++  // Called once the page reacted to a step sent with wait_for_delivery, or
++  // its timeout passed
++  void OnStepDelivered(bool reacted);
++  // ActionCallback of a step that waits
++  void OnStepDone(bool changed);
++  void OnPageSettled(bool changed, const ChangeSummary& summary);
++  // Records the current step and moves on. |changed| is set for steps that
++  // waited, |summary| for those that waited for quiet.
++  void FinishStep(std::optional<bool> changed, const ChangeSummary* summary);
++  void Finish();
++  void OnAccessibilityTreeReceived(ui::AXTreeUpdate& tree_update);
++  void OnSnapshotProcessed(SnapshotProcessingResult result);
++
++  std::vector<Step> steps_;
++  size_t next_step_ = 0;
++  bool continue_on_no_change_ = false;
++  bool take_snapshot_ = false;
++  bool incremental_snapshot_ = true;
++  std::optional<int> screens_ahead_;
++
++  int tab_id_ = -1;
++  base::WeakPtr<content::WebContents> web_contents_;
++  // Set while a step waits for quiet
++  std::unique_ptr<BrowserOSQuiescenceWatcher> watcher_;
++  base::TimeTicks started_;
++  browser_os::ExecuteActionsResponse response_;
 +};
 +
 +class BrowserOSGetPageLoadStatusFunction : public ExtensionFunction {
@@ -169,7 +306,7 @@ index 0000000000000..e4b1c5f821342
 +  ResponseAction Run() override;
 +};
 +
-+class BrowserOSSendKeysFunction : public ExtensionFunction {
++class BrowserOSSendKeysFunction : public BrowserOSInteractionFunction {
 + public:
 +  DECLARE_EXTENSION_FUNCTION("browserOS.sendKeys", BROWSER_OS_SENDKEYS)
 +
@@ -180,6 +317,10 @@ index 0000000000000..e4b1c5f821342
 +
 +  // ExtensionFunction:
 +  ResponseAction Run() override;
++
++  // BrowserOSInteractionFunction:
++  base::Value::List CreateResults(
++      const browser_os::InteractionResponse& response) override;
 +};
 +
 +class BrowserOSCaptureScreenshotFunction : public ExtensionFunction {
@@ -214,13 +355,24 @@ index 0000000000000..e4b1c5f821342
 +  BrowserOSGetSnapshotFunction() = default;
 +
 + protected:
-+  ~BrowserOSGetSnapshotFunction() override = default;
++  ~BrowserOSGetSnapshotFunction() override;
 +
 +  // ExtensionFunction:
 +  ResponseAction Run() override;
 +
 + private:
 +  void OnAccessibilityTreeReceived(ui::AXTreeUpdate& tree_update);
++  void OnContentExtracted(
++      std::optional<ContentExtractionJob::Result> extraction);
++
++  // Watches the tab from Run() on and extracts off the UI thread.
++  std::unique_ptr<ContentExtractionJob> extraction_job_;
++  // Budget and boilerplate options from the caller
++  PageExtractionOptions extraction_options_;
++  // Where the result goes in BrowserOSExtractionCache. With boilerplate
++  // removal, the variant is completed by the registry revision.
++  BrowserOSExtractionCache::Key cache_key_;
++  std::string cache_variant_;
 +};
 +
 +// Settings API functions
@@ -305,6 +457,20 @@ index 0000000000000..e4b1c5f821342
 +  void OnJavaScriptExecuted(base::Value result);
 +};
 +
++class BrowserOSGetInteractionTimeoutsFunction : public ExtensionFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.getInteractionTimeouts",
++                             BROWSER_OS_GETINTERACTIONTIMEOUTS)
++
++  BrowserOSGetInteractionTimeoutsFunction() = default;
++
++ protected:
++  ~BrowserOSGetInteractionTimeoutsFunction() override = default;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++};
++
 +class BrowserOSClickCoordinatesFunction : public ExtensionFunction {
 + public:
 +  DECLARE_EXTENSION_FUNCTION("browserOS.clickCoordinates", BROWSER_OS_CLICKCOORDINATES)
@@ -316,6 +482,9 @@ index 0000000000000..e4b1c5f821342
 +
 +  // ExtensionFunction:
 +  ResponseAction Run() override;
++
++ private:
++  void OnActionDone(bool success);
 +};
 +
 +class BrowserOSTypeAtCoordinatesFunction : public ExtensionFunction {
@@ -329,6 +498,9 @@ index 0000000000000..e4b1c5f821342
 +
 +  // ExtensionFunction:
 +  ResponseAction Run() override;
++
++ private:
++  void OnActionDone(bool success);
 +};
 +
 +}  // namespace api
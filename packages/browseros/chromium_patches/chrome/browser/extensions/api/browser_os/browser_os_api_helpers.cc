@@ -1,19 +1,23 @@
 diff --git a/chrome/browser/extensions/api/browser_os/browser_os_api_helpers.cc b/chrome/browser/extensions/api/browser_os/browser_os_api_helpers.cc
 new file mode 100644
-index 0000000000000..f40a2424641e1
+index 0000000000000..e54fd99d66044
 --- /dev/null
 +++ b/chrome/browser/extensions/api/browser_os/browser_os_api_helpers.cc
-@@ -0,0 +1,1073 @@
+@@ -0,0 +1,1139 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
 +
 +#include "chrome/browser/extensions/api/browser_os/browser_os_api_helpers.h"
 +
++#include "base/functional/bind.h"
++#include "base/memory/weak_ptr.h"
++#include "base/strings/strcat.h"
 +#include "base/strings/string_number_conversions.h"
 +#include "base/strings/stringprintf.h"
 +#include "base/strings/utf_string_conversions.h"
 +#include "base/task/sequenced_task_runner.h"
++#include "base/time/time.h"
 +#include "chrome/browser/extensions/api/browser_os/browser_os_api_utils.h"
 +#include "chrome/browser/extensions/api/browser_os/browser_os_change_detector.h"
 +#include "components/input/native_web_keyboard_event.h"
@@ -37,6 +41,7 @@ index 0000000000000..f40a2424641e1
 +#include "ui/gfx/geometry/point_f.h"
 +#include "ui/gfx/range/range.h"
 +#include "ui/accessibility/ax_action_data.h"
++#include "ui/accessibility/ax_enum_util.h"
 +#include "ui/accessibility/ax_enums.mojom.h"
 +
 +namespace extensions {
@@ -141,10 +146,11 @@ index 0000000000000..f40a2424641e1
 +  std::u16string js_code = u"(function() {";
 +  
 +  // Try to find element by ID first
-+  auto id_it = node_info.attributes.find("id");
-+  if (id_it != node_info.attributes.end() && !id_it->second.empty()) {
++  std::string_view html_id =
++      node_info.attributes.Get(NodeAttributes::Key::kId);
++  if (!html_id.empty()) {
 +    js_code += u"  var element = document.getElementById('" + 
-+               base::UTF8ToUTF16(id_it->second) + u"');";
++               base::UTF8ToUTF16(html_id) + u"');";
 +    js_code += u"  if (element) {";
 +    js_code += u"    element.click();";
 +    js_code += u"    return 'clicked by id';";
@@ -152,13 +158,13 @@ index 0000000000000..f40a2424641e1
 +  }
 +  
 +  // Try to find by class and tag combination
-+  auto class_it = node_info.attributes.find("class");
-+  auto tag_it = node_info.attributes.find("html-tag");
++  std::string_view class_name =
++      node_info.attributes.Get(NodeAttributes::Key::kClass);
++  std::string_view html_tag = node_info.attributes.html_tag();
 +  
-+  if (class_it != node_info.attributes.end() && !class_it->second.empty() &&
-+      tag_it != node_info.attributes.end() && !tag_it->second.empty()) {
++  if (!class_name.empty() && !html_tag.empty()) {
 +    // Split class names and create selector
-+    std::string class_selector = "." + class_it->second;
++    std::string class_selector = base::StrCat({".", class_name});
 +    // Replace spaces with dots for multiple classes
 +    for (size_t i = 0; i < class_selector.length(); ++i) {
 +      if (class_selector[i] == ' ') {
@@ -167,7 +173,7 @@ index 0000000000000..f40a2424641e1
 +    }
 +    
 +    js_code += u"  var elements = document.querySelectorAll('" + 
-+               base::UTF8ToUTF16(tag_it->second + class_selector) + u"');";
++               base::UTF8ToUTF16(base::StrCat({html_tag, class_selector})) + u"');";
 +    js_code += u"  if (elements.length > 0) {";
 +    js_code += u"    elements[0].click();";
 +    js_code += u"    return 'clicked by class and tag';";
@@ -175,9 +181,9 @@ index 0000000000000..f40a2424641e1
 +  }
 +  
 +  // Fallback: try just by tag name if available
-+  if (tag_it != node_info.attributes.end() && !tag_it->second.empty()) {
++  if (!html_tag.empty()) {
 +    js_code += u"  var elements = document.getElementsByTagName('" + 
-+               base::UTF8ToUTF16(tag_it->second) + u"');";
++               base::UTF8ToUTF16(html_tag) + u"');";
 +    js_code += u"  if (elements.length > 0) {";
 +    js_code += u"    elements[0].click();";
 +    js_code += u"    return 'clicked by tag';";
@@ -205,10 +211,11 @@ index 0000000000000..f40a2424641e1
 +  std::u16string js_code = u"(function() {";
 +  
 +  // Try to find element by ID first
-+  auto id_it = node_info.attributes.find("id");
-+  if (id_it != node_info.attributes.end() && !id_it->second.empty()) {
++  std::string_view html_id =
++      node_info.attributes.Get(NodeAttributes::Key::kId);
++  if (!html_id.empty()) {
 +    js_code += u"  var element = document.getElementById('" + 
-+               base::UTF8ToUTF16(id_it->second) + u"');";
++               base::UTF8ToUTF16(html_id) + u"');";
 +    js_code += u"  if (element) {";
 +    js_code += u"    element.focus();";
 +    js_code += u"    if (element.select) element.select();";  // Select text if possible
@@ -217,13 +224,13 @@ index 0000000000000..f40a2424641e1
 +  }
 +  
 +  // Try to find by class and tag combination
-+  auto class_it = node_info.attributes.find("class");
-+  auto tag_it = node_info.attributes.find("html-tag");
++  std::string_view class_name =
++      node_info.attributes.Get(NodeAttributes::Key::kClass);
++  std::string_view html_tag = node_info.attributes.html_tag();
 +  
-+  if (class_it != node_info.attributes.end() && !class_it->second.empty() &&
-+      tag_it != node_info.attributes.end() && !tag_it->second.empty()) {
++  if (!class_name.empty() && !html_tag.empty()) {
 +    // Split class names and create selector
-+    std::string class_selector = "." + class_it->second;
++    std::string class_selector = base::StrCat({".", class_name});
 +    // Replace spaces with dots for multiple classes
 +    for (size_t i = 0; i < class_selector.length(); ++i) {
 +      if (class_selector[i] == ' ') {
@@ -232,7 +239,7 @@ index 0000000000000..f40a2424641e1
 +    }
 +    
 +    js_code += u"  var elements = document.querySelectorAll('" + 
-+               base::UTF8ToUTF16(tag_it->second + class_selector) + u"');";
++               base::UTF8ToUTF16(base::StrCat({html_tag, class_selector})) + u"');";
 +    js_code += u"  if (elements.length > 0) {";
 +    js_code += u"    elements[0].focus();";
 +    js_code += u"    if (elements[0].select) elements[0].select();";
@@ -241,9 +248,9 @@ index 0000000000000..f40a2424641e1
 +  }
 +  
 +  // Fallback: try just by tag name if available
-+  if (tag_it != node_info.attributes.end() && !tag_it->second.empty()) {
++  if (!html_tag.empty()) {
 +    js_code += u"  var elements = document.getElementsByTagName('" + 
-+               base::UTF8ToUTF16(tag_it->second) + u"');";
++               base::UTF8ToUTF16(html_tag) + u"');";
 +    js_code += u"  if (elements.length > 0) {";
 +    js_code += u"    elements[0].focus();";
 +    js_code += u"    if (elements[0].select) elements[0].select();";
@@ -494,10 +501,11 @@ index 0000000000000..f40a2424641e1
 +  }
 +  
 +  // Try to find element by ID first
-+  auto id_it = node_info.attributes.find("id");
-+  if (id_it != node_info.attributes.end() && !id_it->second.empty()) {
++  std::string_view html_id =
++      node_info.attributes.Get(NodeAttributes::Key::kId);
++  if (!html_id.empty()) {
 +    js_code += u"  var element = document.getElementById('" + 
-+               base::UTF8ToUTF16(id_it->second) + u"');";
++               base::UTF8ToUTF16(html_id) + u"');";
 +    js_code += u"  if (element) {";
 +    js_code += u"    element.value = '" + escaped_text + u"';";
 +    js_code += u"    element.dispatchEvent(new Event('input', {bubbles: true}));";
@@ -507,12 +515,12 @@ index 0000000000000..f40a2424641e1
 +  }
 +  
 +  // Try to find by class and tag combination
-+  auto class_it = node_info.attributes.find("class");
-+  auto tag_it = node_info.attributes.find("html-tag");
++  std::string_view class_name =
++      node_info.attributes.Get(NodeAttributes::Key::kClass);
++  std::string_view html_tag = node_info.attributes.html_tag();
 +  
-+  if (class_it != node_info.attributes.end() && !class_it->second.empty() &&
-+      tag_it != node_info.attributes.end() && !tag_it->second.empty()) {
-+    std::string class_selector = "." + class_it->second;
++  if (!class_name.empty() && !html_tag.empty()) {
++    std::string class_selector = base::StrCat({".", class_name});
 +    for (size_t i = 0; i < class_selector.length(); ++i) {
 +      if (class_selector[i] == ' ') {
 +        class_selector[i] = '.';
@@ -520,7 +528,7 @@ index 0000000000000..f40a2424641e1
 +    }
 +    
 +    js_code += u"  var elements = document.querySelectorAll('" + 
-+               base::UTF8ToUTF16(tag_it->second + class_selector) + u"');";
++               base::UTF8ToUTF16(base::StrCat({html_tag, class_selector})) + u"');";
 +    js_code += u"  if (elements.length > 0) {";
 +    js_code += u"    if (elements[0].value !== undefined) {";
 +    js_code += u"      elements[0].value = '" + escaped_text + u"';";
@@ -619,68 +627,110 @@ index 0000000000000..f40a2424641e1
 +  return true;
 +}
 +
++namespace {
++
++// Delays that let the page settle between steps. They are posted, never
++// slept, so the UI thread keeps running while a step waits.
++constexpr base::TimeDelta kScrollSettleDelay = base::Milliseconds(300);
++constexpr base::TimeDelta kFocusSettleDelay = base::Milliseconds(50);
++constexpr base::TimeDelta kCoordinateFocusDelay = base::Milliseconds(100);
++
++// One step of an action, continuing with the tab it acts on.
++using ActionStep =
++    base::OnceCallback<void(content::WebContents*, ActionCallback)>;
++
++// Runs |next| after |delay|, unless the tab closes first; then reports no
++// change instead.
++void PostStep(base::TimeDelta delay,
++              content::WebContents* web_contents,
++              ActionStep next,
++              ActionCallback callback) {
++  base::SequencedTaskRunner::GetCurrentDefault()->PostDelayedTask(
++      FROM_HERE,
++      base::BindOnce(
++          [](base::WeakPtr<content::WebContents> web_contents,
++             ActionStep next, ActionCallback callback) {
++            if (!web_contents) {
++              std::move(callback).Run(false);
++              return;
++            }
++            std::move(next).Run(web_contents.get(), std::move(callback));
++          },
++          web_contents->GetWeakPtr(), std::move(next), std::move(callback)),
++      delay);
++}
++
++// Runs |fallback| if the previous step changed nothing and the tab is still
++// open, else reports the result.
++void RunFallbackIfUnchanged(
++    base::WeakPtr<content::WebContents> web_contents,
++    ActionStep fallback,
++    ActionCallback callback,
++    bool changed) {
++  if (changed || !web_contents) {
++    std::move(callback).Run(changed);
++    return;
++  }
++  std::move(fallback).Run(web_contents.get(), std::move(callback));
++}
++
++// Logs the final result of an action for |label|.
++ActionCallback LogResult(std::string label, ActionCallback callback) {
++  return base::BindOnce(
++      [](const std::string& label, ActionCallback callback, bool changed) {
++        LOG(INFO) << "[browseros] " << label << " result: "
++                  << (changed ? "changed" : "no change");
++        std::move(callback).Run(changed);
++      },
++      std::move(label), std::move(callback));
++}
++
++// Fallback for clicks that changed nothing
++void HtmlClickWithDetection(const NodeInfo& node_info,
++                            content::WebContents* web_contents,
++                            ActionCallback callback) {
++  LOG(INFO) << "[browseros] No change from coordinate click, trying HTML click";
++  BrowserOSChangeDetector::ExecuteWithDetectionAsync(
++      web_contents, InteractionKind::kHtmlClick,
++      [&]() { HtmlClick(web_contents, node_info); },
++      std::move(callback));
++}
++
++// Clicks the node center, falling back to an HTML click
++void PointClickWithDetection(const NodeInfo& node_info,
++                             content::WebContents* web_contents,
++                             ActionCallback callback) {
++  gfx::PointF click_point = GetNodeCenterPoint(web_contents, node_info);
++  BrowserOSChangeDetector::ExecuteWithDetectionAsync(
++      web_contents, InteractionKind::kClick,
++      [&]() { PointClick(web_contents, click_point); },
++      base::BindOnce(&RunFallbackIfUnchanged, web_contents->GetWeakPtr(),
++                     base::BindOnce(&HtmlClickWithDetection, node_info),
++                     std::move(callback)));
++}
++
++}  // namespace
++
 +// Helper to perform a click with change detection and retrying
-+bool ClickWithDetection(content::WebContents* web_contents,
-+                        const NodeInfo& node_info) {
++void ClickWithDetection(content::WebContents* web_contents,
++                        const NodeInfo& node_info,
++                        ActionCallback callback) {
++  callback = LogResult("Click", std::move(callback));
++
 +  // Check if node is out of viewport and needs scrolling
-+  auto viewport_it = node_info.attributes.find("in_viewport");
-+  bool is_out_of_viewport = (viewport_it != node_info.attributes.end() && 
-+                              viewport_it->second == "false");
-+  
-+  if (is_out_of_viewport) {
++  if (!node_info.attributes.in_viewport) {
 +    LOG(INFO) << "[browseros] Node is out of viewport, scrolling to make visible";
 +    AccessibilityScrollToMakeVisible(web_contents, node_info, true /* center */);
-+    // Wait for scroll to complete
-+    base::PlatformThread::Sleep(base::Milliseconds(300));
-+    
-+    // For out-of-viewport nodes, use AccessibilityDoDefault first (most reliable after scroll)
-+    // LOG(INFO) << "[browseros] Node was out of viewport, trying AccessibilityDoDefault click first";
-+    // bool changed = BrowserOSChangeDetector::ExecuteWithDetection(
-+    //     web_contents,
-+    //     [&]() { AccessibilityDoDefault(web_contents, node_info); },
-+    //     base::Milliseconds(300));
-+    
-+    gfx::PointF click_point = GetNodeCenterPoint(web_contents, node_info);
-+    
-+    bool changed = BrowserOSChangeDetector::ExecuteWithDetection(
-+        web_contents,
-+        [&]() { PointClick(web_contents, click_point); },
-+        base::Milliseconds(300));
-+    
-+    if (!changed) {
-+      // Skip coordinate click for out-of-viewport nodes (coordinates unreliable)
-+      // Go straight to HTML click
-+      LOG(INFO) << "[browseros] No change from accessibility click, trying HTML click";
-+      changed = BrowserOSChangeDetector::ExecuteWithDetection(
-+          web_contents,
-+          [&]() { HtmlClick(web_contents, node_info); },
-+          base::Milliseconds(200));
-+    }
-+    
-+    LOG(INFO) << "[browseros] Click result: " << (changed ? "changed" : "no change");
-+    return changed;
++    // Click once the scroll has settled
++    PostStep(kScrollSettleDelay, web_contents,
++             base::BindOnce(&PointClickWithDetection, node_info),
++             std::move(callback));
++    return;
 +  }
 +  
 +  // For in-viewport nodes, try coordinate click first (most natural)
 +  LOG(INFO) << "[browseros] Node is in viewport, trying coordinate click first";
-+  gfx::PointF click_point = GetNodeCenterPoint(web_contents, node_info);
-+  
-+  bool changed = BrowserOSChangeDetector::ExecuteWithDetection(
-+      web_contents,
-+      [&]() { PointClick(web_contents, click_point); },
-+      base::Milliseconds(300));
-+  
-+  // If still no change, try HTML click as final fallback
-+  if (!changed) {
-+      LOG(INFO) << "[browseros] No change from accessibility click, trying HTML click";
-+      changed = BrowserOSChangeDetector::ExecuteWithDetection(
-+          web_contents,
-+          [&]() { HtmlClick(web_contents, node_info); },
-+          base::Milliseconds(200));
-+  }
-+  
-+  LOG(INFO) << "[browseros] Click result: " << (changed ? "changed" : "no change");
-+  return changed;
++  PointClickWithDetection(node_info, web_contents, std::move(callback));
 +}
 +
 +// Helper to perform accessibility action: SetValue
@@ -706,67 +756,75 @@ index 0000000000000..f40a2424641e1
 +  return true;
 +}
 +
++namespace {
++
++// Fallback for native typing that changed nothing
++void JavaScriptTypeWithDetection(const NodeInfo& node_info,
++                                 const std::string& text,
++                                 content::WebContents* web_contents,
++                                 ActionCallback callback) {
++  LOG(INFO) << "[browseros] No change from native typing, trying JavaScript";
++  BrowserOSChangeDetector::ExecuteWithDetectionAsync(
++      web_contents, InteractionKind::kJavaScriptType,
++      [&]() { JavaScriptType(web_contents, node_info, text); },
++      std::move(callback));
++}
++
++// Types natively into the focused element, falling back to JavaScript
++void NativeTypeWithDetection(const NodeInfo& node_info,
++                             const std::string& text,
++                             content::WebContents* web_contents,
++                             ActionCallback callback) {
++  LOG(INFO) << "[browseros] Trying native typing";
++  BrowserOSChangeDetector::ExecuteWithDetectionAsync(
++      web_contents, InteractionKind::kType,
++      [&]() { NativeType(web_contents, text); },
++      base::BindOnce(&RunFallbackIfUnchanged, web_contents->GetWeakPtr(),
++                     base::BindOnce(&JavaScriptTypeWithDetection, node_info,
++                                    text),
++                     std::move(callback)));
++}
++
++// Focuses the node, then types once focus has settled
++void FocusAndType(const NodeInfo& node_info,
++                  const std::string& text,
++                  content::WebContents* web_contents,
++                  ActionCallback callback) {
++  LOG(INFO) << "[browseros] Focusing element for typing";
++  AccessibilityFocus(web_contents, node_info);
++  PostStep(kFocusSettleDelay, web_contents,
++           base::BindOnce(&NativeTypeWithDetection, node_info, text),
++           std::move(callback));
++}
++
++}  // namespace
++
 +// Helper to perform typing with change detection
-+bool TypeWithDetection(content::WebContents* web_contents,
-+                      const NodeInfo& node_info,
-+                      const std::string& text) {
++void TypeWithDetection(content::WebContents* web_contents,
++                       const NodeInfo& node_info,
++                       const std::string& text,
++                       ActionCallback callback) {
++  callback = LogResult("Type", std::move(callback));
++
 +  // Check if node is out of viewport and needs scrolling
-+  auto viewport_it = node_info.attributes.find("in_viewport");
-+  bool is_out_of_viewport = (viewport_it != node_info.attributes.end() && 
-+                              viewport_it->second == "false");
-+  
-+  if (is_out_of_viewport) {
++  if (!node_info.attributes.in_viewport) {
 +    LOG(INFO) << "[browseros] Node is out of viewport for typing, scrolling to make visible";
 +    AccessibilityScrollToMakeVisible(web_contents, node_info, true /* center */);
-+    // Wait for scroll to complete
-+    base::PlatformThread::Sleep(base::Milliseconds(300));
-+  }
-+  
-+  // First ensure the element is focused using accessibility
-+  LOG(INFO) << "[browseros] Focusing element for typing";
-+  AccessibilityFocus(web_contents, node_info);
-+  // Small delay to ensure focus is set
-+  base::PlatformThread::Sleep(base::Milliseconds(50));
-+  
-+  // Try native typing first (most natural method)
-+  LOG(INFO) << "[browseros] Trying native typing";
-+  bool changed = BrowserOSChangeDetector::ExecuteWithDetection(
-+      web_contents,
-+      [&]() {
-+        NativeType(web_contents, text);
-+      },
-+      base::Milliseconds(300));
-+  
-+  // If no change detected, try JavaScript typing as second fallback
-+  if (!changed) {
-+    LOG(INFO) << "[browseros] No change from native typing, trying JavaScript";
-+    changed = BrowserOSChangeDetector::ExecuteWithDetection(
-+        web_contents,
-+        [&]() { JavaScriptType(web_contents, node_info, text); },
-+        base::Milliseconds(200));
++    PostStep(kScrollSettleDelay, web_contents,
++             base::BindOnce(&FocusAndType, node_info, text),
++             std::move(callback));
++    return;
 +  }
-+  
-+  // If still no change, try accessibility SetValue as final fallback
-+  // if (!changed) {
-+  //   LOG(INFO) << "[browseros] No change from JavaScript, trying accessibility SetValue";
-+  //   changed = BrowserOSChangeDetector::ExecuteWithDetection(
-+  //       web_contents,
-+  //       [&]() {
-+  //         AccessibilitySetValue(web_contents, node_info, text);
-+  //       },
-+  //       base::Milliseconds(300));
-+  // }
-+  
-+  LOG(INFO) << "[browseros] Type result: " << (changed ? "changed" : "no change");
-+  return changed;
++  FocusAndType(node_info, text, web_contents, std::move(callback));
 +}
 +
 +// Helper to clear an input field with change detection
-+bool ClearWithDetection(content::WebContents* web_contents,
-+                       const NodeInfo& node_info) {
++void ClearWithDetection(content::WebContents* web_contents,
++                        const NodeInfo& node_info,
++                        ActionCallback callback) {
 +  // Use change detection with JavaScript clear
-+  bool changed = BrowserOSChangeDetector::ExecuteWithDetection(
-+      web_contents,
++  BrowserOSChangeDetector::ExecuteWithDetectionAsync(
++      web_contents, InteractionKind::kClear,
 +      [&]() {
 +        content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
 +        if (!rfh) return;
@@ -792,24 +850,18 @@ index 0000000000000..f40a2424641e1
 +            base::NullCallback(),
 +            /*honor_js_content_settings=*/false);
 +      },
-+      base::Milliseconds(200));
-+  
-+  LOG(INFO) << "[browseros] Clear result: " << (changed ? "changed" : "no change");
-+  return changed;
++      LogResult("Clear", std::move(callback)));
 +}
 +
 +// Helper to send a key press with change detection
-+bool KeyPressWithDetection(content::WebContents* web_contents,
-+                          const std::string& key) {
++void KeyPressWithDetection(content::WebContents* web_contents,
++                           const std::string& key,
++                           ActionCallback callback) {
 +  // Use change detection with key press
-+  bool changed = BrowserOSChangeDetector::ExecuteWithDetection(
-+      web_contents,
++  BrowserOSChangeDetector::ExecuteWithDetectionAsync(
++      web_contents, InteractionKind::kKeyPress,
 +      [&]() { KeyPress(web_contents, key); },
-+      base::Milliseconds(200));
-+  
-+  LOG(INFO) << "[browseros] KeyPress result for '" << key << "': " 
-+            << (changed ? "changed" : "no change");
-+  return changed;
++      LogResult("KeyPress", std::move(callback)));
 +}
 +
 +// Helper to show highlights for clickable, typeable, and selectable elements that are in viewport
@@ -897,7 +949,7 @@ index 0000000000000..f40a2424641e1
 +        node_info.bounds.y(),
 +        node_info.bounds.width(),
 +        node_info.bounds.height(),
-+        node_info.attributes.count("role") ? node_info.attributes.at("role").c_str() : "unknown"
++        ui::ToString(node_info.attributes.role)
 +    );
 +  }
 +  
@@ -993,86 +1045,100 @@ index 0000000000000..f40a2424641e1
 +}
 +
 +// Helper to click at specific coordinates with change detection
-+bool ClickCoordinatesWithDetection(content::WebContents* web_contents,
-+                                   const gfx::PointF& point) {
++void ClickCoordinatesWithDetection(content::WebContents* web_contents,
++                                   const gfx::PointF& point,
++                                   ActionCallback callback) {
 +  LOG(INFO) << "[browseros] ClickCoordinatesWithDetection at (" 
 +            << point.x() << ", " << point.y() << ")";
 +  
 +  // Perform coordinate click with change detection
-+  bool changed = BrowserOSChangeDetector::ExecuteWithDetection(
-+      web_contents,
++  BrowserOSChangeDetector::ExecuteWithDetectionAsync(
++      web_contents, InteractionKind::kClick,
 +      [&]() { 
 +        PointClick(web_contents, point);
 +      },
-+      base::Milliseconds(300));
-+  
-+  LOG(INFO) << "[browseros] Click coordinates result: " 
-+            << (changed ? "changed" : "no change");
-+  return changed;
++      LogResult("Click coordinates", std::move(callback)));
 +}
 +
-+// Helper to type text after clicking at coordinates to focus element
-+bool TypeAtCoordinatesWithDetection(content::WebContents* web_contents,
-+                                    const gfx::PointF& point,
-+                                    const std::string& text) {
-+  LOG(INFO) << "[browseros] TypeAtCoordinatesWithDetection at (" 
-+            << point.x() << ", " << point.y() << ") with text: " << text;
-+  
-+  // First click at the coordinates to focus the element
-+  PointClick(web_contents, point);
++namespace {
++
++// Sets the value of the focused element with JavaScript and assumes it
++// took, since focus is all it needs
++void JavaScriptTypeIntoFocused(const std::string& text,
++                               content::WebContents* web_contents,
++                               ActionCallback callback) {
++  LOG(INFO) << "[browseros] No change from native typing at coordinates, trying JS injection";
++
++  // Execute JavaScript to find the focused element and set its value
++  content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
++  if (!rfh) {
++    std::move(callback).Run(false);
++    return;
++  }
++  std::string js_code = base::StringPrintf(R"(
++    (function() {
++      var focused = document.activeElement;
++      if (focused && (focused.tagName === 'INPUT' || 
++                     focused.tagName === 'TEXTAREA' || 
++                     focused.contentEditable === 'true')) {
++        if (focused.contentEditable === 'true') {
++          focused.textContent = '%s';
++        } else {
++          focused.value = '%s';
++        }
++        // Trigger input event
++        focused.dispatchEvent(new Event('input', { bubbles: true }));
++        focused.dispatchEvent(new Event('change', { bubbles: true }));
++        return true;
++      }
++      return false;
++    })();
++  )", text.c_str(), text.c_str());
 +  
-+  // Wait a moment for focus to be established
-+  base::PlatformThread::Sleep(base::Milliseconds(100));
++  rfh->ExecuteJavaScriptForTests(
++      base::UTF8ToUTF16(js_code),
++      base::NullCallback(),
++      false);
 +  
++  // Give it a moment to register
++  PostStep(kFocusSettleDelay, web_contents,
++           base::BindOnce([](content::WebContents* web_contents,
++                             ActionCallback callback) {
++             std::move(callback).Run(true);
++           }),
++           std::move(callback));
++}
++
++void TypeIntoFocused(const std::string& text,
++                     content::WebContents* web_contents,
++                     ActionCallback callback) {
 +  // Now type the text with change detection
-+  bool changed = BrowserOSChangeDetector::ExecuteWithDetection(
-+      web_contents,
++  BrowserOSChangeDetector::ExecuteWithDetectionAsync(
++      web_contents, InteractionKind::kType,
 +      [&]() { 
 +        NativeType(web_contents, text);
 +      },
-+      base::Milliseconds(300));
-+  
-+  // If native typing didn't work, try JavaScript injection to detect and type
-+  if (!changed) {
-+    LOG(INFO) << "[browseros] No change from native typing at coordinates, trying JS injection";
-+    
-+    // Execute JavaScript to find the focused element and set its value
-+    content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
-+    if (rfh) {
-+      std::string js_code = base::StringPrintf(R"(
-+        (function() {
-+          var focused = document.activeElement;
-+          if (focused && (focused.tagName === 'INPUT' || 
-+                         focused.tagName === 'TEXTAREA' || 
-+                         focused.contentEditable === 'true')) {
-+            if (focused.contentEditable === 'true') {
-+              focused.textContent = '%s';
-+            } else {
-+              focused.value = '%s';
-+            }
-+            // Trigger input event
-+            focused.dispatchEvent(new Event('input', { bubbles: true }));
-+            focused.dispatchEvent(new Event('change', { bubbles: true }));
-+            return true;
-+          }
-+          return false;
-+        })();
-+      )", text.c_str(), text.c_str());
-+      
-+      rfh->ExecuteJavaScriptForTests(
-+          base::UTF8ToUTF16(js_code),
-+          base::NullCallback(),
-+          false);
-+      
-+      // Give it a moment to register
-+      base::PlatformThread::Sleep(base::Milliseconds(50));
-+      changed = true; // Assume success if we reached here
-+    }
-+  }
++      base::BindOnce(&RunFallbackIfUnchanged, web_contents->GetWeakPtr(),
++                     base::BindOnce(&JavaScriptTypeIntoFocused, text),
++                     std::move(callback)));
++}
++
++}  // namespace
++
++// Helper to type text after clicking at coordinates to focus element
++void TypeAtCoordinatesWithDetection(content::WebContents* web_contents,
++                                    const gfx::PointF& point,
++                                    const std::string& text,
++                                    ActionCallback callback) {
++  LOG(INFO) << "[browseros] TypeAtCoordinatesWithDetection at (" 
++            << point.x() << ", " << point.y() << ") with text: " << text;
 +  
-+  LOG(INFO) << "[browseros] Type at coordinates result: " 
-+            << (changed ? "success" : "failed");
-+  return changed;
++  // First click at the coordinates to focus the element, and type once
++  // focus is established
++  PointClick(web_contents, point);
++  PostStep(kCoordinateFocusDelay, web_contents,
++           base::BindOnce(&TypeIntoFocused, text),
++           LogResult("Type at coordinates", std::move(callback)));
 +}
 +
 +}  // namespace api
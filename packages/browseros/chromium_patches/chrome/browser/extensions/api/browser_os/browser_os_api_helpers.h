@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/extensions/api/browser_os/browser_os_api_helpers.h b/chrome/browser/extensions/api/browser_os/browser_os_api_helpers.h
 new file mode 100644
-index 0000000000000..2000fa3235290
+index 0000000000000..7ece7a12ea919
 --- /dev/null
 +++ b/chrome/browser/extensions/api/browser_os/browser_os_api_helpers.h
-@@ -0,0 +1,137 @@
+@@ -0,0 +1,143 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -95,26 +95,31 @@ index 0000000000000..2000fa3235290
 +                    const NodeInfo& node_info,
 +                    const std::string& text);
 +
++// Action helpers below never block the UI thread. Each step is a posted
++// continuation, and |callback| gets whether the action caused a change in
++// the page. It runs asynchronously, false if the tab closed meanwhile.
++using ActionCallback = base::OnceCallback<void(bool)>;
++
 +// Helper to perform a click with change detection and retrying
-+// Returns true if the click caused a change in the page
-+bool ClickWithDetection(content::WebContents* web_contents,
-+                        const NodeInfo& node_info);
++void ClickWithDetection(content::WebContents* web_contents,
++                        const NodeInfo& node_info,
++                        ActionCallback callback);
 +
 +// Helper to perform typing with change detection
-+// Returns true if the typing caused a change in the page
-+bool TypeWithDetection(content::WebContents* web_contents,
-+                      const NodeInfo& node_info,
-+                      const std::string& text);
++void TypeWithDetection(content::WebContents* web_contents,
++                       const NodeInfo& node_info,
++                       const std::string& text,
++                       ActionCallback callback);
 +
 +// Helper to clear an input field with change detection
-+// Returns true if the clear caused a change in the page
-+bool ClearWithDetection(content::WebContents* web_contents,
-+                       const NodeInfo& node_info);
++void ClearWithDetection(content::WebContents* web_contents,
++                        const NodeInfo& node_info,
++                        ActionCallback callback);
 +
 +// Helper to send a key press with change detection
-+// Returns true if the key press caused a change in the page
-+bool KeyPressWithDetection(content::WebContents* web_contents,
-+                          const std::string& key);
++void KeyPressWithDetection(content::WebContents* web_contents,
++                           const std::string& key,
++                           ActionCallback callback);
 +
 +// Helper to show highlights for clickable, typeable, and selectable elements that are in viewport
 +// Only highlights elements that are actually visible and interactable
@@ -126,16 +131,17 @@ index 0000000000000..2000fa3235290
 +void RemoveHighlights(content::WebContents* web_contents);
 +
 +// Helper to click at specific coordinates with change detection
-+// Returns true if the click caused a detectable change in the page
-+bool ClickCoordinatesWithDetection(content::WebContents* web_contents,
-+                                   const gfx::PointF& point);
++void ClickCoordinatesWithDetection(content::WebContents* web_contents,
++                                   const gfx::PointF& point,
++                                   ActionCallback callback);
 +
 +// Helper to type text after clicking at coordinates to focus element
 +// First clicks at the coordinates to focus an element, then types the text
-+// Returns true if the operation succeeded
-+bool TypeAtCoordinatesWithDetection(content::WebContents* web_contents,
++// Reports true if the operation succeeded
++void TypeAtCoordinatesWithDetection(content::WebContents* web_contents,
 +                                    const gfx::PointF& point,
-+                                    const std::string& text);
++                                    const std::string& text,
++                                    ActionCallback callback);
 +
 +}  // namespace api
 +}  // namespace extensions
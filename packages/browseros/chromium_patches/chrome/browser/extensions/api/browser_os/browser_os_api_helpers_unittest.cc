@@ -0,0 +1,229 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_api_helpers_unittest.cc b/chrome/browser/extensions/api/browser_os/browser_os_api_helpers_unittest.cc
+new file mode 100644
+index 0000000000000..841e2d3447002
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_api_helpers_unittest.cc
+@@ -0,0 +1,223 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_api_helpers.h"
++
++#include <optional>
++#include <vector>
++
++#include "base/functional/bind.h"
++#include "base/functional/callback.h"
++#include "base/functional/function_ref.h"
++#include "base/run_loop.h"
++#include "base/task/sequenced_task_runner.h"
++#include "base/test/task_environment.h"
++#include "base/time/time.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_api_utils.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_timeout_model.h"
++#include "chrome/test/base/chrome_render_view_host_test_harness.h"
++#include "chrome/test/base/testing_profile.h"
++#include "components/prefs/pref_service.h"
++#include "content/public/browser/web_contents.h"
++#include "testing/gtest/include/gtest/gtest.h"
++#include "ui/gfx/geometry/point_f.h"
++#include "ui/gfx/geometry/rect_f.h"
++#include "url/gurl.h"
++#include "url/origin.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++// Long enough for any action to time out through all of its fallbacks
++constexpr base::TimeDelta kAllActionsDone =
++    3 * BrowserOSTimeoutModel::kMaxTimeout;
++
++// Counts run loops started while another one is running on the thread
++class NestedRunLoopCounter : public base::RunLoop::NestingObserver {
++ public:
++  NestedRunLoopCounter() {
++    base::RunLoop::AddNestingObserverOnCurrentThread(this);
++  }
++  ~NestedRunLoopCounter() override {
++    base::RunLoop::RemoveNestingObserverOnCurrentThread(this);
++  }
++
++  void OnBeginNestedRunLoop() override { ++count_; }
++
++  int count() const { return count_; }
++
++ private:
++  int count_ = 0;
++};
++
++// The result an action reported, and how often it reported one
++struct ActionResult {
++  int runs = 0;
++  std::optional<bool> changed;
++
++  ActionCallback Callback() {
++    return base::BindOnce(
++        [](ActionResult* result, bool changed) {
++          ++result->runs;
++          result->changed = changed;
++        },
++        base::Unretained(this));
++  }
++};
++
++// Only the change tracker observes the page; with no renderer nothing
++// changes unless a test navigates
++class BrowserOSActionHelpersTest : public ChromeRenderViewHostTestHarness {
++ protected:
++  BrowserOSActionHelpersTest()
++      : ChromeRenderViewHostTestHarness(
++            base::test::TaskEnvironment::TimeSource::MOCK_TIME) {}
++
++  void SetUp() override {
++    ChromeRenderViewHostTestHarness::SetUp();
++    NavigateAndCommit(GURL("https://example.com/"));
++  }
++
++  NodeInfo Node(bool in_viewport) {
++    NodeInfo node;
++    node.ax_node_id = 7;
++    node.bounds = gfx::RectF(10, 20, 100, 30);
++    node.attributes.SetHtmlTag("input");
++    node.attributes.in_viewport = in_viewport;
++    return node;
++  }
++
++  // Starts |action| where running a run loop would fail, so the helper has
++  // to return without waiting for anything
++  void StartAction(base::FunctionRef<void()> action) {
++    base::RunLoop::ScopedDisallowRunning disallow_running;
++    action();
++  }
++
++  NestedRunLoopCounter nested_run_loops_;
++};
++
++TEST_F(BrowserOSActionHelpersTest, EveryActionRunsAsPostedSteps) {
++  std::vector<ActionResult> results(8);
++  content::WebContents* contents = web_contents();
++  StartAction([&] {
++    ClickWithDetection(contents, Node(/*in_viewport=*/true),
++                       results[0].Callback());
++  });
++  StartAction([&] {
++    ClickWithDetection(contents, Node(/*in_viewport=*/false),
++                       results[1].Callback());
++  });
++  StartAction([&] {
++    TypeWithDetection(contents, Node(/*in_viewport=*/true), "hello",
++                      results[2].Callback());
++  });
++  StartAction([&] {
++    TypeWithDetection(contents, Node(/*in_viewport=*/false), "hello",
++                      results[3].Callback());
++  });
++  StartAction([&] {
++    ClearWithDetection(contents, Node(/*in_viewport=*/true),
++                       results[4].Callback());
++  });
++  StartAction([&] {
++    KeyPressWithDetection(contents, "Enter", results[5].Callback());
++  });
++  StartAction([&] {
++    ClickCoordinatesWithDetection(contents, gfx::PointF(40, 30),
++                                  results[6].Callback());
++  });
++  StartAction([&] {
++    TypeAtCoordinatesWithDetection(contents, gfx::PointF(40, 30), "hello",
++                                   results[7].Callback());
++  });
++
++  // Nothing is reported from inside the call
++  for (const ActionResult& result : results) {
++    EXPECT_EQ(0, result.runs);
++  }
++
++  task_environment()->FastForwardBy(kAllActionsDone);
++  for (size_t i = 0; i < results.size(); ++i) {
++    SCOPED_TRACE(i);
++    EXPECT_EQ(1, results[i].runs);
++  }
++  // The JavaScript fallback after typing at coordinates assumes success
++  EXPECT_EQ(true, results[7].changed);
++  for (size_t i = 0; i < 7; ++i) {
++    EXPECT_EQ(false, results[i].changed) << i;
++  }
++  EXPECT_EQ(0, nested_run_loops_.count());
++}
++
++// Detection waits on a timer; the thread keeps running tasks meanwhile
++TEST_F(BrowserOSActionHelpersTest, KeyPressTimesOutOnTimer) {
++  base::TimeDelta timeout =
++      BrowserOSTimeoutModel::DefaultTimeout(InteractionKind::kKeyPress);
++  ActionResult result;
++  StartAction([&] {
++    KeyPressWithDetection(web_contents(), "Enter", result.Callback());
++  });
++
++  bool other_task_ran = false;
++  base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
++      FROM_HERE, base::BindOnce([](bool* ran) { *ran = true; },
++                                base::Unretained(&other_task_ran)));
++  task_environment()->FastForwardBy(timeout - base::Milliseconds(1));
++  EXPECT_TRUE(other_task_ran);
++  EXPECT_EQ(0, result.runs);
++
++  task_environment()->FastForwardBy(base::Milliseconds(1));
++  EXPECT_EQ(1, result.runs);
++  EXPECT_EQ(false, result.changed);
++  EXPECT_EQ(0, nested_run_loops_.count());
++}
++
++TEST_F(BrowserOSActionHelpersTest, ChangeResolvesEarlyAndIsLearned) {
++  url::Origin origin = url::Origin::Create(GURL("https://example.com/"));
++  ActionResult result;
++  StartAction([&] {
++    KeyPressWithDetection(web_contents(), "Enter", result.Callback());
++  });
++
++  task_environment()->FastForwardBy(base::Milliseconds(20));
++  NavigateAndCommit(GURL("https://example.com/next"));
++  task_environment()->RunUntilIdle();
++  EXPECT_EQ(1, result.runs);
++  EXPECT_EQ(true, result.changed);
++  EXPECT_EQ(0, nested_run_loops_.count());
++
++  PrefService* prefs = profile()->GetPrefs();
++  bool learned = false;
++  for (const BrowserOSTimeoutModel::Entry& entry :
++       BrowserOSTimeoutModel::GetEntries(prefs, &origin)) {
++    if (entry.kind == InteractionKind::kKeyPress) {
++      EXPECT_EQ(1u, entry.samples);
++      learned = true;
++    }
++  }
++  EXPECT_TRUE(learned);
++}
++
++TEST_F(BrowserOSActionHelpersTest, TabClosedBetweenSteps) {
++  // Off-screen nodes scroll first and click in a later step
++  ActionResult result;
++  StartAction([&] {
++    ClickWithDetection(web_contents(), Node(/*in_viewport=*/false),
++                       result.Callback());
++  });
++  DeleteContents();
++
++  task_environment()->FastForwardBy(kAllActionsDone);
++  EXPECT_EQ(1, result.runs);
++  EXPECT_EQ(false, result.changed);
++  EXPECT_EQ(0, nested_run_loops_.count());
++}
++
++}  // namespace
++
++}  // namespace api
++}  // namespace extensions
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/extensions/api/browser_os/browser_os_api_utils.cc b/chrome/browser/extensions/api/browser_os/browser_os_api_utils.cc
 new file mode 100644
-index 0000000000000..0c3a060fc70de
+index 0000000000000..b00cd43196fd2
 --- /dev/null
 +++ b/chrome/browser/extensions/api/browser_os/browser_os_api_utils.cc
-@@ -0,0 +1,167 @@
+@@ -0,0 +1,318 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -14,12 +14,14 @@ index 0000000000000..0c3a060fc70de
 +#include "base/no_destructor.h"
 +#include "base/strings/string_number_conversions.h"
 +#include "base/strings/utf_string_conversions.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_ax_tree_projection.h"
 +#include "chrome/browser/extensions/extension_tab_util.h"
 +#include "chrome/browser/extensions/window_controller.h"
 +#include "chrome/browser/ui/browser.h"
 +#include "chrome/browser/ui/browser_finder.h"
 +#include "chrome/browser/ui/tabs/tab_strip_model.h"
 +#include "content/public/browser/web_contents.h"
++#include "ui/accessibility/ax_enum_util.h"
 +#include "ui/accessibility/ax_role_properties.h"
 +
 +namespace extensions {
@@ -169,5 +171,154 @@ index 0000000000000..0c3a060fc70de
 +  }
 +}
 +
++base::Value::Dict SerializeAXNodeData(const ui::AXNodeData& node,
++                                      const AXTreeProjection& projection,
++                                      const std::vector<int32_t>& child_ids) {
++  base::Value::Dict dict;
++
++  // Core identity
++  dict.Set("id", node.id);
++  dict.Set("role", ui::ToString(node.role));
++
++  // Hierarchy
++  if (!child_ids.empty()) {
++    base::Value::List children;
++    for (int32_t child_id : child_ids) {
++      children.Append(child_id);
++    }
++    dict.Set("childIds", std::move(children));
++  }
++
++  // State bitfield converted to string array
++  base::Value::List states;
++  if (projection.Includes(AXTreeProjection::kStates) && node.state) {
++    for (int i = static_cast<int>(ax::mojom::State::kMinValue);
++         i <= static_cast<int>(ax::mojom::State::kMaxValue); ++i) {
++      auto state = static_cast<ax::mojom::State>(i);
++      if (node.HasState(state)) {
++        states.Append(ui::ToString(state));
++      }
++    }
++  }
++  if (!states.empty()) {
++    dict.Set("states", std::move(states));
++  }
++
++  // Actions bitfield converted to string array
++  base::Value::List actions;
++  if (projection.Includes(AXTreeProjection::kActions) && node.actions) {
++    for (int i = static_cast<int>(ax::mojom::Action::kMinValue);
++         i <= static_cast<int>(ax::mojom::Action::kMaxValue); ++i) {
++      auto action = static_cast<ax::mojom::Action>(i);
++      if (node.HasAction(action)) {
++        actions.Append(ui::ToString(action));
++      }
++    }
++  }
++  if (!actions.empty()) {
++    dict.Set("actions", std::move(actions));
++  }
++
++  // Bounds relative to the offset container
++  if (projection.Includes(AXTreeProjection::kBounds)) {
++    const gfx::RectF& rect = node.relative_bounds.bounds;
++    base::Value::Dict bounds;
++    bounds.Set("x", rect.x());
++    bounds.Set("y", rect.y());
++    bounds.Set("width", rect.width());
++    bounds.Set("height", rect.height());
++    if (node.relative_bounds.offset_container_id >= 0) {
++      bounds.Set("offsetContainerId", node.relative_bounds.offset_container_id);
++    }
++    dict.Set("relativeBounds", std::move(bounds));
++  }
++
++  // String attributes map with enum keys converted to strings
++  if (projection.Includes(AXTreeProjection::kStringAttributes) &&
++      node.string_attributes.size() > 0) {
++    base::Value::Dict attrs;
++    for (const auto& [key, value] : node.string_attributes) {
++      attrs.Set(ui::ToString(key), value);
++    }
++    dict.Set("stringAttributes", std::move(attrs));
++  } else if (projection.Includes(AXTreeProjection::kName) &&
++             node.HasStringAttribute(ax::mojom::StringAttribute::kName)) {
++    base::Value::Dict attrs;
++    attrs.Set(ui::ToString(ax::mojom::StringAttribute::kName),
++              node.GetStringAttribute(ax::mojom::StringAttribute::kName));
++    dict.Set("stringAttributes", std::move(attrs));
++  }
++
++  // Int attributes map
++  if (projection.Includes(AXTreeProjection::kIntAttributes) &&
++      node.int_attributes.size() > 0) {
++    base::Value::Dict attrs;
++    for (const auto& [key, value] : node.int_attributes) {
++      attrs.Set(ui::ToString(key), value);
++    }
++    dict.Set("intAttributes", std::move(attrs));
++  }
++
++  // Float attributes map
++  if (projection.Includes(AXTreeProjection::kFloatAttributes) &&
++      node.float_attributes.size() > 0) {
++    base::Value::Dict attrs;
++    for (const auto& [key, value] : node.float_attributes) {
++      attrs.Set(ui::ToString(key), static_cast<double>(value));
++    }
++    dict.Set("floatAttributes", std::move(attrs));
++  }
++
++  // Bool attributes map
++  if (projection.Includes(AXTreeProjection::kBoolAttributes) &&
++      node.bool_attributes && node.bool_attributes->Size() > 0) {
++    base::Value::Dict attrs;
++    node.bool_attributes->ForEach([&attrs](ax::mojom::BoolAttribute key, bool value) {
++      attrs.Set(ui::ToString(key), value);
++    });
++    dict.Set("boolAttributes", std::move(attrs));
++  }
++
++  // IntList attributes map
++  if (projection.Includes(AXTreeProjection::kIntListAttributes) &&
++      node.intlist_attributes.size() > 0) {
++    base::Value::Dict attrs;
++    for (const auto& [key, values] : node.intlist_attributes) {
++      base::Value::List list;
++      for (int v : values) {
++        list.Append(v);
++      }
++      attrs.Set(ui::ToString(key), std::move(list));
++    }
++    dict.Set("intListAttributes", std::move(attrs));
++  }
++
++  // StringList attributes map
++  if (projection.Includes(AXTreeProjection::kStringListAttributes) &&
++      node.stringlist_attributes.size() > 0) {
++    base::Value::Dict attrs;
++    for (const auto& [key, values] : node.stringlist_attributes) {
++      base::Value::List list;
++      for (const auto& v : values) {
++        list.Append(v);
++      }
++      attrs.Set(ui::ToString(key), std::move(list));
++    }
++    dict.Set("stringListAttributes", std::move(attrs));
++  }
++
++  // HTML attributes (name-value pairs)
++  if (projection.Includes(AXTreeProjection::kHtmlAttributes) &&
++      !node.html_attributes.empty()) {
++    base::Value::Dict attrs;
++    for (const auto& [name, value] : node.html_attributes) {
++      attrs.Set(name, value);
++    }
++    dict.Set("htmlAttributes", std::move(attrs));
++  }
++
++  return dict;
++}
++
 +}  // namespace api
 +}  // namespace extensions
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/extensions/api/browser_os/browser_os_api_utils.h b/chrome/browser/extensions/api/browser_os/browser_os_api_utils.h
 new file mode 100644
-index 0000000000000..f4fdcb73186cd
+index 0000000000000..91495d678b9ef
 --- /dev/null
 +++ b/chrome/browser/extensions/api/browser_os/browser_os_api_utils.h
-@@ -0,0 +1,80 @@
+@@ -0,0 +1,90 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -14,9 +14,11 @@ index 0000000000000..f4fdcb73186cd
 +#include <optional>
 +#include <string>
 +#include <unordered_map>
++#include <vector>
 +
 +#include "base/memory/raw_ptr.h"
 +#include "base/values.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_node_attributes.h"
 +#include "chrome/common/extensions/api/browser_os.h"
 +#include "ui/accessibility/ax_node_data.h"
 +#include "ui/accessibility/ax_tree_id.h"
@@ -34,6 +36,8 @@ index 0000000000000..f4fdcb73186cd
 +
 +namespace api {
 +
++class AXTreeProjection;
++
 +// Result structure for tab retrieval
 +struct TabInfo {
 +  raw_ptr<content::WebContents> web_contents;
@@ -55,7 +59,7 @@ index 0000000000000..f4fdcb73186cd
 +  int32_t ax_node_id;
 +  ui::AXTreeID ax_tree_id;  // Tree ID for change detection
 +  gfx::RectF bounds;  // Absolute bounds in CSS pixels
-+  std::unordered_map<std::string, std::string> attributes;  // All computed attributes
++  NodeAttributes attributes;  // All computed attributes
 +  browser_os::InteractiveNodeType node_type;  // Cached node type to avoid recomputation
 +  bool in_viewport;  // Whether the node is currently visible in viewport
 +};
@@ -79,6 +83,12 @@ index 0000000000000..f4fdcb73186cd
 +// Helper to get the HTML tag name from AX role
 +std::string GetTagFromRole(ax::mojom::Role role);
 +
++// Serializes ui::AXNodeData to base::Value::Dict with the fields
++// |projection| includes. |child_ids| are the node's children in the
++// projected tree.
++base::Value::Dict SerializeAXNodeData(const ui::AXNodeData& node,
++                                      const AXTreeProjection& projection,
++                                      const std::vector<int32_t>& child_ids);
 +
 +}  // namespace api
 +}  // namespace extensions
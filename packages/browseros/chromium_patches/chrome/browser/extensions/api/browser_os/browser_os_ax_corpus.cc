@@ -0,0 +1,201 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_ax_corpus.cc b/chrome/browser/extensions/api/browser_os/browser_os_ax_corpus.cc
+new file mode 100644
+index 0000000000000..5c4a3a51652b0
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_ax_corpus.cc
+@@ -0,0 +1,195 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_ax_corpus.h"
++
++#include <string>
++#include <unordered_map>
++#include <utility>
++#include <vector>
++
++#include "base/base_paths.h"
++#include "base/files/file_path.h"
++#include "base/files/file_util.h"
++#include "base/path_service.h"
++#include "base/strings/string_number_conversions.h"
++#include "base/strings/string_split.h"
++#include "base/threading/thread_restrictions.h"
++#include "ui/accessibility/ax_enum_util.h"
++#include "ui/accessibility/ax_enums.mojom.h"
++#include "ui/accessibility/ax_node_data.h"
++#include "ui/accessibility/ax_tree_id.h"
++#include "ui/gfx/geometry/rect_f.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++bool ParseBounds(std::string_view value, gfx::RectF& bounds) {
++  std::vector<std::string_view> parts = base::SplitStringPiece(
++      value, ",", base::TRIM_WHITESPACE, base::SPLIT_WANT_ALL);
++  int x, y, width, height;
++  if (parts.size() != 4 || !base::StringToInt(parts[0], &x) ||
++      !base::StringToInt(parts[1], &y) ||
++      !base::StringToInt(parts[2], &width) ||
++      !base::StringToInt(parts[3], &height)) {
++    return false;
++  }
++  bounds = gfx::RectF(x, y, width, height);
++  return true;
++}
++
++bool ApplyAttribute(std::string_view attribute, ui::AXNodeData& node) {
++  if (attribute == "focusable") {
++    node.AddState(ax::mojom::State::kFocusable);
++    return true;
++  }
++  if (attribute == "editable") {
++    node.AddState(ax::mojom::State::kEditable);
++    return true;
++  }
++  if (attribute == "invisible") {
++    node.AddState(ax::mojom::State::kInvisible);
++    return true;
++  }
++  if (attribute == "ignored") {
++    node.AddState(ax::mojom::State::kIgnored);
++    return true;
++  }
++  if (attribute == "scrollable") {
++    node.AddBoolAttribute(ax::mojom::BoolAttribute::kScrollable, true);
++    return true;
++  }
++
++  size_t equals = attribute.find('=');
++  if (equals == std::string_view::npos) {
++    return false;
++  }
++  std::string_view key = attribute.substr(0, equals);
++  std::string value(attribute.substr(equals + 1));
++  if (key == "b") {
++    return ParseBounds(value, node.relative_bounds.bounds);
++  }
++  if (key == "c") {
++    return base::StringToInt(value,
++                             &node.relative_bounds.offset_container_id);
++  }
++  if (key == "level") {
++    int level;
++    if (!base::StringToInt(value, &level)) {
++      return false;
++    }
++    node.AddIntAttribute(ax::mojom::IntAttribute::kHierarchicalLevel, level);
++    return true;
++  }
++  if (key == "tag") {
++    node.AddStringAttribute(ax::mojom::StringAttribute::kHtmlTag, value);
++    return true;
++  }
++  if (key == "url") {
++    node.AddStringAttribute(ax::mojom::StringAttribute::kUrl, value);
++    return true;
++  }
++  if (key == "type") {
++    node.AddStringAttribute(ax::mojom::StringAttribute::kInputType, value);
++    return true;
++  }
++  return false;
++}
++
++}  // namespace
++
++std::optional<ui::AXTreeUpdate> ParseAXCorpus(std::string_view text) {
++  ui::AXTreeUpdate update;
++  std::unordered_map<int32_t, size_t> index_by_id;
++  for (std::string_view line : base::SplitStringPiece(
++           text, "\n", base::KEEP_WHITESPACE, base::SPLIT_WANT_NONEMPTY)) {
++    if (line.starts_with('#')) {
++      continue;
++    }
++    std::vector<std::string_view> fields = base::SplitStringPiece(
++        line, "\t", base::KEEP_WHITESPACE, base::SPLIT_WANT_ALL);
++    if (fields.size() != 5) {
++      return std::nullopt;
++    }
++
++    ui::AXNodeData node;
++    if (!base::StringToInt(fields[0], &node.id) ||
++        index_by_id.contains(node.id)) {
++      return std::nullopt;
++    }
++    node.role =
++        ui::ParseAXEnum<ax::mojom::Role>(std::string(fields[2]).c_str());
++    if (node.role == ax::mojom::Role::kNone) {
++      return std::nullopt;
++    }
++
++    // Children are listed in line order; the container is inherited
++    if (fields[1] == "-") {
++      if (!update.nodes.empty()) {
++        return std::nullopt;
++      }
++    } else {
++      int32_t parent_id;
++      if (!base::StringToInt(fields[1], &parent_id)) {
++        return std::nullopt;
++      }
++      auto parent = index_by_id.find(parent_id);
++      if (parent == index_by_id.end()) {
++        return std::nullopt;
++      }
++      ui::AXNodeData& parent_node = update.nodes[parent->second];
++      parent_node.child_ids.push_back(node.id);
++      node.relative_bounds.offset_container_id =
++          parent_node.relative_bounds.offset_container_id;
++    }
++
++    if (fields[3] != "-") {
++      for (std::string_view attribute : base::SplitStringPiece(
++               fields[3], " ", base::TRIM_WHITESPACE,
++               base::SPLIT_WANT_NONEMPTY)) {
++        if (!ApplyAttribute(attribute, node)) {
++          return std::nullopt;
++        }
++      }
++    }
++    if (!fields[4].empty()) {
++      node.SetName(std::string(fields[4]));
++    }
++
++    index_by_id.emplace(node.id, update.nodes.size());
++    update.nodes.push_back(std::move(node));
++  }
++
++  if (update.nodes.empty()) {
++    return std::nullopt;
++  }
++  update.root_id = update.nodes.front().id;
++  update.has_tree_data = true;
++  update.tree_data.tree_id = ui::AXTreeID::CreateNewAXTreeID();
++  return update;
++}
++
++std::optional<ui::AXTreeUpdate> LoadAXCorpus(std::string_view name) {
++  base::FilePath path;
++  if (!base::PathService::Get(base::DIR_SRC_TEST_DATA_ROOT, &path)) {
++    return std::nullopt;
++  }
++  path = path.AppendASCII("chrome")
++             .AppendASCII("test")
++             .AppendASCII("data")
++             .AppendASCII("browser_os")
++             .AppendASCII(name);
++
++  base::ScopedAllowBlockingForTesting allow_blocking;
++  std::string text;
++  if (!base::ReadFileToString(path, &text)) {
++    return std::nullopt;
++  }
++  return ParseAXCorpus(text);
++}
++
++}  // namespace api
++}  // namespace extensions
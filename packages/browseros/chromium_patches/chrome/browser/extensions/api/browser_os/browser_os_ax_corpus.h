@@ -0,0 +1,48 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_ax_corpus.h b/chrome/browser/extensions/api/browser_os/browser_os_ax_corpus.h
+new file mode 100644
+index 0000000000000..ccbb0006efce4
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_ax_corpus.h
+@@ -0,0 +1,42 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_AX_CORPUS_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_AX_CORPUS_H_
++
++#include <optional>
++#include <string_view>
++
++#include "ui/accessibility/ax_tree_update.h"
++
++namespace extensions {
++namespace api {
++
++// Accessibility tree corpora in chrome/test/data/browser_os, written by
++// generate_corpora.py there. Each is one AXTreeUpdate shaped like the
++// flattened tree WebContents::RequestAXTreeSnapshot() delivers, so tests can
++// run the extraction paths without a renderer.
++inline constexpr char kSmallFormCorpus[] = "small_form.axtree";
++inline constexpr char kNewsPageCorpus[] = "news_5k.axtree";
++inline constexpr char kGridCorpus[] = "grid_50k.axtree";
++inline constexpr char kIframeNestCorpus[] = "iframe_nest.axtree";
++
++// Parses a corpus: one node per line in preorder, as
++//
++//   <id> TAB <parent id or -> TAB <role> TAB <attributes or -> TAB <name>
++//
++// Attributes are space separated: b=x,y,w,h (relative bounds), c=<id>
++// (offset container, inherited from the parent otherwise), tag=, url=,
++// type= (input type), level= (heading level), and the flags focusable,
++// editable, invisible, ignored and scrollable. Lines starting with # are
++// comments. Returns nullopt if |text| is malformed.
++std::optional<ui::AXTreeUpdate> ParseAXCorpus(std::string_view text);
++
++// Reads and parses the corpus |name| from chrome/test/data/browser_os.
++std::optional<ui::AXTreeUpdate> LoadAXCorpus(std::string_view name);
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_AX_CORPUS_H_
@@ -0,0 +1,86 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_ax_corpus_unittest.cc b/chrome/browser/extensions/api/browser_os/browser_os_ax_corpus_unittest.cc
+new file mode 100644
+index 0000000000000..f09677ed89242
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_ax_corpus_unittest.cc
+@@ -0,0 +1,80 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_ax_corpus.h"
++
++#include <optional>
++
++#include "testing/gtest/include/gtest/gtest.h"
++#include "ui/accessibility/ax_enums.mojom.h"
++#include "ui/accessibility/ax_node.h"
++#include "ui/accessibility/ax_tree.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++TEST(BrowserOSAXCorpusTest, ParsesNodesInPreorder) {
++  std::optional<ui::AXTreeUpdate> update = ParseAXCorpus(
++      "# comment\n"
++      "1\t-\trootWebArea\tb=0,0,800,600\tPage\n"
++      "2\t1\tmain\tc=1\t\n"
++      "3\t2\tbutton\ttag=button b=10,20,30,40 focusable\tGo\n"
++      "4\t1\tlink\turl=https://example.com/\tMore\n");
++  ASSERT_TRUE(update);
++  ASSERT_EQ(4u, update->nodes.size());
++  EXPECT_EQ(1, update->root_id);
++  EXPECT_EQ((std::vector<int32_t>{2, 4}), update->nodes[0].child_ids);
++
++  const ui::AXNodeData& button = update->nodes[2];
++  EXPECT_EQ(ax::mojom::Role::kButton, button.role);
++  EXPECT_EQ("Go", button.GetStringAttribute(ax::mojom::StringAttribute::kName));
++  EXPECT_EQ("button",
++            button.GetStringAttribute(ax::mojom::StringAttribute::kHtmlTag));
++  EXPECT_TRUE(button.HasState(ax::mojom::State::kFocusable));
++  EXPECT_EQ(gfx::RectF(10, 20, 30, 40), button.relative_bounds.bounds);
++  // Inherited from main
++  EXPECT_EQ(1, button.relative_bounds.offset_container_id);
++
++  EXPECT_EQ(-1, update->nodes[3].relative_bounds.offset_container_id);
++}
++
++TEST(BrowserOSAXCorpusTest, RejectsMalformedInput) {
++  EXPECT_FALSE(ParseAXCorpus(""));
++  // Unknown parent
++  EXPECT_FALSE(ParseAXCorpus("1\t-\trootWebArea\t-\t\n2\t5\tbutton\t-\t\n"));
++  // Second root
++  EXPECT_FALSE(ParseAXCorpus("1\t-\trootWebArea\t-\t\n2\t-\tbutton\t-\t\n"));
++  // Unknown attribute
++  EXPECT_FALSE(ParseAXCorpus("1\t-\trootWebArea\tcolor=red\t\n"));
++  // Missing field
++  EXPECT_FALSE(ParseAXCorpus("1\t-\trootWebArea\t-\n"));
++}
++
++// The checked-in corpora load into a valid tree of the advertised size
++TEST(BrowserOSAXCorpusTest, CorporaUnserialize) {
++  const struct {
++    const char* name;
++    size_t nodes;
++  } kCorpora[] = {
++      {kSmallFormCorpus, 17},
++      {kNewsPageCorpus, 5000},
++      {kGridCorpus, 50000},
++      {kIframeNestCorpus, 225},
++  };
++  for (const auto& corpus : kCorpora) {
++    SCOPED_TRACE(corpus.name);
++    std::optional<ui::AXTreeUpdate> update = LoadAXCorpus(corpus.name);
++    ASSERT_TRUE(update);
++    EXPECT_EQ(corpus.nodes, update->nodes.size());
++    ui::AXTree tree;
++    EXPECT_TRUE(tree.Unserialize(*update)) << tree.error();
++  }
++}
++
++}  // namespace
++
++}  // namespace api
++}  // namespace extensions
@@ -0,0 +1,105 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_ax_tree_cache.cc b/chrome/browser/extensions/api/browser_os/browser_os_ax_tree_cache.cc
+new file mode 100644
+index 0000000000000..4a380f9b2547e
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_ax_tree_cache.cc
+@@ -0,0 +1,99 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_ax_tree_cache.h"
++
++#include <string_view>
++#include <utility>
++
++#include "base/functional/bind.h"
++#include "base/logging.h"
++#include "base/strings/strcat.h"
++#include "base/strings/string_number_conversions.h"
++#include "base/unguessable_token.h"
++#include "content/public/browser/web_contents.h"
++
++namespace extensions {
++namespace api {
++
++BrowserOSAXTreeCache::PinnedTree::PinnedTree() = default;
++BrowserOSAXTreeCache::PinnedTree::PinnedTree(PinnedTree&&) = default;
++BrowserOSAXTreeCache::PinnedTree&
++BrowserOSAXTreeCache::PinnedTree::operator=(PinnedTree&&) = default;
++BrowserOSAXTreeCache::PinnedTree::~PinnedTree() = default;
++
++BrowserOSAXTreeCache::BrowserOSAXTreeCache(content::WebContents* web_contents)
++    : content::WebContentsObserver(web_contents),
++      content::WebContentsUserData<BrowserOSAXTreeCache>(*web_contents) {}
++
++BrowserOSAXTreeCache::~BrowserOSAXTreeCache() = default;
++
++const BrowserOSAXTreeCache::PinnedTree& BrowserOSAXTreeCache::Pin(
++    ui::AXTreeUpdate tree_update,
++    const AXTreeProjection& projection) {
++  PinnedTree& pinned = pinned_.emplace();
++  pinned.version = base::UnguessableToken::Create().ToString();
++  pinned.tree_update = std::move(tree_update);
++  pinned.projection = projection;
++  pinned.entries = projection.Select(pinned.tree_update);
++  pinned.child_ids =
++      AXTreeProjection::GetChildIds(pinned.tree_update, pinned.entries);
++
++  LOG(INFO) << "[browseros] Pinned accessibility tree " << pinned.version
++            << " (" << pinned.entries.size() << " nodes)";
++
++  ttl_timer_.Start(FROM_HERE, kTtl,
++                   base::BindOnce(&BrowserOSAXTreeCache::Release,
++                                  base::Unretained(this)));
++  return pinned;
++}
++
++const BrowserOSAXTreeCache::PinnedTree* BrowserOSAXTreeCache::Get(
++    const std::string& version) {
++  if (!pinned_ || pinned_->version != version) {
++    return nullptr;
++  }
++  ttl_timer_.Reset();
++  return &*pinned_;
++}
++
++// static
++std::string BrowserOSAXTreeCache::MakeCursor(const std::string& version,
++                                             size_t offset) {
++  return base::StrCat({version, ":", base::NumberToString(offset)});
++}
++
++// static
++bool BrowserOSAXTreeCache::ParseCursor(const std::string& cursor,
++                                       std::string* version,
++                                       size_t* offset) {
++  size_t separator = cursor.rfind(':');
++  if (separator == std::string::npos || separator == 0) {
++    return false;
++  }
++  if (!base::StringToSizeT(
++          std::string_view(cursor).substr(separator + 1), offset)) {
++    return false;
++  }
++  *version = cursor.substr(0, separator);
++  return true;
++}
++
++void BrowserOSAXTreeCache::PrimaryPageChanged(content::Page& page) {
++  Release();
++}
++
++void BrowserOSAXTreeCache::Release() {
++  if (pinned_) {
++    LOG(INFO) << "[browseros] Released accessibility tree "
++              << pinned_->version;
++  }
++  pinned_.reset();
++  ttl_timer_.Stop();
++}
++
++WEB_CONTENTS_USER_DATA_KEY_IMPL(BrowserOSAXTreeCache);
++
++}  // namespace api
++}  // namespace extensions
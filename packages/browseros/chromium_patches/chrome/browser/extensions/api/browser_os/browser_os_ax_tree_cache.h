@@ -0,0 +1,104 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_ax_tree_cache.h b/chrome/browser/extensions/api/browser_os/browser_os_ax_tree_cache.h
+new file mode 100644
+index 0000000000000..95246d9b1708a
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_ax_tree_cache.h
+@@ -0,0 +1,98 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_AX_TREE_CACHE_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_AX_TREE_CACHE_H_
++
++#include <cstddef>
++#include <cstdint>
++#include <optional>
++#include <string>
++#include <vector>
++
++#include "base/time/time.h"
++#include "base/timer/timer.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_ax_tree_projection.h"
++#include "content/public/browser/web_contents_observer.h"
++#include "content/public/browser/web_contents_user_data.h"
++#include "ui/accessibility/ax_tree_update.h"
++
++namespace extensions {
++namespace api {
++
++// Per-tab cache that pins one accessibility tree for paginated
++// getAccessibilityTree calls.
++//
++// The first paginated call pins the tree together with its projection and
++// the projected node order, and gets a version token back. Later calls
++// name the version in their cursor and read further ranges of the same
++// tree, so pages stay consistent even while the page keeps changing. Pinning
++// a new tree replaces the old one. The tree is released when the primary
++// page changes or when it has not been read for kTtl.
++//
++// Lives on the UI thread.
++class BrowserOSAXTreeCache
++    : public content::WebContentsObserver,
++      public content::WebContentsUserData<BrowserOSAXTreeCache> {
++ public:
++  // How long a pinned tree survives without being read.
++  static constexpr base::TimeDelta kTtl = base::Seconds(60);
++
++  struct PinnedTree {
++    PinnedTree();
++    PinnedTree(PinnedTree&&);
++    PinnedTree& operator=(PinnedTree&&);
++    ~PinnedTree();
++
++    std::string version;
++    ui::AXTreeUpdate tree_update;
++    AXTreeProjection projection;
++    // Selected nodes in depth-first order; cursors index into this.
++    std::vector<AXTreeProjection::Entry> entries;
++    // Projected child ids of each entry.
++    std::vector<std::vector<int32_t>> child_ids;
++  };
++
++  ~BrowserOSAXTreeCache() override;
++
++  BrowserOSAXTreeCache(const BrowserOSAXTreeCache&) = delete;
++  BrowserOSAXTreeCache& operator=(const BrowserOSAXTreeCache&) = delete;
++
++  // Pins |tree_update| as projected by |projection|, replacing any pinned
++  // tree, and returns it.
++  const PinnedTree& Pin(ui::AXTreeUpdate tree_update,
++                        const AXTreeProjection& projection);
++
++  // Returns the pinned tree if its version is |version|, or null if it was
++  // released or replaced. Restarts the TTL.
++  const PinnedTree* Get(const std::string& version);
++
++  // Cursor of the page starting at |offset| in the tree pinned as |version|.
++  static std::string MakeCursor(const std::string& version, size_t offset);
++
++  // Splits |cursor| into version and offset. Returns false if malformed.
++  static bool ParseCursor(const std::string& cursor,
++                          std::string* version,
++                          size_t* offset);
++
++ private:
++  friend class content::WebContentsUserData<BrowserOSAXTreeCache>;
++
++  explicit BrowserOSAXTreeCache(content::WebContents* web_contents);
++
++  // content::WebContentsObserver:
++  void PrimaryPageChanged(content::Page& page) override;
++
++  void Release();
++
++  std::optional<PinnedTree> pinned_;
++  base::OneShotTimer ttl_timer_;
++
++  WEB_CONTENTS_USER_DATA_KEY_DECL();
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_AX_TREE_CACHE_H_
@@ -0,0 +1,321 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_ax_tree_encoder.cc b/chrome/browser/extensions/api/browser_os/browser_os_ax_tree_encoder.cc
+new file mode 100644
+index 0000000000000..689a27ae134d3
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_ax_tree_encoder.cc
+@@ -0,0 +1,315 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_ax_tree_encoder.h"
++
++#include <cstring>
++#include <string>
++#include <string_view>
++#include <unordered_map>
++#include <utility>
++#include <vector>
++
++#include "base/containers/span.h"
++#include "base/numerics/safe_conversions.h"
++#include "ui/accessibility/ax_enum_util.h"
++#include "ui/accessibility/ax_enums.mojom.h"
++#include "ui/accessibility/ax_node_data.h"
++#include "ui/accessibility/ax_tree_update.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++using Section = AXTreeColumnarEncoder::Section;
++using AttributeKind = AXTreeColumnarEncoder::AttributeKind;
++
++constexpr size_t kSectionCount = static_cast<size_t>(Section::kCount);
++constexpr size_t kBitNames = 64;
++
++// Deduplicates strings. Views must outlive the table; they point into the
++// tree update or at static enum names.
++class StringTable {
++ public:
++  uint32_t Add(std::string_view value) {
++    auto [it, inserted] = index_.try_emplace(
++        value, base::checked_cast<uint32_t>(strings_.size()));
++    if (inserted) {
++      strings_.push_back(value);
++    }
++    return it->second;
++  }
++
++  const std::vector<std::string_view>& strings() const { return strings_; }
++
++ private:
++  std::unordered_map<std::string_view, uint32_t> index_;
++  std::vector<std::string_view> strings_;
++};
++
++// Columns of the encoding before they are laid out in one buffer.
++struct Columns {
++  std::vector<int32_t> ids;
++  std::vector<uint32_t> roles;
++  std::vector<uint32_t> parents;
++  std::vector<uint32_t> states;
++  std::vector<uint32_t> actions;
++  std::vector<float> bounds;
++  std::vector<int32_t> offset_containers;
++  std::vector<uint32_t> attribute_starts;
++  std::vector<uint32_t> attribute_keys;
++  std::vector<uint8_t> attribute_kinds;
++  std::vector<uint32_t> attribute_values;
++  std::vector<uint32_t> list_values;
++};
++
++void AddAttribute(Columns& columns,
++                  uint32_t key,
++                  AttributeKind kind,
++                  uint32_t value) {
++  columns.attribute_keys.push_back(key);
++  columns.attribute_kinds.push_back(static_cast<uint8_t>(kind));
++  columns.attribute_values.push_back(value);
++}
++
++template <typename T>
++uint32_t BitsOf(T value) {
++  static_assert(sizeof(T) == sizeof(uint32_t));
++  uint32_t bits;
++  std::memcpy(&bits, &value, sizeof(bits));
++  return bits;
++}
++
++// Appends the columns for one node, leaving out the field groups
++// |projection| excludes.
++void EncodeNode(const ui::AXNodeData& node,
++                uint32_t parent,
++                const AXTreeProjection& projection,
++                StringTable& strings,
++                Columns& columns) {
++  columns.ids.push_back(node.id);
++  columns.roles.push_back(strings.Add(ui::ToString(node.role)));
++  columns.parents.push_back(parent);
++
++  // Bit i of the node's bitfields is enum value i, which is what
++  // kStateNames/kActionNames describe, so the fields are copied as is.
++  if (projection.Includes(AXTreeProjection::kStates)) {
++    uint64_t state = node.state;
++    columns.states.push_back(static_cast<uint32_t>(state));
++    columns.states.push_back(static_cast<uint32_t>(state >> 32));
++  }
++  if (projection.Includes(AXTreeProjection::kActions)) {
++    uint64_t actions = node.actions;
++    columns.actions.push_back(static_cast<uint32_t>(actions));
++    columns.actions.push_back(static_cast<uint32_t>(actions >> 32));
++  }
++
++  if (projection.Includes(AXTreeProjection::kBounds)) {
++    const gfx::RectF& bounds = node.relative_bounds.bounds;
++    columns.bounds.insert(columns.bounds.end(),
++                          {bounds.x(), bounds.y(), bounds.width(),
++                           bounds.height()});
++    columns.offset_containers.push_back(
++        node.relative_bounds.offset_container_id);
++  }
++
++  columns.attribute_starts.push_back(
++      base::checked_cast<uint32_t>(columns.attribute_keys.size()));
++
++  if (projection.Includes(AXTreeProjection::kStringAttributes)) {
++    for (const auto& [key, value] : node.string_attributes) {
++      AddAttribute(columns, strings.Add(ui::ToString(key)),
++                   AttributeKind::kString, strings.Add(value));
++    }
++  } else if (projection.Includes(AXTreeProjection::kName) &&
++             node.HasStringAttribute(ax::mojom::StringAttribute::kName)) {
++    AddAttribute(
++        columns, strings.Add(ui::ToString(ax::mojom::StringAttribute::kName)),
++        AttributeKind::kString,
++        strings.Add(
++            node.GetStringAttribute(ax::mojom::StringAttribute::kName)));
++  }
++  if (projection.Includes(AXTreeProjection::kIntAttributes)) {
++    for (const auto& [key, value] : node.int_attributes) {
++      AddAttribute(columns, strings.Add(ui::ToString(key)),
++                   AttributeKind::kInt, BitsOf(value));
++    }
++  }
++  if (projection.Includes(AXTreeProjection::kFloatAttributes)) {
++    for (const auto& [key, value] : node.float_attributes) {
++      AddAttribute(columns, strings.Add(ui::ToString(key)),
++                   AttributeKind::kFloat, BitsOf(value));
++    }
++  }
++  if (projection.Includes(AXTreeProjection::kBoolAttributes) &&
++      node.bool_attributes) {
++    node.bool_attributes->ForEach(
++        [&](ax::mojom::BoolAttribute key, bool value) {
++          AddAttribute(columns, strings.Add(ui::ToString(key)),
++                       AttributeKind::kBool, value ? 1 : 0);
++        });
++  }
++  if (projection.Includes(AXTreeProjection::kIntListAttributes)) {
++    for (const auto& [key, values] : node.intlist_attributes) {
++      AddAttribute(columns, strings.Add(ui::ToString(key)),
++                   AttributeKind::kIntList,
++                   base::checked_cast<uint32_t>(columns.list_values.size()));
++      columns.list_values.push_back(
++          base::checked_cast<uint32_t>(values.size()));
++      for (int32_t value : values) {
++        columns.list_values.push_back(BitsOf(value));
++      }
++    }
++  }
++  if (projection.Includes(AXTreeProjection::kStringListAttributes)) {
++    for (const auto& [key, values] : node.stringlist_attributes) {
++      AddAttribute(columns, strings.Add(ui::ToString(key)),
++                   AttributeKind::kStringList,
++                   base::checked_cast<uint32_t>(columns.list_values.size()));
++      columns.list_values.push_back(
++          base::checked_cast<uint32_t>(values.size()));
++      for (const std::string& value : values) {
++        columns.list_values.push_back(strings.Add(value));
++      }
++    }
++  }
++  if (projection.Includes(AXTreeProjection::kHtmlAttributes)) {
++    for (const auto& [name, value] : node.html_attributes) {
++      AddAttribute(columns, strings.Add(name), AttributeKind::kHtml,
++                   strings.Add(value));
++    }
++  }
++}
++
++// Lays sections out after a header and records each in the section table.
++class BufferWriter {
++ public:
++  BufferWriter() {
++    buffer_.resize(Align(sizeof(uint32_t) * (5 + 2 * kSectionCount)));
++  }
++
++  void WriteHeader(uint32_t node_count, uint32_t root_id) {
++    PutU32(0, AXTreeColumnarEncoder::kMagic);
++    PutU32(1, AXTreeColumnarEncoder::kVersion);
++    PutU32(2, node_count);
++    PutU32(3, root_id);
++    PutU32(4, kSectionCount);
++  }
++
++  template <typename T>
++  void WriteSection(Section section, const std::vector<T>& values) {
++    base::span<const uint8_t> bytes = base::as_byte_span(values);
++    size_t offset = buffer_.size();
++    buffer_.resize(Align(offset + bytes.size()));
++    if (!bytes.empty()) {
++      std::memcpy(buffer_.data() + offset, bytes.data(), bytes.size());
++    }
++    size_t slot = 5 + 2 * static_cast<size_t>(section);
++    PutU32(slot, base::checked_cast<uint32_t>(offset));
++    PutU32(slot + 1, base::checked_cast<uint32_t>(bytes.size()));
++  }
++
++  std::vector<uint8_t> Take() { return std::move(buffer_); }
++
++ private:
++  static size_t Align(size_t size) { return (size + 7) & ~size_t{7}; }
++
++  // Chromium only targets little-endian hosts, so values are copied as is.
++  void PutU32(size_t index, uint32_t value) {
++    std::memcpy(buffer_.data() + index * sizeof(uint32_t), &value,
++                sizeof(value));
++  }
++
++  std::vector<uint8_t> buffer_;
++};
++
++}  // namespace
++
++// static
++std::vector<uint8_t> AXTreeColumnarEncoder::Encode(
++    const ui::AXTreeUpdate& tree_update,
++    const AXTreeProjection& projection,
++    base::span<const AXTreeProjection::Entry> entries) {
++  size_t node_count = entries.size();
++
++  StringTable strings;
++  Columns columns;
++  columns.ids.reserve(node_count);
++  columns.roles.reserve(node_count);
++  columns.parents.reserve(node_count);
++  if (projection.Includes(AXTreeProjection::kStates)) {
++    columns.states.reserve(node_count * 2);
++  }
++  if (projection.Includes(AXTreeProjection::kActions)) {
++    columns.actions.reserve(node_count * 2);
++  }
++  if (projection.Includes(AXTreeProjection::kBounds)) {
++    columns.bounds.reserve(node_count * 4);
++    columns.offset_containers.reserve(node_count);
++  }
++  columns.attribute_starts.reserve(node_count + 1);
++
++  // Select() parents are positions in its result, which are also output
++  // node indices.
++  for (const AXTreeProjection::Entry& entry : entries) {
++    EncodeNode(tree_update.nodes[entry.index],
++               entry.parent == AXTreeProjection::kNoParent ? kNone
++                                                           : entry.parent,
++               projection, strings, columns);
++  }
++  columns.attribute_starts.push_back(
++      base::checked_cast<uint32_t>(columns.attribute_keys.size()));
++
++  // Names of every state and action bit
++  std::vector<uint32_t> state_names(kBitNames, kNone);
++  for (int i = static_cast<int>(ax::mojom::State::kMinValue);
++       i <= static_cast<int>(ax::mojom::State::kMaxValue) &&
++       i < static_cast<int>(kBitNames);
++       ++i) {
++    state_names[i] = strings.Add(ui::ToString(static_cast<ax::mojom::State>(i)));
++  }
++  std::vector<uint32_t> action_names(kBitNames, kNone);
++  for (int i = static_cast<int>(ax::mojom::Action::kMinValue);
++       i <= static_cast<int>(ax::mojom::Action::kMaxValue) &&
++       i < static_cast<int>(kBitNames);
++       ++i) {
++    action_names[i] =
++        strings.Add(ui::ToString(static_cast<ax::mojom::Action>(i)));
++  }
++
++  // String table
++  std::vector<uint32_t> string_offsets;
++  string_offsets.reserve(strings.strings().size() + 1);
++  std::vector<char> string_data;
++  for (std::string_view value : strings.strings()) {
++    string_offsets.push_back(base::checked_cast<uint32_t>(string_data.size()));
++    string_data.insert(string_data.end(), value.begin(), value.end());
++  }
++  string_offsets.push_back(base::checked_cast<uint32_t>(string_data.size()));
++
++  BufferWriter writer;
++  writer.WriteHeader(base::checked_cast<uint32_t>(node_count),
++                     static_cast<uint32_t>(tree_update.root_id));
++  writer.WriteSection(Section::kStringOffsets, string_offsets);
++  writer.WriteSection(Section::kStringData, string_data);
++  writer.WriteSection(Section::kIds, columns.ids);
++  writer.WriteSection(Section::kRoles, columns.roles);
++  writer.WriteSection(Section::kParents, columns.parents);
++  writer.WriteSection(Section::kStates, columns.states);
++  writer.WriteSection(Section::kActions, columns.actions);
++  writer.WriteSection(Section::kBounds, columns.bounds);
++  writer.WriteSection(Section::kOffsetContainers, columns.offset_containers);
++  writer.WriteSection(Section::kAttributeStarts, columns.attribute_starts);
++  writer.WriteSection(Section::kAttributeKeys, columns.attribute_keys);
++  writer.WriteSection(Section::kAttributeKinds, columns.attribute_kinds);
++  writer.WriteSection(Section::kAttributeValues, columns.attribute_values);
++  writer.WriteSection(Section::kListValues, columns.list_values);
++  writer.WriteSection(Section::kStateNames, state_names);
++  writer.WriteSection(Section::kActionNames, action_names);
++  return writer.Take();
++}
++
++}  // namespace api
++}  // namespace extensions
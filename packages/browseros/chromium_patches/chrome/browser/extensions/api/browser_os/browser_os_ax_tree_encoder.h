@@ -0,0 +1,124 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_ax_tree_encoder.h b/chrome/browser/extensions/api/browser_os/browser_os_ax_tree_encoder.h
+new file mode 100644
+index 0000000000000..394e16a0df4d3
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_ax_tree_encoder.h
+@@ -0,0 +1,118 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_AX_TREE_ENCODER_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_AX_TREE_ENCODER_H_
++
++#include <cstdint>
++#include <vector>
++
++#include "base/containers/span.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_ax_tree_projection.h"
++
++namespace ui {
++struct AXTreeUpdate;
++}  // namespace ui
++
++namespace extensions {
++namespace api {
++
++// Encodes an accessibility tree into the compact columnar format returned by
++// getAccessibilityTree({format: "columnar"}).
++//
++// Every string (role names, attribute names and values) is stored once in a
++// shared table and referenced by index. Per-node data lives in parallel
++// arrays, so decoding is a handful of typed array views over one buffer.
++//
++// Layout, all integers little-endian:
++//
++//   u32 magic (kMagic), u32 version (kVersion), u32 node_count,
++//   u32 root_id, u32 section_count,
++//   section_count x (u32 offset, u32 byte_length), in Section order.
++//
++// Every section starts at a multiple of 8 bytes. Nodes are the ones
++// AXTreeProjection::Select() picks, numbered in its depth-first order, so a
++// node's children are the following nodes whose parent is it, in child
++// order. For a page of a paginated tree, parents keep their numbering in
++// the whole tree. Sections of field groups the projection leaves out are
++// empty.
++class AXTreeColumnarEncoder {
++ public:
++  static constexpr uint32_t kMagic = 0x31435841;  // "AXC1"
++  static constexpr uint32_t kVersion = 1;
++  // Marks "none" in string index and node index columns.
++  static constexpr uint32_t kNone = 0xFFFFFFFF;
++
++  enum class Section : uint32_t {
++    // u32[string_count + 1]: byte offset of each string in kStringData,
++    // plus the end offset.
++    kStringOffsets,
++    // UTF-8 bytes of all strings.
++    kStringData,
++    // i32[node_count]: AX node ids.
++    kIds,
++    // u32[node_count]: string index of the role name.
++    kRoles,
++    // u32[node_count]: node index of the parent, or kNone.
++    kParents,
++    // u32[2 * node_count]: low and high words of the state bitmask; bit i
++    // is set if state i (see kStateNames) applies.
++    kStates,
++    // u32[2 * node_count]: action bitmask, as kStates.
++    kActions,
++    // f32[4 * node_count]: x, y, width, height of the relative bounds.
++    kBounds,
++    // i32[node_count]: offset container id of the bounds, or -1.
++    kOffsetContainers,
++    // u32[node_count + 1]: index of each node's first attribute, plus the
++    // end index. Attributes of node i are [starts[i], starts[i + 1]).
++    kAttributeStarts,
++    // u32[attribute_count]: string index of the attribute name.
++    kAttributeKeys,
++    // u8[attribute_count]: AttributeKind.
++    kAttributeKinds,
++    // u32[attribute_count]: value, interpreted per AttributeKind.
++    kAttributeValues,
++    // u32[]: list attributes, each a length followed by its items.
++    kListValues,
++    // u32[64]: string index of the name of each state bit, or kNone.
++    kStateNames,
++    // u32[64]: string index of the name of each action bit, or kNone.
++    kActionNames,
++    kCount,
++  };
++
++  enum class AttributeKind : uint8_t {
++    // Value is a string index.
++    kString,
++    // Value is the bits of an int32.
++    kInt,
++    // Value is the bits of a float32.
++    kFloat,
++    // Value is 0 or 1.
++    kBool,
++    // Value is the kListValues index of a list of int32.
++    kIntList,
++    // Value is the kListValues index of a list of string indices.
++    kStringList,
++    // HTML attribute: key is the attribute name, value a string index.
++    kHtml,
++  };
++
++  AXTreeColumnarEncoder() = delete;
++  AXTreeColumnarEncoder(const AXTreeColumnarEncoder&) = delete;
++  AXTreeColumnarEncoder& operator=(const AXTreeColumnarEncoder&) = delete;
++
++  // Returns the encoding of |entries|, a range of what |projection|
++  // selects from |tree_update|.
++  static std::vector<uint8_t> Encode(
++      const ui::AXTreeUpdate& tree_update,
++      const AXTreeProjection& projection,
++      base::span<const AXTreeProjection::Entry> entries);
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_AX_TREE_ENCODER_H_
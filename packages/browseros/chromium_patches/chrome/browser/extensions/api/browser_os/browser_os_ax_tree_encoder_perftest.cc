@@ -0,0 +1,106 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_ax_tree_encoder_perftest.cc b/chrome/browser/extensions/api/browser_os/browser_os_ax_tree_encoder_perftest.cc
+new file mode 100644
+index 0000000000000..40ea43060f787
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_ax_tree_encoder_perftest.cc
+@@ -0,0 +1,100 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include <optional>
++#include <string>
++#include <vector>
++
++#include "base/json/json_writer.h"
++#include "base/strings/string_number_conversions.h"
++#include "base/strings/string_util.h"
++#include "base/values.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_api_utils.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_ax_corpus.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_ax_tree_encoder.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_ax_tree_projection.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_perftest_util.h"
++#include "testing/gtest/include/gtest/gtest.h"
++#include "testing/perf/perf_result_reporter.h"
++#include "ui/accessibility/ax_tree_update.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++constexpr int kIterations = 10;
++
++// getAccessibilityTree output in both formats for each corpus. The dict
++// format is measured up to the JSON the extension receives, the columnar
++// format up to the finished buffer.
++class BrowserOSAXTreeEncoderPerfTest
++    : public testing::TestWithParam<const char*> {
++ protected:
++  void SetUp() override {
++    update_ = LoadAXCorpus(GetParam());
++    ASSERT_TRUE(update_) << "Could not load " << GetParam();
++    entries_ = projection_.Select(*update_);
++    child_ids_ = AXTreeProjection::GetChildIds(*update_, entries_);
++  }
++
++  std::string Story() const {
++    std::string story(GetParam());
++    base::ReplaceSubstringsAfterOffset(&story, 0, ".axtree", "");
++    return story;
++  }
++
++  void ReportOutputSize(const std::string& metric, size_t bytes) {
++    perf_test::PerfResultReporter reporter(metric, Story());
++    reporter.RegisterImportantMetric(".output_size", "bytes");
++    reporter.AddResult(".output_size", bytes);
++  }
++
++  std::optional<ui::AXTreeUpdate> update_;
++  AXTreeProjection projection_;
++  std::vector<AXTreeProjection::Entry> entries_;
++  std::vector<std::vector<int32_t>> child_ids_;
++};
++
++TEST_P(BrowserOSAXTreeEncoderPerfTest, Dict) {
++  size_t output_size = 0;
++  PerfMeasurement measurement =
++      MeasureRuns(entries_.size(), kIterations, [&] {
++        base::Value::Dict nodes;
++        for (size_t i = 0; i < entries_.size(); ++i) {
++          const ui::AXNodeData& node = update_->nodes[entries_[i].index];
++          nodes.Set(base::NumberToString(node.id),
++                    SerializeAXNodeData(node, projection_, child_ids_[i]));
++        }
++        output_size = base::WriteJson(nodes).value_or(std::string()).size();
++      });
++  EXPECT_GT(output_size, 0u);
++  ReportMeasurement("BrowserOS.AXTreeDict", Story(), measurement);
++  ReportOutputSize("BrowserOS.AXTreeDict", output_size);
++}
++
++TEST_P(BrowserOSAXTreeEncoderPerfTest, Columnar) {
++  size_t output_size = 0;
++  PerfMeasurement measurement =
++      MeasureRuns(entries_.size(), kIterations, [&] {
++        output_size =
++            AXTreeColumnarEncoder::Encode(*update_, projection_, entries_)
++                .size();
++      });
++  EXPECT_GT(output_size, 0u);
++  ReportMeasurement("BrowserOS.AXTreeColumnar", Story(), measurement);
++  ReportOutputSize("BrowserOS.AXTreeColumnar", output_size);
++}
++
++INSTANTIATE_TEST_SUITE_P(All,
++                         BrowserOSAXTreeEncoderPerfTest,
++                         testing::Values(kSmallFormCorpus,
++                                         kNewsPageCorpus,
++                                         kGridCorpus,
++                                         kIframeNestCorpus));
++
++}  // namespace
++
++}  // namespace api
++}  // namespace extensions
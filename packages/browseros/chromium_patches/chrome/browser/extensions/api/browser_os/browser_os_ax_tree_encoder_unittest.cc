@@ -0,0 +1,298 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_ax_tree_encoder_unittest.cc b/chrome/browser/extensions/api/browser_os/browser_os_ax_tree_encoder_unittest.cc
+new file mode 100644
+index 0000000000000..dfea1b53552f6
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_ax_tree_encoder_unittest.cc
+@@ -0,0 +1,292 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_ax_tree_encoder.h"
++
++#include <cstring>
++#include <optional>
++#include <string>
++#include <utility>
++#include <vector>
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_ax_corpus.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_ax_tree_projection.h"
++#include "testing/gtest/include/gtest/gtest.h"
++#include "ui/accessibility/ax_enum_util.h"
++#include "ui/accessibility/ax_enums.mojom.h"
++#include "ui/accessibility/ax_node_data.h"
++#include "ui/accessibility/ax_tree_update.h"
++#include "ui/gfx/geometry/rect_f.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++using Section = AXTreeColumnarEncoder::Section;
++using AttributeKind = AXTreeColumnarEncoder::AttributeKind;
++
++// Reads an encoding back into nodes, the way the extension does with typed
++// array views, so tests can compare against the input.
++class ColumnarReader {
++ public:
++  explicit ColumnarReader(std::vector<uint8_t> buffer)
++      : buffer_(std::move(buffer)) {}
++
++  uint32_t Header(size_t index) const {
++    uint32_t value;
++    std::memcpy(&value, buffer_.data() + index * sizeof(value), sizeof(value));
++    return value;
++  }
++
++  template <typename T>
++  std::vector<T> Read(Section section) const {
++    size_t slot = 5 + 2 * static_cast<size_t>(section);
++    uint32_t offset = Header(slot);
++    uint32_t length = Header(slot + 1);
++    EXPECT_EQ(0u, offset % 8);
++    EXPECT_LE(offset + length, buffer_.size());
++    std::vector<T> values(length / sizeof(T));
++    if (length) {
++      std::memcpy(values.data(), buffer_.data() + offset, length);
++    }
++    return values;
++  }
++
++  // Decodes every node. Children are rebuilt from the parent column.
++  std::vector<ui::AXNodeData> Decode() const {
++    std::vector<uint32_t> string_offsets =
++        Read<uint32_t>(Section::kStringOffsets);
++    std::vector<char> string_data = Read<char>(Section::kStringData);
++    auto string_at = [&](uint32_t index) {
++      return std::string(string_data.begin() + string_offsets[index],
++                         string_data.begin() + string_offsets[index + 1]);
++    };
++
++    std::vector<int32_t> ids = Read<int32_t>(Section::kIds);
++    std::vector<uint32_t> roles = Read<uint32_t>(Section::kRoles);
++    std::vector<uint32_t> parents = Read<uint32_t>(Section::kParents);
++    std::vector<uint32_t> states = Read<uint32_t>(Section::kStates);
++    std::vector<uint32_t> actions = Read<uint32_t>(Section::kActions);
++    std::vector<float> bounds = Read<float>(Section::kBounds);
++    std::vector<int32_t> containers =
++        Read<int32_t>(Section::kOffsetContainers);
++    std::vector<uint32_t> starts = Read<uint32_t>(Section::kAttributeStarts);
++    std::vector<uint32_t> keys = Read<uint32_t>(Section::kAttributeKeys);
++    std::vector<uint8_t> kinds = Read<uint8_t>(Section::kAttributeKinds);
++    std::vector<uint32_t> values = Read<uint32_t>(Section::kAttributeValues);
++    std::vector<uint32_t> lists = Read<uint32_t>(Section::kListValues);
++    std::vector<uint32_t> state_names = Read<uint32_t>(Section::kStateNames);
++    std::vector<uint32_t> action_names =
++        Read<uint32_t>(Section::kActionNames);
++
++    size_t count = Header(2);
++    std::vector<ui::AXNodeData> nodes(count);
++    for (size_t i = 0; i < count; ++i) {
++      ui::AXNodeData& node = nodes[i];
++      node.id = ids[i];
++      node.role =
++          ui::ParseAXEnum<ax::mojom::Role>(string_at(roles[i]).c_str());
++      if (parents[i] != AXTreeColumnarEncoder::kNone) {
++        nodes[parents[i]].child_ids.push_back(node.id);
++      }
++      for (size_t bit = 0; bit < 64; ++bit) {
++        if (!states.empty() && (states[2 * i + bit / 32] >> (bit % 32)) & 1) {
++          node.AddState(ui::ParseAXEnum<ax::mojom::State>(
++              string_at(state_names[bit]).c_str()));
++        }
++        if (!actions.empty() &&
++            (actions[2 * i + bit / 32] >> (bit % 32)) & 1) {
++          node.AddAction(ui::ParseAXEnum<ax::mojom::Action>(
++              string_at(action_names[bit]).c_str()));
++        }
++      }
++      if (!bounds.empty()) {
++        node.relative_bounds.bounds =
++            gfx::RectF(bounds[4 * i], bounds[4 * i + 1], bounds[4 * i + 2],
++                       bounds[4 * i + 3]);
++        node.relative_bounds.offset_container_id = containers[i];
++      }
++      for (uint32_t a = starts[i]; a < starts[i + 1]; ++a) {
++        DecodeAttribute(string_at(keys[a]),
++                        static_cast<AttributeKind>(kinds[a]), values[a], lists,
++                        string_at, node);
++      }
++    }
++    return nodes;
++  }
++
++ private:
++  template <typename StringAt>
++  static void DecodeAttribute(const std::string& key,
++                              AttributeKind kind,
++                              uint32_t value,
++                              const std::vector<uint32_t>& lists,
++                              const StringAt& string_at,
++                              ui::AXNodeData& node) {
++    switch (kind) {
++      case AttributeKind::kString:
++        node.AddStringAttribute(
++            ui::ParseAXEnum<ax::mojom::StringAttribute>(key.c_str()),
++            string_at(value));
++        break;
++      case AttributeKind::kInt: {
++        int32_t bits;
++        std::memcpy(&bits, &value, sizeof(bits));
++        node.AddIntAttribute(
++            ui::ParseAXEnum<ax::mojom::IntAttribute>(key.c_str()), bits);
++        break;
++      }
++      case AttributeKind::kFloat: {
++        float bits;
++        std::memcpy(&bits, &value, sizeof(bits));
++        node.AddFloatAttribute(
++            ui::ParseAXEnum<ax::mojom::FloatAttribute>(key.c_str()), bits);
++        break;
++      }
++      case AttributeKind::kBool:
++        node.AddBoolAttribute(
++            ui::ParseAXEnum<ax::mojom::BoolAttribute>(key.c_str()), value);
++        break;
++      case AttributeKind::kIntList: {
++        std::vector<int32_t> items;
++        for (uint32_t i = 0; i < lists[value]; ++i) {
++          items.push_back(static_cast<int32_t>(lists[value + 1 + i]));
++        }
++        node.AddIntListAttribute(
++            ui::ParseAXEnum<ax::mojom::IntListAttribute>(key.c_str()), items);
++        break;
++      }
++      case AttributeKind::kStringList: {
++        std::vector<std::string> items;
++        for (uint32_t i = 0; i < lists[value]; ++i) {
++          items.push_back(string_at(lists[value + 1 + i]));
++        }
++        node.AddStringListAttribute(
++            ui::ParseAXEnum<ax::mojom::StringListAttribute>(key.c_str()),
++            items);
++        break;
++      }
++      case AttributeKind::kHtml:
++        node.html_attributes.emplace_back(key, string_at(value));
++        break;
++    }
++  }
++
++  const std::vector<uint8_t> buffer_;
++};
++
++ui::AXTreeUpdate MakeRichTree() {
++  ui::AXTreeUpdate update;
++  update.root_id = 1;
++  update.nodes.resize(3);
++
++  ui::AXNodeData& root = update.nodes[0];
++  root.id = 1;
++  root.role = ax::mojom::Role::kRootWebArea;
++  root.child_ids = {2, 3};
++  root.SetName("Page");
++  root.relative_bounds.bounds = gfx::RectF(0, 0, 800, 600);
++
++  ui::AXNodeData& button = update.nodes[1];
++  button.id = 2;
++  button.role = ax::mojom::Role::kButton;
++  button.SetName("Save");
++  button.AddState(ax::mojom::State::kFocusable);
++  button.AddAction(ax::mojom::Action::kClick);
++  button.AddStringAttribute(ax::mojom::StringAttribute::kHtmlTag, "button");
++  button.AddIntAttribute(ax::mojom::IntAttribute::kPosInSet, 3);
++  button.AddFloatAttribute(ax::mojom::FloatAttribute::kFontSize, 12.5f);
++  button.AddBoolAttribute(ax::mojom::BoolAttribute::kBusy, true);
++  button.AddIntListAttribute(ax::mojom::IntListAttribute::kLabelledbyIds,
++                             {3, -1});
++  button.AddStringListAttribute(
++      ax::mojom::StringListAttribute::kCustomActionDescriptions,
++      {"Save", "Save as"});
++  button.html_attributes.emplace_back("data-x", "1");
++  button.relative_bounds.bounds = gfx::RectF(10.5f, 20, 30, 40);
++  button.relative_bounds.offset_container_id = 1;
++
++  ui::AXNodeData& text = update.nodes[2];
++  text.id = 3;
++  text.role = ax::mojom::Role::kStaticText;
++  text.SetName("Save");
++  text.AddState(ax::mojom::State::kEditable);
++  return update;
++}
++
++std::vector<ui::AXNodeData> RoundTrip(const ui::AXTreeUpdate& update,
++                                      const AXTreeProjection& projection) {
++  std::vector<AXTreeProjection::Entry> entries = projection.Select(update);
++  ColumnarReader reader(
++      AXTreeColumnarEncoder::Encode(update, projection, entries));
++  EXPECT_EQ(AXTreeColumnarEncoder::kMagic, reader.Header(0));
++  EXPECT_EQ(AXTreeColumnarEncoder::kVersion, reader.Header(1));
++  EXPECT_EQ(static_cast<uint32_t>(update.root_id), reader.Header(3));
++  EXPECT_EQ(static_cast<uint32_t>(Section::kCount), reader.Header(4));
++  return reader.Decode();
++}
++
++TEST(BrowserOSAXTreeEncoderTest, RoundTripsEveryField) {
++  ui::AXTreeUpdate update = MakeRichTree();
++  std::vector<ui::AXNodeData> decoded =
++      RoundTrip(update, AXTreeProjection());
++  ASSERT_EQ(update.nodes.size(), decoded.size());
++  for (size_t i = 0; i < decoded.size(); ++i) {
++    EXPECT_EQ(update.nodes[i].ToString(), decoded[i].ToString());
++  }
++}
++
++// Strings are stored once however often nodes use them
++TEST(BrowserOSAXTreeEncoderTest, SharesStrings) {
++  ui::AXTreeUpdate update = MakeRichTree();
++  AXTreeProjection projection;
++  ColumnarReader reader(AXTreeColumnarEncoder::Encode(
++      update, projection, projection.Select(update)));
++  std::vector<uint32_t> offsets =
++      reader.Read<uint32_t>(Section::kStringOffsets);
++  std::vector<char> data = reader.Read<char>(Section::kStringData);
++  size_t saves = 0;
++  for (size_t i = 0; i + 1 < offsets.size(); ++i) {
++    if (std::string(data.begin() + offsets[i],
++                    data.begin() + offsets[i + 1]) == "Save") {
++      ++saves;
++    }
++  }
++  EXPECT_EQ(1u, saves);
++}
++
++TEST(BrowserOSAXTreeEncoderTest, LeavesOutExcludedGroups) {
++  browser_os::AccessibilityTreeOptions options;
++  options.fields = std::vector<browser_os::AccessibilityTreeField>{
++      browser_os::AccessibilityTreeField::kName};
++  std::string error;
++  std::optional<AXTreeProjection> projection =
++      AXTreeProjection::FromOptions(options, &error);
++  ASSERT_TRUE(projection) << error;
++
++  ui::AXTreeUpdate update = MakeRichTree();
++  ColumnarReader reader(AXTreeColumnarEncoder::Encode(
++      update, *projection, projection->Select(update)));
++  EXPECT_TRUE(reader.Read<uint32_t>(Section::kStates).empty());
++  EXPECT_TRUE(reader.Read<float>(Section::kBounds).empty());
++  // Only the names are left
++  EXPECT_EQ(3u, reader.Read<uint32_t>(Section::kAttributeKeys).size());
++}
++
++TEST(BrowserOSAXTreeEncoderTest, RoundTripsCorpus) {
++  std::optional<ui::AXTreeUpdate> update = LoadAXCorpus(kNewsPageCorpus);
++  ASSERT_TRUE(update);
++  std::vector<ui::AXNodeData> decoded =
++      RoundTrip(*update, AXTreeProjection());
++  ASSERT_EQ(update->nodes.size(), decoded.size());
++  for (size_t i = 0; i < decoded.size(); ++i) {
++    ASSERT_EQ(update->nodes[i].ToString(), decoded[i].ToString()) << i;
++  }
++}
++
++}  // namespace
++
++}  // namespace api
++}  // namespace extensions
@@ -0,0 +1,222 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_ax_tree_projection.cc b/chrome/browser/extensions/api/browser_os/browser_os_ax_tree_projection.cc
+new file mode 100644
+index 0000000000000..f116d73f1d2eb
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_ax_tree_projection.cc
+@@ -0,0 +1,216 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_ax_tree_projection.h"
++
++#include <algorithm>
++#include <unordered_map>
++#include <utility>
++
++#include "base/numerics/safe_conversions.h"
++#include "base/strings/strcat.h"
++#include "ui/accessibility/ax_enum_util.h"
++#include "ui/accessibility/ax_enums.mojom.h"
++#include "ui/accessibility/ax_node_data.h"
++#include "ui/accessibility/ax_tree_update.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++AXTreeProjection::Group ToGroup(browser_os::AccessibilityTreeField field) {
++  switch (field) {
++    case browser_os::AccessibilityTreeField::kStates:
++      return AXTreeProjection::kStates;
++    case browser_os::AccessibilityTreeField::kActions:
++      return AXTreeProjection::kActions;
++    case browser_os::AccessibilityTreeField::kBounds:
++      return AXTreeProjection::kBounds;
++    case browser_os::AccessibilityTreeField::kName:
++      return AXTreeProjection::kName;
++    case browser_os::AccessibilityTreeField::kStringAttributes:
++      return AXTreeProjection::kStringAttributes;
++    case browser_os::AccessibilityTreeField::kIntAttributes:
++      return AXTreeProjection::kIntAttributes;
++    case browser_os::AccessibilityTreeField::kFloatAttributes:
++      return AXTreeProjection::kFloatAttributes;
++    case browser_os::AccessibilityTreeField::kBoolAttributes:
++      return AXTreeProjection::kBoolAttributes;
++    case browser_os::AccessibilityTreeField::kIntListAttributes:
++      return AXTreeProjection::kIntListAttributes;
++    case browser_os::AccessibilityTreeField::kStringListAttributes:
++      return AXTreeProjection::kStringListAttributes;
++    case browser_os::AccessibilityTreeField::kHtmlAttributes:
++      return AXTreeProjection::kHtmlAttributes;
++    case browser_os::AccessibilityTreeField::kInlineTextBoxes:
++      return AXTreeProjection::kInlineTextBoxes;
++    case browser_os::AccessibilityTreeField::kNone:
++      break;
++  }
++  return static_cast<AXTreeProjection::Group>(0);
++}
++
++// Parses role names such as "button" into |roles|.
++bool ParseRoles(const std::vector<std::string>& names,
++                base::flat_set<ax::mojom::Role>& roles,
++                std::string* error) {
++  std::vector<ax::mojom::Role> parsed;
++  parsed.reserve(names.size());
++  for (const std::string& name : names) {
++    std::optional<ax::mojom::Role> role =
++        ui::MaybeParseAXEnum<ax::mojom::Role>(name.c_str());
++    if (!role) {
++      *error = base::StrCat({"Unknown role: ", name});
++      return false;
++    }
++    parsed.push_back(*role);
++  }
++  roles = base::flat_set<ax::mojom::Role>(std::move(parsed));
++  return true;
++}
++
++}  // namespace
++
++// static
++std::optional<AXTreeProjection> AXTreeProjection::FromOptions(
++    const browser_os::AccessibilityTreeOptions& options,
++    std::string* error) {
++  AXTreeProjection projection;
++  if (options.fields) {
++    projection.groups_ = 0;
++    for (browser_os::AccessibilityTreeField field : *options.fields) {
++      projection.groups_ |= ToGroup(field);
++    }
++  }
++  if (options.keep_roles &&
++      !ParseRoles(*options.keep_roles, projection.keep_roles_, error)) {
++    return std::nullopt;
++  }
++  if (options.prune_roles &&
++      !ParseRoles(*options.prune_roles, projection.prune_roles_, error)) {
++    return std::nullopt;
++  }
++  if (options.max_depth) {
++    projection.max_depth_ = std::max(0, *options.max_depth);
++  }
++  return projection;
++}
++
++AXTreeProjection::AXTreeProjection() = default;
++AXTreeProjection::AXTreeProjection(const AXTreeProjection&) = default;
++AXTreeProjection::AXTreeProjection(AXTreeProjection&&) = default;
++AXTreeProjection& AXTreeProjection::operator=(const AXTreeProjection&) =
++    default;
++AXTreeProjection& AXTreeProjection::operator=(AXTreeProjection&&) = default;
++AXTreeProjection::~AXTreeProjection() = default;
++
++ui::AXMode AXTreeProjection::GetAXMode() const {
++  ui::AXMode mode(ui::AXMode::kWebContents);
++  // Names, states and bounds come with basic web contents accessibility;
++  // the attribute maps need extended properties.
++  constexpr uint32_t kExtendedGroups =
++      kStringAttributes | kIntAttributes | kFloatAttributes | kBoolAttributes |
++      kIntListAttributes | kStringListAttributes | kHtmlAttributes;
++  if (groups_ & kExtendedGroups) {
++    mode.set_mode(ui::AXMode::kExtendedProperties, true);
++  }
++  if (Includes(kInlineTextBoxes)) {
++    mode.set_mode(ui::AXMode::kInlineTextBoxes, true);
++  }
++  return mode;
++}
++
++std::vector<AXTreeProjection::Entry> AXTreeProjection::Select(
++    const ui::AXTreeUpdate& tree_update) const {
++  const std::vector<ui::AXNodeData>& nodes = tree_update.nodes;
++
++  std::unordered_map<int32_t, size_t> index_by_id;
++  index_by_id.reserve(nodes.size());
++  for (size_t i = 0; i < nodes.size(); ++i) {
++    index_by_id.emplace(nodes[i].id, i);
++  }
++  std::vector<bool> has_parent(nodes.size(), false);
++  for (const ui::AXNodeData& node : nodes) {
++    for (int32_t child_id : node.child_ids) {
++      if (auto it = index_by_id.find(child_id); it != index_by_id.end()) {
++        has_parent[it->second] = true;
++      }
++    }
++  }
++
++  std::vector<Entry> result;
++  result.reserve(nodes.size());
++  std::vector<bool> visited(nodes.size(), false);
++
++  struct Pending {
++    size_t index;
++    uint32_t parent;
++    int depth;
++  };
++  std::vector<Pending> stack;
++  auto walk_from = [&](size_t start) {
++    stack.push_back({start, kNoParent, 0});
++    while (!stack.empty()) {
++      Pending pending = stack.back();
++      stack.pop_back();
++      if (visited[pending.index]) {
++        continue;
++      }
++      visited[pending.index] = true;
++
++      // Dropping a node here drops its subtree, since its children are
++      // never pushed.
++      const ui::AXNodeData& node = nodes[pending.index];
++      if (prune_roles_.contains(node.role) ||
++          (node.role == ax::mojom::Role::kInlineTextBox &&
++           !Includes(kInlineTextBoxes)) ||
++          (max_depth_ && pending.depth > *max_depth_)) {
++        continue;
++      }
++
++      uint32_t child_parent = pending.parent;
++      if (keep_roles_.empty() || keep_roles_.contains(node.role)) {
++        child_parent = base::checked_cast<uint32_t>(result.size());
++        result.push_back({pending.index, pending.parent});
++      }
++
++      for (auto it = node.child_ids.rbegin(); it != node.child_ids.rend();
++           ++it) {
++        auto child = index_by_id.find(*it);
++        if (child != index_by_id.end() && !visited[child->second]) {
++          stack.push_back({child->second, child_parent, pending.depth + 1});
++        }
++      }
++    }
++  };
++
++  if (auto root = index_by_id.find(tree_update.root_id);
++      root != index_by_id.end()) {
++    walk_from(root->second);
++  }
++  for (size_t i = 0; i < nodes.size(); ++i) {
++    if (!visited[i] && !has_parent[i]) {
++      walk_from(i);
++    }
++  }
++  return result;
++}
++
++// static
++std::vector<std::vector<int32_t>> AXTreeProjection::GetChildIds(
++    const ui::AXTreeUpdate& tree_update,
++    const std::vector<Entry>& entries) {
++  // Select() emits children after their parent and in order
++  std::vector<std::vector<int32_t>> child_ids(entries.size());
++  for (const Entry& entry : entries) {
++    if (entry.parent != kNoParent) {
++      child_ids[entry.parent].push_back(tree_update.nodes[entry.index].id);
++    }
++  }
++  return child_ids;
++}
++
++}  // namespace api
++}  // namespace extensions
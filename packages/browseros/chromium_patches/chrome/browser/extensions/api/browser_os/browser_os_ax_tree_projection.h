@@ -0,0 +1,117 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_ax_tree_projection.h b/chrome/browser/extensions/api/browser_os/browser_os_ax_tree_projection.h
+new file mode 100644
+index 0000000000000..ab0a854de0ecc
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_ax_tree_projection.h
+@@ -0,0 +1,111 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_AX_TREE_PROJECTION_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_AX_TREE_PROJECTION_H_
++
++#include <cstddef>
++#include <cstdint>
++#include <optional>
++#include <string>
++#include <vector>
++
++#include "base/containers/flat_set.h"
++#include "chrome/common/extensions/api/browser_os.h"
++#include "ui/accessibility/ax_enums.mojom-forward.h"
++#include "ui/accessibility/ax_mode.h"
++
++namespace ui {
++struct AXTreeUpdate;
++}  // namespace ui
++
++namespace extensions {
++namespace api {
++
++// The part of an accessibility tree a getAccessibilityTree caller asked
++// for: which field groups to serialize, which roles to keep or prune, and
++// how deep to go.
++//
++// The projection is applied twice. Up front, GetAXMode() leaves out renderer
++// work nobody needs, such as inline text boxes. After the tree arrives,
++// Select() picks the nodes to serialize and serializers check Includes()
++// before writing each field group.
++class AXTreeProjection {
++ public:
++  // Field groups, as bits.
++  enum Group : uint32_t {
++    kStates = 1u << 0,
++    kActions = 1u << 1,
++    kBounds = 1u << 2,
++    // Only the name string attribute.
++    kName = 1u << 3,
++    kStringAttributes = 1u << 4,
++    kIntAttributes = 1u << 5,
++    kFloatAttributes = 1u << 6,
++    kBoolAttributes = 1u << 7,
++    kIntListAttributes = 1u << 8,
++    kStringListAttributes = 1u << 9,
++    kHtmlAttributes = 1u << 10,
++    // Inline text box nodes, which often double the node count.
++    kInlineTextBoxes = 1u << 11,
++    kAllGroups = (1u << 12) - 1,
++  };
++
++  // Parent of an Entry that has no selected ancestor.
++  static constexpr uint32_t kNoParent = 0xFFFFFFFF;
++
++  // A node selected for output.
++  struct Entry {
++    // Index into AXTreeUpdate::nodes.
++    size_t index;
++    // Position in the Select() result of the nearest selected ancestor, or
++    // kNoParent.
++    uint32_t parent;
++  };
++
++  // Returns the projection described by |options|, or nullopt with |error|
++  // set if a role name is not recognized.
++  static std::optional<AXTreeProjection> FromOptions(
++      const browser_os::AccessibilityTreeOptions& options,
++      std::string* error);
++
++  // Selects everything, the same as no options.
++  AXTreeProjection();
++  AXTreeProjection(const AXTreeProjection&);
++  AXTreeProjection(AXTreeProjection&&);
++  AXTreeProjection& operator=(const AXTreeProjection&);
++  AXTreeProjection& operator=(AXTreeProjection&&);
++  ~AXTreeProjection();
++
++  bool Includes(Group group) const { return (groups_ & group) != 0; }
++
++  // Returns the mode to request the tree with.
++  ui::AXMode GetAXMode() const;
++
++  // Returns the selected nodes of |tree_update| in depth-first order from
++  // the root, followed by subtrees the root does not reach. Pruned roles
++  // drop their whole subtree. Nodes deeper than the max depth are dropped.
++  // Nodes whose role is not kept are skipped but their descendants are
++  // still considered, attached to the nearest selected ancestor.
++  std::vector<Entry> Select(const ui::AXTreeUpdate& tree_update) const;
++
++  // Returns the child ids of each of |entries| in the projected tree, in
++  // child order.
++  static std::vector<std::vector<int32_t>> GetChildIds(
++      const ui::AXTreeUpdate& tree_update,
++      const std::vector<Entry>& entries);
++
++ private:
++  uint32_t groups_ = kAllGroups;
++  // Empty keeps every role.
++  base::flat_set<ax::mojom::Role> keep_roles_;
++  base::flat_set<ax::mojom::Role> prune_roles_;
++  // Depth of the root is 0.
++  std::optional<int> max_depth_;
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_AX_TREE_PROJECTION_H_
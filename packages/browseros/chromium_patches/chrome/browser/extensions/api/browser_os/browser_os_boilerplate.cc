@@ -0,0 +1,240 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_boilerplate.cc b/chrome/browser/extensions/api/browser_os/browser_os_boilerplate.cc
+new file mode 100644
+index 0000000000000..485f7822900a3
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_boilerplate.cc
+@@ -0,0 +1,234 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_boilerplate.h"
++
++#include <functional>
++#include <memory>
++#include <unordered_map>
++#include <utility>
++
++#include "base/check.h"
++#include "base/hash/hash.h"
++#include "base/logging.h"
++#include "base/supports_user_data.h"
++#include "content/public/browser/browser_context.h"
++#include "ui/accessibility/ax_enums.mojom.h"
++#include "ui/accessibility/ax_node_data.h"
++#include "ui/accessibility/ax_tree_update.h"
++#include "url/origin.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++const char kRegistryUserDataKey[] = "browseros_boilerplate_registry";
++
++// Page chrome sits near the top of the tree; deeper subtrees are not
++// considered, which keeps the per-origin LRU for what matters.
++constexpr int kMaxCandidateDepth = 8;
++
++struct RegistryHolder : public base::SupportsUserData::Data {
++  scoped_refptr<BoilerplateRegistry> registry =
++      base::MakeRefCounted<BoilerplateRegistry>();
++};
++
++// Roles that hold the page's own content and are never collapsed.
++bool IsContentRoot(ax::mojom::Role role) {
++  return role == ax::mojom::Role::kRootWebArea ||
++         role == ax::mojom::Role::kWebArea ||
++         role == ax::mojom::Role::kMain ||
++         role == ax::mojom::Role::kArticle;
++}
++
++}  // namespace
++
++// static
++scoped_refptr<BoilerplateRegistry> BoilerplateRegistry::GetForBrowserContext(
++    content::BrowserContext* context) {
++  auto* holder =
++      static_cast<RegistryHolder*>(context->GetUserData(kRegistryUserDataKey));
++  if (!holder) {
++    auto new_holder = std::make_unique<RegistryHolder>();
++    holder = new_holder.get();
++    context->SetUserData(kRegistryUserDataKey, std::move(new_holder));
++  }
++  return holder->registry;
++}
++
++BoilerplateRegistry::BoilerplateRegistry() = default;
++BoilerplateRegistry::~BoilerplateRegistry() = default;
++
++base::flat_set<uint64_t> BoilerplateRegistry::RecordPage(
++    const GURL& page,
++    const std::vector<uint64_t>& hashes,
++    uint64_t* revision) {
++  url::Origin origin = url::Origin::Create(page);
++  if (origin.opaque()) {
++    if (revision) {
++      *revision = this->revision();
++    }
++    return {};
++  }
++  size_t page_id = std::hash<std::string>()(page.GetWithoutRef().spec());
++
++  std::vector<uint64_t> repeated;
++  base::AutoLock lock(lock_);
++  std::string origin_key = origin.Serialize();
++  auto origin_it = origins_.Get(origin_key);
++  bool changed = false;
++  if (origin_it == origins_.end()) {
++    origin_it =
++        origins_.Put(origin_key, OriginSubtrees(kMaxSubtreesPerOrigin));
++    changed = true;
++  }
++  OriginSubtrees& subtrees = origin_it->second;
++
++  for (uint64_t hash : hashes) {
++    auto it = subtrees.Get(hash);
++    if (it == subtrees.end()) {
++      subtrees.Put(hash, SeenPages({page_id}));
++      changed = true;
++      continue;
++    }
++    SeenPages& seen = it->second;
++    // A page extracted again does not count as an earlier page of itself
++    bool counted = seen.contains(page_id);
++    size_t earlier_pages = seen.size() - (counted ? 1 : 0);
++    if (!counted && seen.size() <= kMinEarlierPages) {
++      seen.insert(page_id);
++      changed = true;
++    }
++    if (earlier_pages >= kMinEarlierPages) {
++      repeated.push_back(hash);
++    }
++  }
++  if (changed) {
++    ++revision_;
++  }
++  if (revision) {
++    *revision = revision_;
++  }
++  return base::flat_set<uint64_t>(std::move(repeated));
++}
++
++uint64_t BoilerplateRegistry::revision() const {
++  base::AutoLock lock(lock_);
++  return revision_;
++}
++
++BoilerplateSink::BoilerplateSink(PageExtractionSink* inner,
++                                 scoped_refptr<BoilerplateRegistry> registry,
++                                 const GURL& page)
++    : inner_(inner), registry_(std::move(registry)), page_(page) {
++  DCHECK(inner_);
++  DCHECK(registry_);
++}
++
++BoilerplateSink::~BoilerplateSink() = default;
++
++void BoilerplateSink::Begin(const ui::AXTreeUpdate& tree_update) {
++  const std::vector<ui::AXNodeData>& nodes = tree_update.nodes;
++  nodes_ = nodes.data();
++  omit_.assign(nodes.size(), false);
++  inner_->Begin(tree_update);
++
++  std::unordered_map<int32_t, size_t> index_by_id;
++  index_by_id.reserve(nodes.size());
++  for (size_t i = 0; i < nodes.size(); ++i) {
++    index_by_id.emplace(nodes[i].id, i);
++  }
++  auto root = index_by_id.find(tree_update.root_id);
++  if (root == index_by_id.end()) {
++    return;
++  }
++
++  // Preorder from the root, so every node comes before its descendants
++  std::vector<size_t> order;
++  std::vector<int> depth(nodes.size(), -1);
++  std::vector<size_t> stack = {root->second};
++  depth[root->second] = 0;
++  while (!stack.empty()) {
++    size_t index = stack.back();
++    stack.pop_back();
++    order.push_back(index);
++    for (int32_t child_id : nodes[index].child_ids) {
++      auto child = index_by_id.find(child_id);
++      if (child != index_by_id.end() && depth[child->second] < 0) {
++        depth[child->second] = depth[index] + 1;
++        stack.push_back(child->second);
++      }
++    }
++  }
++
++  // Hash and size each subtree from its children, deepest first
++  std::vector<uint64_t> hash(nodes.size(), 0);
++  std::vector<size_t> size(nodes.size(), 0);
++  std::vector<uint64_t> candidates;
++  for (auto it = order.rbegin(); it != order.rend(); ++it) {
++    const ui::AXNodeData& node = nodes[*it];
++    uint64_t subtree_hash = base::HashInts64(
++        static_cast<uint64_t>(node.role),
++        base::FastHash(
++            node.GetStringAttribute(ax::mojom::StringAttribute::kName)));
++    size_t subtree_size = 1;
++    for (int32_t child_id : node.child_ids) {
++      auto child = index_by_id.find(child_id);
++      if (child != index_by_id.end() && depth[child->second] > depth[*it]) {
++        subtree_hash = base::HashInts64(subtree_hash, hash[child->second]);
++        subtree_size += size[child->second];
++      }
++    }
++    hash[*it] = subtree_hash;
++    size[*it] = subtree_size;
++    if (!node.IsIgnored() && subtree_size >= kMinSubtreeNodes &&
++        depth[*it] <= kMaxCandidateDepth && !IsContentRoot(node.role)) {
++      candidates.push_back(subtree_hash);
++    }
++  }
++
++  base::flat_set<uint64_t> repeated =
++      registry_->RecordPage(page_, candidates, &revision_);
++  if (repeated.empty()) {
++    return;
++  }
++  for (size_t index : order) {
++    const ui::AXNodeData& node = nodes[index];
++    omit_[index] = !node.IsIgnored() && size[index] >= kMinSubtreeNodes &&
++                   depth[index] <= kMaxCandidateDepth &&
++                   !IsContentRoot(node.role) && repeated.contains(hash[index]);
++  }
++  LOG(INFO) << "[browseros] " << repeated.size()
++            << " repeated subtrees on " << page_.GetWithoutRef().spec();
++}
++
++bool BoilerplateSink::EnterNode(const ui::AXNodeData& node) {
++  size_t index = static_cast<size_t>(&node - nodes_.get());
++  if (omit_[index]) {
++    ++omitted_;
++    inner_->OnSubtreeOmitted(node);
++    return false;
++  }
++  return inner_->EnterNode(node);
++}
++
++void BoilerplateSink::LeaveNode(const ui::AXNodeData& node) {
++  inner_->LeaveNode(node);
++}
++
++void BoilerplateSink::OnSubtreeOmitted(const ui::AXNodeData& node) {
++  inner_->OnSubtreeOmitted(node);
++}
++
++void BoilerplateSink::Finish() {
++  inner_->Finish();
++}
++
++bool BoilerplateSink::IsDone() const {
++  return inner_->IsDone();
++}
++
++}  // namespace api
++}  // namespace extensions
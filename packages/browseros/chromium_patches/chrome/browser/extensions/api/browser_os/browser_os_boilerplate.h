@@ -0,0 +1,135 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_boilerplate.h b/chrome/browser/extensions/api/browser_os/browser_os_boilerplate.h
+new file mode 100644
+index 0000000000000..7781e68100d65
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_boilerplate.h
+@@ -0,0 +1,129 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_BOILERPLATE_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_BOILERPLATE_H_
++
++#include <cstddef>
++#include <cstdint>
++#include <string>
++#include <vector>
++
++#include "base/containers/flat_set.h"
++#include "base/containers/lru_cache.h"
++#include "base/memory/raw_ptr.h"
++#include "base/memory/ref_counted.h"
++#include "base/synchronization/lock.h"
++#include "base/thread_annotations.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_page_extractor.h"
++#include "url/gurl.h"
++
++namespace content {
++class BrowserContext;
++}  // namespace content
++
++namespace extensions {
++namespace api {
++
++// Remembers, per origin, which subtrees earlier pages had, so the header,
++// menus and footer a site repeats on every page can be left out.
++//
++// Subtrees are identified by a structural hash of role, name and child
++// hashes. A subtree counts as boilerplate once it was seen on
++// kMinEarlierPages other pages of the origin. Origins and their subtrees are
++// kept in LRUs, so memory stays bounded however many sites are visited.
++//
++// One registry per BrowserContext, so incognito pages never inform regular
++// ones. Thread-safe.
++class BoilerplateRegistry
++    : public base::RefCountedThreadSafe<BoilerplateRegistry> {
++ public:
++  static constexpr size_t kMinEarlierPages = 2;
++  static constexpr size_t kMaxOrigins = 64;
++  static constexpr size_t kMaxSubtreesPerOrigin = 1024;
++
++  // Returns the registry of |context|, creating it on first use. UI thread.
++  static scoped_refptr<BoilerplateRegistry> GetForBrowserContext(
++      content::BrowserContext* context);
++
++  BoilerplateRegistry();
++  BoilerplateRegistry(const BoilerplateRegistry&) = delete;
++  BoilerplateRegistry& operator=(const BoilerplateRegistry&) = delete;
++
++  // Records that |page| has subtrees with |hashes| and returns the ones
++  // that count as boilerplate for it, judging by earlier pages only. If
++  // |revision| is set, it gets revision() as of right after the page was
++  // recorded.
++  base::flat_set<uint64_t> RecordPage(const GURL& page,
++                                      const std::vector<uint64_t>& hashes,
++                                      uint64_t* revision = nullptr);
++
++  // Changes whenever recording a page changes what the registry knows, and
++  // so possibly what it reports for other pages. A page's result can be
++  // reused while the revision stays the one RecordPage() gave for it.
++  uint64_t revision() const;
++
++ private:
++  friend class base::RefCountedThreadSafe<BoilerplateRegistry>;
++  ~BoilerplateRegistry();
++
++  // Distinct pages a subtree was seen on, by URL hash. Once it holds more
++  // than kMinEarlierPages, every page has enough others, so it stops
++  // growing.
++  using SeenPages = base::flat_set<size_t>;
++  using OriginSubtrees = base::HashingLRUCache<uint64_t, SeenPages>;
++
++  mutable base::Lock lock_;
++  base::HashingLRUCache<std::string, OriginSubtrees> origins_
++      GUARDED_BY(lock_){kMaxOrigins};
++  uint64_t revision_ GUARDED_BY(lock_) = 0;
++};
++
++// Hides subtrees that BoilerplateRegistry reports as repeated from the
++// inner sink, which gets OnSubtreeOmitted() for each instead.
++//
++// Only subtrees of at least kMinSubtreeNodes nodes are considered, and
++// never the main content landmarks, so short repeated phrases and the
++// article itself always stay.
++class BoilerplateSink : public PageExtractionSink {
++ public:
++  static constexpr size_t kMinSubtreeNodes = 8;
++
++  BoilerplateSink(PageExtractionSink* inner,
++                  scoped_refptr<BoilerplateRegistry> registry,
++                  const GURL& page);
++  ~BoilerplateSink() override;
++
++  BoilerplateSink(const BoilerplateSink&) = delete;
++  BoilerplateSink& operator=(const BoilerplateSink&) = delete;
++
++  size_t omitted() const { return omitted_; }
++  // Registry revision the omitted subtrees were chosen at.
++  uint64_t revision() const { return revision_; }
++
++  // PageExtractionSink:
++  void Begin(const ui::AXTreeUpdate& tree_update) override;
++  bool EnterNode(const ui::AXNodeData& node) override;
++  void LeaveNode(const ui::AXNodeData& node) override;
++  void OnSubtreeOmitted(const ui::AXNodeData& node) override;
++  void Finish() override;
++  bool IsDone() const override;
++
++ private:
++  const raw_ptr<PageExtractionSink> inner_;
++  const scoped_refptr<BoilerplateRegistry> registry_;
++  const GURL page_;
++
++  // Base of tree_update.nodes, to turn nodes back into indices.
++  raw_ptr<const ui::AXNodeData, AllowPtrArithmetic> nodes_ = nullptr;
++  // Subtrees to hide, by node index.
++  std::vector<bool> omit_;
++  size_t omitted_ = 0;
++  uint64_t revision_ = 0;
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_BOILERPLATE_H_
@@ -0,0 +1,148 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_boilerplate_unittest.cc b/chrome/browser/extensions/api/browser_os/browser_os_boilerplate_unittest.cc
+new file mode 100644
+index 0000000000000..5d151f3251d40
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_boilerplate_unittest.cc
+@@ -0,0 +1,142 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_boilerplate.h"
++
++#include <optional>
++#include <string>
++#include <vector>
++
++#include "base/strings/strcat.h"
++#include "base/strings/string_number_conversions.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_ax_corpus.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_page_extractor.h"
++#include "testing/gtest/include/gtest/gtest.h"
++#include "ui/accessibility/ax_tree_update.h"
++#include "url/gurl.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++using Hashes = base::flat_set<uint64_t>;
++
++class BrowserOSBoilerplateRegistryTest : public testing::Test {
++ protected:
++  Hashes Record(const char* url, const std::vector<uint64_t>& hashes) {
++    return registry_->RecordPage(GURL(url), hashes);
++  }
++
++  scoped_refptr<BoilerplateRegistry> registry_ =
++      base::MakeRefCounted<BoilerplateRegistry>();
++};
++
++TEST_F(BrowserOSBoilerplateRegistryTest, RepeatedAfterEnoughEarlierPages) {
++  EXPECT_EQ(Hashes(), Record("https://a.com/1", {1, 2}));
++  EXPECT_EQ(Hashes(), Record("https://a.com/2", {1, 3}));
++  EXPECT_EQ(Hashes({1}), Record("https://a.com/3", {1, 2, 4}));
++  // Page 1 now has two other pages with 1, and one with 2
++  EXPECT_EQ(Hashes({1}), Record("https://a.com/1", {1, 2}));
++}
++
++// A page extracted again is not an earlier page of itself
++TEST_F(BrowserOSBoilerplateRegistryTest, RevisitsDoNotCount) {
++  EXPECT_EQ(Hashes(), Record("https://a.com/a", {1}));
++  EXPECT_EQ(Hashes(), Record("https://a.com/b", {1}));
++  EXPECT_EQ(Hashes(), Record("https://a.com/a", {1}));
++  EXPECT_EQ(Hashes(), Record("https://a.com/a#top", {1}));
++  EXPECT_EQ(Hashes({1}), Record("https://a.com/c", {1}));
++}
++
++TEST_F(BrowserOSBoilerplateRegistryTest, OriginsAreSeparate) {
++  Record("https://a.com/1", {1});
++  Record("https://a.com/2", {1});
++  EXPECT_EQ(Hashes(), Record("https://b.com/1", {1}));
++  EXPECT_EQ(Hashes(), Record("http://a.com/3", {1}));
++  EXPECT_EQ(Hashes({1}), Record("https://a.com/3", {1}));
++}
++
++TEST_F(BrowserOSBoilerplateRegistryTest, OpaqueOriginsAreNotRecorded) {
++  uint64_t revision = 1234;
++  for (int i = 0; i < 4; ++i) {
++    EXPECT_EQ(Hashes(), registry_->RecordPage(GURL("data:text/html,x"), {1},
++                                              &revision));
++  }
++  EXPECT_EQ(0u, revision);
++  EXPECT_EQ(0u, registry_->revision());
++}
++
++// The revision moves only when a page teaches the registry something
++TEST_F(BrowserOSBoilerplateRegistryTest, Revision) {
++  uint64_t revision = 0;
++  registry_->RecordPage(GURL("https://a.com/1"), {1}, &revision);
++  EXPECT_EQ(registry_->revision(), revision);
++  uint64_t first = revision;
++
++  registry_->RecordPage(GURL("https://a.com/1"), {1}, &revision);
++  EXPECT_EQ(first, revision);
++
++  registry_->RecordPage(GURL("https://a.com/2"), {1}, &revision);
++  EXPECT_GT(revision, first);
++  uint64_t second = revision;
++
++  registry_->RecordPage(GURL("https://a.com/2"), {1, 2}, &revision);
++  EXPECT_GT(revision, second);
++  EXPECT_EQ(registry_->revision(), revision);
++}
++
++// A page with a navigation bar shared across the site and its own article
++std::string SitePage(int page) {
++  std::string text =
++      "1\t-\trootWebArea\t-\tPage\n"
++      "2\t1\tnavigation\t-\t\n"
++      "3\t2\tlist\t-\t\n";
++  int id = 4;
++  for (int i = 0; i < 4; ++i, id += 2) {
++    std::string item = base::NumberToString(id);
++    base::StrAppend(&text, {item, "\t3\tlistItem\t-\t\n",
++                            base::NumberToString(id + 1), "\t", item,
++                            "\tlink\t-\tSection ", base::NumberToString(i),
++                            "\n"});
++  }
++  base::StrAppend(&text, {"20\t1\tmain\t-\t\n", "21\t20\tparagraph\t-\t\n",
++                          "22\t21\tstaticText\t-\tStory ",
++                          base::NumberToString(page), "\n"});
++  return text;
++}
++
++TEST(BrowserOSBoilerplateSinkTest, OmitsRepeatedNavigation) {
++  auto registry = base::MakeRefCounted<BoilerplateRegistry>();
++  PageExtractionOptions options;
++  options.boilerplate = registry;
++
++  for (int page = 1; page <= 3; ++page) {
++    SCOPED_TRACE(page);
++    std::optional<ui::AXTreeUpdate> update = ParseAXCorpus(SitePage(page));
++    ASSERT_TRUE(update);
++    options.page_url =
++        GURL(base::StrCat({"https://a.com/", base::NumberToString(page)}));
++
++    MarkdownSink sink;
++    PageExtractionStats stats;
++    ASSERT_TRUE(PageExtractor::Extract(*update, &sink, options,
++                                       /*cancel=*/nullptr, &stats));
++    std::u16string text = sink.TakeText();
++    EXPECT_NE(std::u16string::npos,
++              text.find(u"Story " + base::NumberToString16(page)));
++
++    bool omitted = page == 3;
++    EXPECT_EQ(omitted ? 1u : 0u, stats.omitted_subtrees);
++    EXPECT_EQ(omitted, text.find(u"[Repeated navigation omitted]") !=
++                           std::u16string::npos);
++    EXPECT_EQ(omitted, text.find(u"Section 0") == std::u16string::npos);
++    EXPECT_EQ(registry->revision(), stats.boilerplate_revision);
++  }
++}
++
++}  // namespace
++
++}  // namespace api
++}  // namespace extensions
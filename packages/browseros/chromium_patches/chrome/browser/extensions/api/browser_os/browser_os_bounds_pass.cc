@@ -0,0 +1,188 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_bounds_pass.cc b/chrome/browser/extensions/api/browser_os/browser_os_bounds_pass.cc
+new file mode 100644
+index 0000000000000..05f23f101b50d
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_bounds_pass.cc
+@@ -0,0 +1,182 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_bounds_pass.h"
++
++#include "ui/accessibility/ax_enums.mojom.h"
++#include "ui/accessibility/ax_node.h"
++#include "ui/accessibility/ax_node_data.h"
++#include "ui/accessibility/ax_tree.h"
++#include "ui/gfx/geometry/transform.h"
++
++namespace extensions {
++namespace api {
++
++AXBoundsPass::AXBoundsPass(const ui::AXTree* tree) : tree_(tree) {}
++
++AXBoundsPass::~AXBoundsPass() = default;
++
++AXBoundsPass::NodeBounds AXBoundsPass::Compute(const ui::AXNode* node,
++                                               bool clip_bounds) {
++  NodeBounds result;
++  if (!tree_ || !node) {
++    return result;
++  }
++
++  // Fast path: a non-empty node under a translation-only chain is its own
++  // bounds moved by the chain offset and cut by the chain clip.
++  gfx::RectF bounds = node->data().relative_bounds.bounds;
++  if (!bounds.IsEmpty()) {
++    const ui::AXNode* container = GetContainer(node);
++    ChainState state = ComputeChainState(
++        node, container, container ? &GetChainState(container) : nullptr);
++    if (state.linear) {
++      bounds.Offset(state.offset);
++      if (!state.has_clip) {
++        result.bounds = bounds;
++        return result;
++      }
++      gfx::RectF clipped = bounds;
++      clipped.Intersect(state.clip);
++      // An empty intersection means the node is clipped out somewhere in the
++      // chain, which needs the edge snapping done by RelativeToTreeBounds.
++      if (!clipped.IsEmpty()) {
++        result.bounds = clip_bounds ? clipped : bounds;
++        return result;
++      }
++    }
++  }
++
++  result.bounds = tree_->RelativeToTreeBounds(node, gfx::RectF(),
++                                              &result.offscreen, clip_bounds);
++  return result;
++}
++
++std::vector<AXBoundsPass::NodeBounds> AXBoundsPass::ComputeAll(
++    base::span<const ui::AXNode* const> nodes,
++    bool clip_bounds,
++    float device_scale_factor) {
++  std::vector<NodeBounds> results(nodes.size());
++
++  // Sweep into a flat x, y, width, height array so the unit conversion below
++  // is a single loop over floats.
++  std::vector<float> coords(nodes.size() * 4);
++  for (size_t i = 0; i < nodes.size(); ++i) {
++    NodeBounds node_bounds = Compute(nodes[i], clip_bounds);
++    results[i].offscreen = node_bounds.offscreen;
++    coords[i * 4] = node_bounds.bounds.x();
++    coords[i * 4 + 1] = node_bounds.bounds.y();
++    coords[i * 4 + 2] = node_bounds.bounds.width();
++    coords[i * 4 + 3] = node_bounds.bounds.height();
++  }
++
++  // Convert physical pixels to CSS pixels
++  if (device_scale_factor > 0.0f && device_scale_factor != 1.0f) {
++    for (float& value : coords) {
++      value /= device_scale_factor;
++    }
++  }
++
++  for (size_t i = 0; i < nodes.size(); ++i) {
++    results[i].bounds = gfx::RectF(coords[i * 4], coords[i * 4 + 1],
++                                   coords[i * 4 + 2], coords[i * 4 + 3]);
++  }
++  return results;
++}
++
++const AXBoundsPass::ChainState& AXBoundsPass::GetChainState(
++    const ui::AXNode* node) {
++  auto it = chain_states_.find(node->id());
++  if (it != chain_states_.end()) {
++    return it->second;
++  }
++
++  // Collect the unresolved part of the chain, then resolve it top-down so
++  // each container is computed from its already resolved container.
++  std::vector<const ui::AXNode*> chain;
++  for (const ui::AXNode* current = node;
++       current && !chain_states_.contains(current->id());
++       current = GetContainer(current)) {
++    chain.push_back(current);
++  }
++
++  for (size_t i = chain.size(); i-- > 0;) {
++    const ui::AXNode* current = chain[i];
++    const ui::AXNode* container = GetContainer(current);
++    const ChainState* container_state =
++        container ? &chain_states_[container->id()] : nullptr;
++    chain_states_[current->id()] =
++        ComputeChainState(current, container, container_state);
++  }
++  return chain_states_[node->id()];
++}
++
++const ui::AXNode* AXBoundsPass::GetContainer(const ui::AXNode* node) const {
++  const ui::AXNode* container =
++      tree_->GetFromId(node->data().relative_bounds.offset_container_id);
++  if (!container) {
++    container = tree_->root();
++  }
++  if (container == node) {
++    return nullptr;
++  }
++  return container;
++}
++
++AXBoundsPass::ChainState AXBoundsPass::ComputeChainState(
++    const ui::AXNode* node,
++    const ui::AXNode* container,
++    const ChainState* container_state) const {
++  ChainState state;
++
++  gfx::Vector2dF own_offset;
++  if (const auto& transform = node->data().relative_bounds.transform) {
++    if (!transform->IsIdentityOr2dTranslation()) {
++      state.linear = false;
++      return state;
++    }
++    own_offset = transform->To2dTranslation();
++  }
++
++  if (!container) {
++    state.offset = own_offset;
++    return state;
++  }
++  if (!container_state->linear) {
++    state.linear = false;
++    return state;
++  }
++
++  // Same steps as RelativeToTreeBounds: move into the container, undo its
++  // scroll, then clip to it if it clips children.
++  const ui::AXNodeData& container_data = container->data();
++  const gfx::RectF& container_bounds = container_data.relative_bounds.bounds;
++  gfx::Vector2dF step = own_offset + container_bounds.OffsetFromOrigin();
++  int scroll_x = 0;
++  int scroll_y = 0;
++  if (container_data.GetIntAttribute(ax::mojom::IntAttribute::kScrollX,
++                                     &scroll_x) &&
++      container_data.GetIntAttribute(ax::mojom::IntAttribute::kScrollY,
++                                     &scroll_y)) {
++    step -= gfx::Vector2dF(scroll_x, scroll_y);
++  }
++
++  state.offset = step + container_state->offset;
++  state.has_clip = container_state->has_clip;
++  state.clip = container_state->clip;
++  if (container_data.GetBoolAttribute(
++          ax::mojom::BoolAttribute::kClipsChildren)) {
++    gfx::RectF container_clip = container_bounds + container_state->offset;
++    if (state.has_clip) {
++      state.clip.Intersect(container_clip);
++    } else {
++      state.clip = container_clip;
++      state.has_clip = true;
++    }
++  }
++  return state;
++}
++
++}  // namespace api
++}  // namespace extensions
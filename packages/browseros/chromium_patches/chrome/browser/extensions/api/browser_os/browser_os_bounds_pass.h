@@ -0,0 +1,99 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_bounds_pass.h b/chrome/browser/extensions/api/browser_os/browser_os_bounds_pass.h
+new file mode 100644
+index 0000000000000..d70e4034a47c5
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_bounds_pass.h
+@@ -0,0 +1,93 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_BOUNDS_PASS_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_BOUNDS_PASS_H_
++
++#include <cstdint>
++#include <unordered_map>
++#include <vector>
++
++#include "base/containers/span.h"
++#include "base/memory/raw_ptr.h"
++#include "ui/gfx/geometry/rect_f.h"
++#include "ui/gfx/geometry/vector2d_f.h"
++
++namespace ui {
++class AXNode;
++class AXTree;
++}  // namespace ui
++
++namespace extensions {
++namespace api {
++
++// Computes tree-relative bounds for many nodes of one ui::AXTree.
++//
++// AXTree::RelativeToTreeBounds() walks the whole offset container chain for
++// every node. This pass resolves each container's cumulative offset and clip
++// once, top-down, and memoizes it, so every further node under the same
++// container costs a single offset and intersection. Chains that contain a
++// non-translation transform, and nodes whose result needs the edge or
++// empty-bounds fallbacks, are computed with RelativeToTreeBounds() so results
++// always match it.
++//
++// The tree must not change while the pass is alive. Not thread-safe.
++class AXBoundsPass {
++ public:
++  struct NodeBounds {
++    // Bounds in CSS pixels after ComputeAll(), physical pixels otherwise.
++    gfx::RectF bounds;
++    // True if the node is clipped out by a container (see
++    // AXTree::RelativeToTreeBounds).
++    bool offscreen = false;
++  };
++
++  explicit AXBoundsPass(const ui::AXTree* tree);
++  ~AXBoundsPass();
++
++  AXBoundsPass(const AXBoundsPass&) = delete;
++  AXBoundsPass& operator=(const AXBoundsPass&) = delete;
++
++  // Returns the frame-relative bounds of |node| in physical pixels.
++  NodeBounds Compute(const ui::AXNode* node, bool clip_bounds);
++
++  // Returns the bounds of every node in |nodes|, converted to CSS pixels by
++  // dividing by |device_scale_factor|. Null entries produce empty bounds.
++  std::vector<NodeBounds> ComputeAll(base::span<const ui::AXNode* const> nodes,
++                                     bool clip_bounds,
++                                     float device_scale_factor);
++
++ private:
++  // Maps a rect in the coordinate space of a node (before its own transform)
++  // to the tree's root space: rect + offset, then intersected with clip.
++  struct ChainState {
++    // False if the chain has a transform that is not a 2D translation.
++    bool linear = true;
++    gfx::Vector2dF offset;
++    bool has_clip = false;
++    gfx::RectF clip;
++  };
++
++  // Returns the resolved state for the chain starting at |node|, memoizing
++  // it for |node| and every container above it.
++  const ChainState& GetChainState(const ui::AXNode* node);
++
++  // Returns the offset container of |node| as RelativeToTreeBounds() resolves
++  // it, or null if |node| ends the chain.
++  const ui::AXNode* GetContainer(const ui::AXNode* node) const;
++
++  // Computes the state of |node| from the already resolved state of its
++  // container.
++  ChainState ComputeChainState(const ui::AXNode* node,
++                               const ui::AXNode* container,
++                               const ChainState* container_state) const;
++
++  raw_ptr<const ui::AXTree> tree_;
++  std::unordered_map<int32_t, ChainState> chain_states_;
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_BOUNDS_PASS_H_
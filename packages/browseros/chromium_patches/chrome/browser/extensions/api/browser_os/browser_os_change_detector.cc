@@ -1,210 +1,222 @@
 diff --git a/chrome/browser/extensions/api/browser_os/browser_os_change_detector.cc b/chrome/browser/extensions/api/browser_os/browser_os_change_detector.cc
 new file mode 100644
-index 0000000000000..ea45bebcce461
+index 0000000000000..8013d99455936
 --- /dev/null
 +++ b/chrome/browser/extensions/api/browser_os/browser_os_change_detector.cc
-@@ -0,0 +1,205 @@
+@@ -0,0 +1,217 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
 +
 +#include "chrome/browser/extensions/api/browser_os/browser_os_change_detector.h"
 +
++#include <algorithm>
++#include <optional>
++#include <utility>
++
++#include "base/check.h"
 +#include "base/functional/bind.h"
 +#include "base/logging.h"
-+#include "base/run_loop.h"
-+#include "content/public/browser/focused_node_details.h"
-+#include "content/public/browser/navigation_handle.h"
++#include "base/memory/weak_ptr.h"
++#include "chrome/browser/profiles/profile.h"
++#include "components/prefs/pref_service.h"
 +#include "content/public/browser/render_frame_host.h"
 +#include "content/public/browser/web_contents.h"
-+#include "ui/accessibility/ax_updates_and_events.h"
++#include "url/origin.h"
 +
 +namespace extensions {
 +namespace api {
 +
-+BrowserOSChangeDetector::BrowserOSChangeDetector(content::WebContents* web_contents)
-+    : content::WebContentsObserver(web_contents) {}
++namespace {
++
++// What a detection needs to teach the timeout model once it has a result
++struct Detection {
++  base::WeakPtr<content::WebContents> web_contents;
++  InteractionKind kind;
++  url::Origin origin;
++  uint64_t generation;
++  uint64_t action;
++  base::TimeTicks started;
++};
++
++PrefService* GetPrefs(content::WebContents* web_contents) {
++  return Profile::FromBrowserContext(web_contents->GetBrowserContext())
++      ->GetPrefs();
++}
 +
-+BrowserOSChangeDetector::~BrowserOSChangeDetector() {
-+  timeout_timer_.Stop();
++// Teaches the model when the first change after the action came, unless
++// the tab closed or another action started since, which may have caused it
++void LearnLatency(const Detection& detection, bool changed) {
++  if (!changed || !detection.web_contents) {
++    return;
++  }
++  auto* tracker =
++      BrowserOSChangeTracker::FromWebContents(detection.web_contents.get());
++  if (!tracker || tracker->last_action() != detection.action) {
++    return;
++  }
++  std::optional<base::TimeTicks> changed_at =
++      tracker->FirstChangeAfter(detection.generation);
++  if (!changed_at) {
++    return;
++  }
++  BrowserOSTimeoutModel::RecordLatency(
++      GetPrefs(detection.web_contents.get()), detection.origin,
++      detection.kind, *changed_at - detection.started);
 +}
 +
-+// Static method for synchronous detection
-+bool BrowserOSChangeDetector::ExecuteWithDetection(
-+    content::WebContents* web_contents,
-+    std::function<void()> action,
-+    base::TimeDelta timeout) {
-+  auto detector = std::make_unique<BrowserOSChangeDetector>(web_contents);
-+  return detector->ExecuteAndWait(std::move(action), timeout);
++void OnDetectionResult(Detection detection,
++                       base::TimeDelta timeout,
++                       base::OnceCallback<void(bool)> callback,
++                       bool changed) {
++  LearnLatency(detection, changed);
++  if (!changed && detection.web_contents) {
++    // Keep listening in the background, so a site slower than its timeout
++    // gets a longer one next time
++    auto* tracker =
++        BrowserOSChangeTracker::FromWebContents(detection.web_contents.get());
++    if (tracker && timeout < BrowserOSTimeoutModel::kMaxTimeout) {
++      uint64_t generation = detection.generation;
++      tracker->WaitForChange(
++          generation, BrowserOSTimeoutModel::kMaxTimeout - timeout,
++          base::BindOnce(&LearnLatency, std::move(detection)));
++    }
++  }
++  std::move(callback).Run(changed);
 +}
 +
-+// Static method for asynchronous detection
++}  // namespace
++
++// static
 +void BrowserOSChangeDetector::ExecuteWithDetectionAsync(
 +    content::WebContents* web_contents,
++    InteractionKind kind,
 +    std::function<void()> action,
-+    base::OnceCallback<void(bool)> callback,
-+    base::TimeDelta timeout) {
-+  // Create detector on heap - it will delete itself when done
-+  auto* detector = new BrowserOSChangeDetector(web_contents);
-+  detector->ExecuteAndNotify(std::move(action), std::move(callback), timeout);
++    base::OnceCallback<void(bool)> callback) {
++  BrowserOSChangeTracker::CreateForWebContents(web_contents);
++  auto* tracker = BrowserOSChangeTracker::FromWebContents(web_contents);
++
++  Detection detection;
++  detection.web_contents = web_contents->GetWeakPtr();
++  detection.kind = kind;
++  detection.origin =
++      web_contents->GetPrimaryMainFrame()->GetLastCommittedOrigin();
++  base::TimeDelta timeout = BrowserOSTimeoutModel::GetTimeout(
++      GetPrefs(web_contents), detection.origin, kind);
++  VLOG(1) << "[browseros] Detecting " << BrowserOSTimeoutModel::KindName(kind)
++          << " changes for " << timeout.InMilliseconds() << " ms";
++
++  // Anything after this generation was caused by the action, or at least
++  // happened while it ran
++  detection.generation = tracker->generation();
++  detection.action = tracker->BeginAction();
++  detection.started = base::TimeTicks::Now();
++  action();
++  tracker->WaitForChange(
++      detection.generation, timeout,
++      base::BindOnce(&OnDetectionResult, std::move(detection), timeout,
++                     std::move(callback)));
 +}
 +
-+void BrowserOSChangeDetector::StartMonitoring() {
-+  monitoring_ = true;
-+  change_detected_ = false;
-+  VLOG(1) << "[browseros] Started monitoring for changes";
++BrowserOSQuiescenceWatcher::BrowserOSQuiescenceWatcher(
++    content::WebContents* web_contents)
++    : started_at_(base::TimeTicks::Now()), last_activity_(started_at_) {
++  BrowserOSChangeTracker::CreateForWebContents(web_contents);
++  subscription_ =
++      BrowserOSChangeTracker::FromWebContents(web_contents)
++          ->RegisterEventCallback(
++              base::BindRepeating(&BrowserOSQuiescenceWatcher::OnEvent,
++                                  base::Unretained(this)));
 +}
 +
-+bool BrowserOSChangeDetector::ExecuteAndWait(std::function<void()> action,
-+                                             base::TimeDelta timeout) {
-+  StartMonitoring();
-+  
-+  // Execute the action
-+  action();
-+  
-+  // If change already detected (synchronously), return immediately
-+  if (change_detected_) {
-+    VLOG(1) << "[browseros] Change detected immediately";
-+    return true;
-+  }
-+  
-+  // Set up run loop to wait for changes
-+  base::RunLoop run_loop(base::RunLoop::Type::kNestableTasksAllowed);
-+  wait_callback_ = run_loop.QuitClosure();
-+  
-+  // Start timeout timer
-+  timeout_timer_.Start(FROM_HERE, timeout,
-+                      base::BindOnce(&BrowserOSChangeDetector::OnTimeout,
-+                                    weak_factory_.GetWeakPtr()));
-+  
-+  // Wait for change or timeout
-+  run_loop.Run();
-+  
-+  // Clean up
-+  timeout_timer_.Stop();
-+  wait_callback_.Reset();
-+  monitoring_ = false;
-+  
-+  VLOG(1) << "[browseros] Change detection result: " << change_detected_;
-+  return change_detected_;
-+}
++BrowserOSQuiescenceWatcher::~BrowserOSQuiescenceWatcher() = default;
 +
-+void BrowserOSChangeDetector::ExecuteAndNotify(
-+    std::function<void()> action,
-+    base::OnceCallback<void(bool)> callback,
-+    base::TimeDelta timeout) {
-+  StartMonitoring();
-+  result_callback_ = std::move(callback);
-+  
-+  // Execute the action
-+  action();
-+  
-+  // If change already detected, notify immediately
-+  if (change_detected_) {
-+    VLOG(1) << "[browseros] Change detected immediately (async)";
-+    std::move(result_callback_).Run(true);
-+    delete this;  // Self-delete
-+    return;
-+  }
-+  
-+  // Start timeout timer
-+  timeout_timer_.Start(
-+      FROM_HERE, timeout,
-+      base::BindOnce(&BrowserOSChangeDetector::OnTimeout,
-+                    weak_factory_.GetWeakPtr()));
-+}
++void BrowserOSQuiescenceWatcher::WaitForQuiet(
++    const Options& options,
++    base::OnceCallback<void(const ChangeSummary&)> callback) {
++  DCHECK(!callback_);
++  options_ = options;
++  callback_ = std::move(callback);
 +
-+void BrowserOSChangeDetector::OnChangeDetected() {
-+  if (!monitoring_ || change_detected_) {
++  if (tab_closed_) {
++    // Tab already closed; report asynchronously like the timers do
++    quiet_timer_.Start(FROM_HERE, base::TimeDelta(),
++                       base::BindOnce(&BrowserOSQuiescenceWatcher::Finish,
++                                      base::Unretained(this), false));
 +    return;
 +  }
-+  
-+  change_detected_ = true;
-+  monitoring_ = false;
-+  
-+  VLOG(1) << "[browseros] Change detected";
-+  
-+  // Stop the timeout timer
-+  timeout_timer_.Stop();
-+  
-+  // If synchronous wait, quit the run loop
-+  if (wait_callback_) {
-+    std::move(wait_callback_).Run();
-+  }
-+  
-+  // If async, notify callback and self-delete
-+  if (result_callback_) {
-+    std::move(result_callback_).Run(true);
-+    delete this;  // Self-delete for async mode
-+  }
-+}
 +
-+void BrowserOSChangeDetector::OnTimeout() {
-+  VLOG(1) << "[browseros] Change detection timeout";
-+  monitoring_ = false;
-+  
-+  // If synchronous wait, quit the run loop
-+  if (wait_callback_) {
-+    std::move(wait_callback_).Run();
-+  }
-+  
-+  // If async, notify callback with false and self-delete
-+  if (result_callback_) {
-+    std::move(result_callback_).Run(false);
-+    delete this;  // Self-delete for async mode
-+  }
++  base::TimeDelta remaining =
++      std::max(options_.max_wait - (base::TimeTicks::Now() - started_at_),
++               base::TimeDelta());
++  max_wait_timer_.Start(FROM_HERE, remaining,
++                        base::BindOnce(&BrowserOSQuiescenceWatcher::Finish,
++                                       base::Unretained(this), true));
++  StartQuietTimer();
 +}
 +
-+// WebContentsObserver overrides - any of these counts as a "change"
-+
-+void BrowserOSChangeDetector::AccessibilityEventReceived(
-+    const ui::AXUpdatesAndEvents& details) {
-+  if (!monitoring_) return;
-+  
-+  // Any accessibility event indicates a change
-+  if (!details.updates.empty() || !details.events.empty()) {
-+    VLOG(2) << "[browseros] Accessibility event detected";
-+    OnChangeDetected();
++void BrowserOSQuiescenceWatcher::OnEvent(
++    const BrowserOSChangeTracker::Event& event) {
++  switch (event.type) {
++    case BrowserOSChangeTracker::EventType::kTabClosed:
++      tab_closed_ = true;
++      subscription_ = {};
++      // Report from a fresh task; the callback may delete this
++      if (callback_) {
++        max_wait_timer_.Stop();
++        quiet_timer_.Start(FROM_HERE, base::TimeDelta(),
++                           base::BindOnce(&BrowserOSQuiescenceWatcher::Finish,
++                                          base::Unretained(this), false));
++      }
++      return;
++    case BrowserOSChangeTracker::EventType::kNavigationStarted:
++      ++pending_navigations_;
++      break;
++    case BrowserOSChangeTracker::EventType::kNavigationFinished:
++      if (event.primary_main_frame) {
++        pending_navigations_ = std::max(pending_navigations_ - 1, 0);
++      }
++      break;
++    default:
++      break;
 +  }
-+}
-+
-+void BrowserOSChangeDetector::DidFinishNavigation(
-+    content::NavigationHandle* navigation_handle) {
-+  if (!monitoring_) return;
-+  
-+  VLOG(2) << "[browseros] Navigation detected";
-+  OnChangeDetected();
-+}
++  BrowserOSChangeTracker::AddToSummary(event, summary_);
 +
-+void BrowserOSChangeDetector::DOMContentLoaded(
-+    content::RenderFrameHost* render_frame_host) {
-+  if (!monitoring_) return;
-+  
-+  VLOG(2) << "[browseros] DOM content loaded";
-+  OnChangeDetected();
++  last_activity_ = event.time;
++  if (callback_) {
++    StartQuietTimer();
++  }
 +}
 +
-+void BrowserOSChangeDetector::OnFocusChangedInPage(
-+    const content::FocusedNodeDetails& details) {
-+  if (!monitoring_) return;
-+
-+  VLOG(2) << "[browseros] Focus changed";
-+  OnChangeDetected();
++void BrowserOSQuiescenceWatcher::StartQuietTimer() {
++  base::TimeDelta remaining = std::max(
++      options_.quiet_window - (base::TimeTicks::Now() - last_activity_),
++      base::TimeDelta());
++  quiet_timer_.Start(FROM_HERE, remaining,
++                     base::BindOnce(
++                         [](BrowserOSQuiescenceWatcher* watcher) {
++                           // A pending navigation is not quiet; its finish
++                           // restarts the window
++                           if (watcher->pending_navigations_ == 0) {
++                             watcher->Finish(false);
++                           }
++                         },
++                         base::Unretained(this)));
 +}
 +
-+void BrowserOSChangeDetector::DidOpenRequestedURL(
-+    content::WebContents* new_contents,
-+    content::RenderFrameHost* source_render_frame_host,
-+    const GURL& url,
-+    const content::Referrer& referrer,
-+    WindowOpenDisposition disposition,
-+    ui::PageTransition transition,
-+    bool started_from_context_menu,
-+    bool renderer_initiated) {
-+  if (!monitoring_) return;
-+  
-+  VLOG(2) << "[browseros] New URL opened";
-+  OnChangeDetected();
++void BrowserOSQuiescenceWatcher::Finish(bool timed_out) {
++  if (!callback_) {
++    return;
++  }
++  quiet_timer_.Stop();
++  max_wait_timer_.Stop();
++  summary_.timed_out = timed_out;
++  VLOG(1) << "[browseros] Page settled after "
++          << (base::TimeTicks::Now() - started_at_).InMilliseconds()
++          << " ms, ax_updates=" << summary_.ax_updates
++          << " timed_out=" << timed_out;
++  // May delete this
++  std::move(callback_).Run(summary_);
 +}
 +
 +}  // namespace api
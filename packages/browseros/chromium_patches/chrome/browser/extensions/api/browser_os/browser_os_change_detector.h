@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/extensions/api/browser_os/browser_os_change_detector.h b/chrome/browser/extensions/api/browser_os/browser_os_change_detector.h
 new file mode 100644
-index 0000000000000..a45117498c829
+index 0000000000000..a8c2dcdbefa69
 --- /dev/null
 +++ b/chrome/browser/extensions/api/browser_os/browser_os_change_detector.h
-@@ -0,0 +1,108 @@
+@@ -0,0 +1,99 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -13,99 +13,90 @@ index 0000000000000..a45117498c829
 +
 +#include <functional>
 +
++#include "base/callback_list.h"
 +#include "base/functional/callback.h"
-+#include "base/memory/weak_ptr.h"
 +#include "base/time/time.h"
 +#include "base/timer/timer.h"
-+#include "content/public/browser/web_contents_observer.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_change_tracker.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_timeout_model.h"
 +
 +namespace content {
 +class WebContents;
 +}  // namespace content
 +
-+namespace ui {
-+struct AXUpdatesAndEvents;
-+}  // namespace ui
-+
 +namespace extensions {
 +namespace api {
 +
 +// Change detector that monitors if any change occurred in the web content
 +// after an action is performed. This is used to verify that actions like
 +// click, type, clear, etc. actually had an effect on the page.
-+class BrowserOSChangeDetector : public content::WebContentsObserver {
++//
++// Detection never blocks the UI thread: the result is always posted, so the
++// caller continues in a fresh task, even when the action itself caused the
++// change. The tab's BrowserOSChangeTracker does the observing, so nothing is
++// attached or allocated per action.
++//
++// How long to wait comes from BrowserOSTimeoutModel, which learns from every
++// detected change how quickly the site reacts to that kind of interaction.
++class BrowserOSChangeDetector {
 + public:
-+  // Execute an action and detect if it causes any change in the page
-+  // Returns true if any change was detected within the timeout period
-+  static bool ExecuteWithDetection(
-+      content::WebContents* web_contents,
-+      std::function<void()> action,
-+      base::TimeDelta timeout = base::Milliseconds(300));
++  BrowserOSChangeDetector() = delete;
 +
-+  // Alternative async version that doesn't block
++  // Execute an action of |kind| and report via |callback| whether it caused
++  // any change in the page within the timeout learned for the page's origin
 +  static void ExecuteWithDetectionAsync(
 +      content::WebContents* web_contents,
++      InteractionKind kind,
 +      std::function<void()> action,
-+      base::OnceCallback<void(bool)> callback,
-+      base::TimeDelta timeout = base::Milliseconds(300));
++      base::OnceCallback<void(bool)> callback);
++};
++
++// Records what changes in a tab from construction on and, when asked, waits
++// until the page has been quiet for a while. Single-page apps often fire a
++// small update right away and keep re-rendering for hundreds of
++// milliseconds; the first-change detection above resolves on the first one,
++// this waits for the last.
++class BrowserOSQuiescenceWatcher {
++ public:
++  struct Options {
++    // Quiet time that counts as settled
++    base::TimeDelta quiet_window = base::Milliseconds(200);
++    // Hard cap, measured from construction
++    base::TimeDelta max_wait = base::Seconds(3);
++  };
++
++  explicit BrowserOSQuiescenceWatcher(content::WebContents* web_contents);
++  ~BrowserOSQuiescenceWatcher();
++
++  BrowserOSQuiescenceWatcher(const BrowserOSQuiescenceWatcher&) = delete;
++  BrowserOSQuiescenceWatcher& operator=(const BrowserOSQuiescenceWatcher&) =
++      delete;
++
++  const ChangeSummary& summary() const { return summary_; }
 +
-+  // Constructor and destructor are public for use by factory methods
-+  explicit BrowserOSChangeDetector(content::WebContents* web_contents);
-+  ~BrowserOSChangeDetector() override;
++  // Runs |callback| with the summary once nothing changed for
++  // |options.quiet_window| and no navigation is pending, or once
++  // |options.max_wait| has passed since construction. Call at most once.
++  void WaitForQuiet(const Options& options,
++                    base::OnceCallback<void(const ChangeSummary&)> callback);
 +
 + private:
-+  BrowserOSChangeDetector(const BrowserOSChangeDetector&) = delete;
-+  BrowserOSChangeDetector& operator=(const BrowserOSChangeDetector&) = delete;
-+
-+  // Start monitoring for changes
-+  void StartMonitoring();
-+
-+  // Execute the action and wait for changes
-+  bool ExecuteAndWait(std::function<void()> action, base::TimeDelta timeout);
-+
-+  // Execute the action and notify via callback
-+  void ExecuteAndNotify(std::function<void()> action,
-+                        base::OnceCallback<void(bool)> callback,
-+                        base::TimeDelta timeout);
-+
-+  // WebContentsObserver overrides - we monitor any of these as "changes"
-+  void AccessibilityEventReceived(
-+      const ui::AXUpdatesAndEvents& details) override;
-+  void DidFinishNavigation(
-+      content::NavigationHandle* navigation_handle) override;
-+  void DOMContentLoaded(
-+      content::RenderFrameHost* render_frame_host) override;
-+  void OnFocusChangedInPage(
-+      const content::FocusedNodeDetails& details) override;
-+  void DidOpenRequestedURL(
-+      content::WebContents* new_contents,
-+      content::RenderFrameHost* source_render_frame_host,
-+      const GURL& url,
-+      const content::Referrer& referrer,
-+      WindowOpenDisposition disposition,
-+      ui::PageTransition transition,
-+      bool started_from_context_menu,
-+      bool renderer_initiated) override;
-+
-+  // Called when any change is detected
-+  void OnChangeDetected();
-+
-+  // Called when timeout expires
-+  void OnTimeout();
-+
-+  // Simple state tracking
-+  bool monitoring_ = false;
-+  bool change_detected_ = false;
-+  
-+  // Callbacks
-+  base::OnceClosure wait_callback_;
-+  base::OnceCallback<void(bool)> result_callback_;
-+  
-+  // Timer for timeout
-+  base::OneShotTimer timeout_timer_;
-+  
-+  // Weak pointer factory
-+  base::WeakPtrFactory<BrowserOSChangeDetector> weak_factory_{this};
++  // Called by the tab's tracker for every change
++  void OnEvent(const BrowserOSChangeTracker::Event& event);
++  void StartQuietTimer();
++  void Finish(bool timed_out);
++
++  const base::TimeTicks started_at_;
++  base::TimeTicks last_activity_;
++  ChangeSummary summary_;
++  int pending_navigations_ = 0;
++  bool tab_closed_ = false;
++
++  Options options_;
++  base::OnceCallback<void(const ChangeSummary&)> callback_;
++  base::OneShotTimer quiet_timer_;
++  base::OneShotTimer max_wait_timer_;
++  base::CallbackListSubscription subscription_;
 +};
 +
 +}  // namespace api
@@ -0,0 +1,266 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_change_tracker.cc b/chrome/browser/extensions/api/browser_os/browser_os_change_tracker.cc
+new file mode 100644
+index 0000000000000..62c3a42f46b05
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_change_tracker.cc
+@@ -0,0 +1,260 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_change_tracker.h"
++
++#include <algorithm>
++#include <iterator>
++#include <unordered_set>
++#include <utility>
++
++#include "base/functional/bind.h"
++#include "base/logging.h"
++#include "base/task/sequenced_task_runner.h"
++#include "content/public/browser/navigation_handle.h"
++#include "content/public/browser/web_contents.h"
++#include "ui/accessibility/ax_node_data.h"
++#include "ui/accessibility/ax_tree_update.h"
++#include "ui/accessibility/ax_updates_and_events.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++// Bound on the nodes whose children are remembered for the diff. Past it
++// the map starts over, which only costs accuracy of the next few counts.
++constexpr size_t kMaxTrackedNodes = 100000;
++
++}  // namespace
++
++BrowserOSChangeTracker::BrowserOSChangeTracker(
++    content::WebContents* web_contents)
++    : content::WebContentsObserver(web_contents),
++      content::WebContentsUserData<BrowserOSChangeTracker>(*web_contents) {
++  events_.reserve(kMaxEvents);
++}
++
++BrowserOSChangeTracker::~BrowserOSChangeTracker() = default;
++
++void BrowserOSChangeTracker::WaitForChange(
++    uint64_t after,
++    base::TimeDelta timeout,
++    base::OnceCallback<void(bool)> callback) {
++  if (generation_ > after) {
++    base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
++        FROM_HERE, base::BindOnce(std::move(callback), true));
++    return;
++  }
++  Waiter& waiter = waiters_.emplace_back();
++  waiter.after = after;
++  waiter.callback = std::move(callback);
++  waiter.timer.Start(FROM_HERE, timeout,
++                     base::BindOnce(&BrowserOSChangeTracker::Resolve,
++                                    base::Unretained(this),
++                                    std::prev(waiters_.end()), false));
++}
++
++std::optional<base::TimeTicks> BrowserOSChangeTracker::FirstChangeAfter(
++    uint64_t after) const {
++  if (after >= generation_ || generation_ - after > events_.size()) {
++    return std::nullopt;
++  }
++  return events_[after % kMaxEvents].time;
++}
++
++bool BrowserOSChangeTracker::EventsSince(uint64_t after,
++                                         std::vector<Event>* events) const {
++  if (after >= generation_) {
++    return true;
++  }
++  uint64_t oldest = generation_ - events_.size() + 1;
++  uint64_t first = std::max(after + 1, oldest);
++  for (uint64_t generation = first; generation <= generation_; ++generation) {
++    events->push_back(events_[(generation - 1) % kMaxEvents]);
++  }
++  return first == after + 1;
++}
++
++// static
++void BrowserOSChangeTracker::AddToSummary(const Event& event,
++                                          ChangeSummary& summary) {
++  switch (event.type) {
++    case EventType::kAccessibility:
++      summary.ax_updates += event.ax_updates;
++      summary.nodes_added += event.nodes_added;
++      summary.nodes_removed += event.nodes_removed;
++      break;
++    case EventType::kNavigationFinished:
++      if (event.primary_main_frame && event.committed) {
++        summary.navigation_occurred = true;
++      }
++      break;
++    case EventType::kFocusChanged:
++      summary.focus_changed = true;
++      break;
++    case EventType::kNewTab:
++      summary.new_tab_opened = true;
++      break;
++    case EventType::kNavigationStarted:
++    case EventType::kDOMContentLoaded:
++    case EventType::kTabClosed:
++      break;
++  }
++}
++
++base::CallbackListSubscription BrowserOSChangeTracker::RegisterEventCallback(
++    EventCallback callback) {
++  return event_callbacks_.Add(std::move(callback));
++}
++
++void BrowserOSChangeTracker::Record(Event event) {
++  event.generation = ++generation_;
++  event.time = base::TimeTicks::Now();
++  if (events_.size() < kMaxEvents) {
++    events_.push_back(event);
++  } else {
++    events_[(event.generation - 1) % kMaxEvents] = event;
++  }
++
++  for (auto it = waiters_.begin(); it != waiters_.end();) {
++    auto next = std::next(it);
++    if (it->after < generation_) {
++      Resolve(it, true);
++    }
++    it = next;
++  }
++  event_callbacks_.Notify(event);
++}
++
++void BrowserOSChangeTracker::Resolve(std::list<Waiter>::iterator waiter,
++                                     bool changed) {
++  VLOG(1) << "[browseros] Change detection "
++          << (changed ? "saw a change" : "timed out");
++  base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
++      FROM_HERE, base::BindOnce(std::move(waiter->callback), changed));
++  // Also stops the timer, which may be the one running this
++  waiters_.erase(waiter);
++}
++
++void BrowserOSChangeTracker::CountNodeChanges(
++    const ui::AXUpdatesAndEvents& details,
++    Event& event) {
++  if (tracked_nodes_ > kMaxTrackedNodes) {
++    children_.clear();
++    tracked_nodes_ = 0;
++  }
++  auto& children = children_[details.ax_tree_id];
++
++  for (const ui::AXTreeUpdate& update : details.updates) {
++    std::unordered_set<int32_t> serialized;
++    serialized.reserve(update.nodes.size());
++    for (const ui::AXNodeData& node : update.nodes) {
++      serialized.insert(node.id);
++    }
++
++    for (const ui::AXNodeData& node : update.nodes) {
++      auto it = children.find(node.id);
++      if (it == children.end()) {
++        // Unknown parent: children serialized with it for the first time
++        // are most likely new
++        for (int32_t child_id : node.child_ids) {
++          if (serialized.contains(child_id) && !children.contains(child_id)) {
++            ++event.nodes_added;
++          }
++        }
++        children.emplace(node.id, node.child_ids);
++        ++tracked_nodes_;
++        continue;
++      }
++      std::unordered_set<int32_t> old_children(it->second.begin(),
++                                               it->second.end());
++      for (int32_t child_id : node.child_ids) {
++        if (!old_children.erase(child_id)) {
++          ++event.nodes_added;
++        }
++      }
++      event.nodes_removed += old_children.size();
++      it->second = node.child_ids;
++    }
++  }
++}
++
++void BrowserOSChangeTracker::AccessibilityEventReceived(
++    const ui::AXUpdatesAndEvents& details) {
++  if (details.updates.empty() && details.events.empty()) {
++    return;
++  }
++  Event event{EventType::kAccessibility};
++  event.ax_updates = details.updates.size();
++  CountNodeChanges(details, event);
++  Record(event);
++}
++
++void BrowserOSChangeTracker::DidStartNavigation(
++    content::NavigationHandle* navigation_handle) {
++  // Subframes start navigations all the time; only finishes count for them
++  if (!navigation_handle->IsInPrimaryMainFrame()) {
++    return;
++  }
++  Event event{EventType::kNavigationStarted};
++  event.primary_main_frame = true;
++  Record(event);
++}
++
++void BrowserOSChangeTracker::DidFinishNavigation(
++    content::NavigationHandle* navigation_handle) {
++  Event event{EventType::kNavigationFinished};
++  event.primary_main_frame = navigation_handle->IsInPrimaryMainFrame();
++  event.committed = navigation_handle->HasCommitted();
++  Record(event);
++}
++
++void BrowserOSChangeTracker::DOMContentLoaded(
++    content::RenderFrameHost* render_frame_host) {
++  Record(Event{EventType::kDOMContentLoaded});
++}
++
++void BrowserOSChangeTracker::OnFocusChangedInPage(
++    const content::FocusedNodeDetails& details) {
++  Record(Event{EventType::kFocusChanged});
++}
++
++void BrowserOSChangeTracker::DidOpenRequestedURL(
++    content::WebContents* new_contents,
++    content::RenderFrameHost* source_render_frame_host,
++    const GURL& url,
++    const content::Referrer& referrer,
++    WindowOpenDisposition disposition,
++    ui::PageTransition transition,
++    bool started_from_context_menu,
++    bool renderer_initiated) {
++  // Opening in this tab shows up as a navigation instead
++  if (new_contents == web_contents()) {
++    return;
++  }
++  Record(Event{EventType::kNewTab});
++}
++
++void BrowserOSChangeTracker::PrimaryPageChanged(content::Page& page) {
++  // The old page's nodes never come back
++  children_.clear();
++  tracked_nodes_ = 0;
++}
++
++void BrowserOSChangeTracker::WebContentsDestroyed() {
++  // Nothing changes any more; waiters get their answer now instead of at
++  // their timeout
++  while (!waiters_.empty()) {
++    Resolve(waiters_.begin(), false);
++  }
++  Event event{EventType::kTabClosed};
++  event.time = base::TimeTicks::Now();
++  event_callbacks_.Notify(event);
++}
++
++WEB_CONTENTS_USER_DATA_KEY_IMPL(BrowserOSChangeTracker);
++
++}  // namespace api
++}  // namespace extensions
@@ -0,0 +1,200 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_change_tracker.h b/chrome/browser/extensions/api/browser_os/browser_os_change_tracker.h
+new file mode 100644
+index 0000000000000..2e66067c63c10
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_change_tracker.h
+@@ -0,0 +1,194 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_CHANGE_TRACKER_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_CHANGE_TRACKER_H_
++
++#include <cstddef>
++#include <cstdint>
++#include <list>
++#include <map>
++#include <memory>
++#include <optional>
++#include <unordered_map>
++#include <vector>
++
++#include "base/callback_list.h"
++#include "base/functional/callback.h"
++#include "base/time/time.h"
++#include "base/timer/timer.h"
++#include "content/public/browser/web_contents_observer.h"
++#include "content/public/browser/web_contents_user_data.h"
++#include "ui/accessibility/ax_tree_id.h"
++
++namespace ui {
++struct AXUpdatesAndEvents;
++}  // namespace ui
++
++namespace extensions {
++namespace api {
++
++// What changed in a tab over a span of its change generations.
++struct ChangeSummary {
++  bool navigation_occurred = false;
++  bool focus_changed = false;
++  bool new_tab_opened = false;
++  // Accessibility update batches, and the nodes they added to and removed
++  // from parents as far as the serialized updates show. Nodes whose parent
++  // was serialized for the first time only count as added if they were
++  // serialized together with it.
++  size_t ax_updates = 0;
++  size_t nodes_added = 0;
++  size_t nodes_removed = 0;
++  // The page was still changing when the hard cap ran out
++  bool timed_out = false;
++
++  bool changed() const {
++    return navigation_occurred || focus_changed || new_tab_opened ||
++           ax_updates > 0;
++  }
++};
++
++// Per-tab record of page changes, shared by every action on the tab.
++//
++// Each change bumps a monotonically increasing generation and is kept in a
++// ring of the last kMaxEvents events. An action records generation() before
++// acting and then waits for a later one, so changes landing between two
++// actions are never lost, and no observer is attached per action.
++//
++// Accessibility events only arrive while accessibility is enabled for the
++// tab.
++//
++// Lives on the UI thread.
++class BrowserOSChangeTracker
++    : public content::WebContentsObserver,
++      public content::WebContentsUserData<BrowserOSChangeTracker> {
++ public:
++  static constexpr size_t kMaxEvents = 256;
++
++  enum class EventType {
++    kAccessibility,
++    kNavigationStarted,
++    kNavigationFinished,
++    kDOMContentLoaded,
++    kFocusChanged,
++    kNewTab,
++    // Only passed to event callbacks, never recorded
++    kTabClosed,
++  };
++
++  struct Event {
++    EventType type;
++    uint64_t generation = 0;
++    base::TimeTicks time;
++    // Navigations: whether in the primary main frame, and committed
++    bool primary_main_frame = false;
++    bool committed = false;
++    // kAccessibility: update batches and the nodes they added and removed
++    size_t ax_updates = 0;
++    size_t nodes_added = 0;
++    size_t nodes_removed = 0;
++  };
++
++  using EventCallback = base::RepeatingCallback<void(const Event&)>;
++
++  ~BrowserOSChangeTracker() override;
++
++  BrowserOSChangeTracker(const BrowserOSChangeTracker&) = delete;
++  BrowserOSChangeTracker& operator=(const BrowserOSChangeTracker&) = delete;
++
++  // Generation of the last change; 0 before the first.
++  uint64_t generation() const { return generation_; }
++
++  // Numbers the actions on the tab, so a late result can tell whether
++  // another action started since.
++  uint64_t BeginAction() { return ++actions_; }
++  uint64_t last_action() const { return actions_; }
++
++  // When the first change after generation |after| happened, if it is still
++  // in the ring.
++  std::optional<base::TimeTicks> FirstChangeAfter(uint64_t after) const;
++
++  // Runs |callback| with true once the generation is past |after|, or with
++  // false after |timeout|. Always posted, never run synchronously.
++  void WaitForChange(uint64_t after,
++                     base::TimeDelta timeout,
++                     base::OnceCallback<void(bool)> callback);
++
++  // Appends the events after generation |after| that are still in the ring
++  // to |events|. Returns false if older ones were already overwritten.
++  bool EventsSince(uint64_t after, std::vector<Event>* events) const;
++
++  // Folds |event| into |summary|.
++  static void AddToSummary(const Event& event, ChangeSummary& summary);
++
++  // Runs |callback| for every later change, and with a kTabClosed event
++  // when the tab goes away.
++  base::CallbackListSubscription RegisterEventCallback(EventCallback callback);
++
++ private:
++  friend class content::WebContentsUserData<BrowserOSChangeTracker>;
++
++  struct Waiter {
++    uint64_t after;
++    base::OnceCallback<void(bool)> callback;
++    base::OneShotTimer timer;
++  };
++
++  explicit BrowserOSChangeTracker(content::WebContents* web_contents);
++
++  // Stamps |event| with the next generation, records it and wakes waiters.
++  void Record(Event event);
++
++  // Posts the result of |waiter| and drops it.
++  void Resolve(std::list<Waiter>::iterator waiter, bool changed);
++
++  // Diffs the children of the serialized nodes against the last update
++  void CountNodeChanges(const ui::AXUpdatesAndEvents& details, Event& event);
++
++  // content::WebContentsObserver:
++  void AccessibilityEventReceived(
++      const ui::AXUpdatesAndEvents& details) override;
++  void DidStartNavigation(
++      content::NavigationHandle* navigation_handle) override;
++  void DidFinishNavigation(
++      content::NavigationHandle* navigation_handle) override;
++  void DOMContentLoaded(
++      content::RenderFrameHost* render_frame_host) override;
++  void OnFocusChangedInPage(
++      const content::FocusedNodeDetails& details) override;
++  void DidOpenRequestedURL(
++      content::WebContents* new_contents,
++      content::RenderFrameHost* source_render_frame_host,
++      const GURL& url,
++      const content::Referrer& referrer,
++      WindowOpenDisposition disposition,
++      ui::PageTransition transition,
++      bool started_from_context_menu,
++      bool renderer_initiated) override;
++  void PrimaryPageChanged(content::Page& page) override;
++  void WebContentsDestroyed() override;
++
++  uint64_t generation_ = 0;
++  uint64_t actions_ = 0;
++  // Ring of the last kMaxEvents events; generation g is at (g - 1) %
++  // kMaxEvents.
++  std::vector<Event> events_;
++
++  // Last serialized children of each node, per tree. Dropped with the page,
++  // or when it grows past a bound.
++  std::map<ui::AXTreeID, std::unordered_map<int32_t, std::vector<int32_t>>>
++      children_;
++  size_t tracked_nodes_ = 0;
++
++  std::list<Waiter> waiters_;
++  base::RepeatingCallbackList<void(const Event&)> event_callbacks_;
++
++  WEB_CONTENTS_USER_DATA_KEY_DECL();
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_CHANGE_TRACKER_H_
@@ -0,0 +1,101 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_content_extraction_job.cc b/chrome/browser/extensions/api/browser_os/browser_os_content_extraction_job.cc
+new file mode 100644
+index 0000000000000..11dadb7783004
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_content_extraction_job.cc
+@@ -0,0 +1,95 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_content_extraction_job.h"
++
++#include <utility>
++
++#include "base/check.h"
++#include "base/functional/bind.h"
++#include "base/logging.h"
++#include "base/task/thread_pool.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_content_processor.h"
++#include "content/public/browser/web_contents.h"
++
++namespace extensions {
++namespace api {
++
++ContentExtractionJob::Result::Result() = default;
++ContentExtractionJob::Result::Result(Result&&) = default;
++ContentExtractionJob::Result& ContentExtractionJob::Result::operator=(
++    Result&&) = default;
++ContentExtractionJob::Result::~Result() = default;
++
++ContentExtractionJob::ContentExtractionJob(content::WebContents* web_contents)
++    : content::WebContentsObserver(web_contents),
++      cancel_(base::MakeRefCounted<CancelFlag>()) {}
++
++ContentExtractionJob::~ContentExtractionJob() {
++  // Stop a worker that is still running; its reply is dropped with us.
++  Cancel();
++}
++
++void ContentExtractionJob::Start(ui::AXTreeUpdate tree_update,
++                                 PageExtractionOptions options,
++                                 Callback callback) {
++  DCHECK(!callback_);
++  callback_ = std::move(callback);
++  base::ThreadPool::PostTaskAndReplyWithResult(
++      FROM_HERE,
++      {base::TaskPriority::USER_VISIBLE,
++       base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN},
++      base::BindOnce(&ContentExtractionJob::ExtractOnWorker,
++                     std::move(tree_update), std::move(options), cancel_,
++                     base::TimeTicks::Now()),
++      base::BindOnce(&ContentExtractionJob::OnExtracted,
++                     weak_factory_.GetWeakPtr()));
++}
++
++// static
++ContentExtractionJob::Result ContentExtractionJob::ExtractOnWorker(
++    ui::AXTreeUpdate tree_update,
++    PageExtractionOptions options,
++    scoped_refptr<CancelFlag> cancel,
++    base::TimeTicks posted_at) {
++  Result result;
++  base::TimeTicks started_at = base::TimeTicks::Now();
++  result.queue_time = started_at - posted_at;
++  if (!cancel->data.IsSet()) {
++    result.items = ContentProcessor::ExtractPageContent(
++        tree_update, options, &cancel->data, &result.stats);
++  }
++  result.work_time = base::TimeTicks::Now() - started_at;
++  return result;
++}
++
++void ContentExtractionJob::OnExtracted(Result result) {
++  if (!callback_) {
++    return;
++  }
++  if (cancel_->data.IsSet()) {
++    std::move(callback_).Run(std::nullopt);
++    return;
++  }
++  std::move(callback_).Run(std::move(result));
++}
++
++void ContentExtractionJob::Cancel() {
++  if (!cancel_->data.IsSet()) {
++    cancel_->data.Set();
++  }
++}
++
++void ContentExtractionJob::PrimaryPageChanged(content::Page& page) {
++  LOG(INFO) << "[browseros] Page changed, cancelling content extraction";
++  Cancel();
++}
++
++void ContentExtractionJob::WebContentsDestroyed() {
++  LOG(INFO) << "[browseros] Tab closed, cancelling content extraction";
++  Cancel();
++}
++
++}  // namespace api
++}  // namespace extensions
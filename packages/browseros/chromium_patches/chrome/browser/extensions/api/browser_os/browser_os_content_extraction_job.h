@@ -0,0 +1,95 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_content_extraction_job.h b/chrome/browser/extensions/api/browser_os/browser_os_content_extraction_job.h
+new file mode 100644
+index 0000000000000..d73c460503e94
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_content_extraction_job.h
+@@ -0,0 +1,89 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_CONTENT_EXTRACTION_JOB_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_CONTENT_EXTRACTION_JOB_H_
++
++#include <optional>
++#include <vector>
++
++#include "base/functional/callback.h"
++#include "base/memory/ref_counted.h"
++#include "base/memory/weak_ptr.h"
++#include "base/synchronization/atomic_flag.h"
++#include "base/time/time.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_page_extractor.h"
++#include "chrome/common/extensions/api/browser_os.h"
++#include "content/public/browser/web_contents_observer.h"
++#include "ui/accessibility/ax_tree_update.h"
++
++namespace extensions {
++namespace api {
++
++// Runs ContentProcessor::ExtractPageContent for one tab on the thread pool,
++// so large pages do not block the UI thread.
++//
++// While the extraction runs, the job watches the tab. If the primary page
++// changes or the tab closes, it raises a cancel flag that the worker polls,
++// and the callback gets nullopt instead of stale content. Destroying the job
++// cancels the same way and drops the callback.
++//
++// Created and destroyed on the UI thread.
++class ContentExtractionJob : public content::WebContentsObserver {
++ public:
++  struct Result {
++    Result();
++    Result(Result&&);
++    Result& operator=(Result&&);
++    ~Result();
++
++    std::vector<browser_os::ContentItem> items;
++    // From Start() until a worker picked the task up.
++    base::TimeDelta queue_time;
++    // Time spent extracting on the worker.
++    base::TimeDelta work_time;
++    // What the options left out.
++    PageExtractionStats stats;
++  };
++
++  using Callback = base::OnceCallback<void(std::optional<Result>)>;
++
++  explicit ContentExtractionJob(content::WebContents* web_contents);
++  ~ContentExtractionJob() override;
++
++  ContentExtractionJob(const ContentExtractionJob&) = delete;
++  ContentExtractionJob& operator=(const ContentExtractionJob&) = delete;
++
++  // Extracts the content of |tree_update|, trimmed as |options| ask, and
++  // replies with |callback| on the UI thread. Call at most once.
++  void Start(ui::AXTreeUpdate tree_update,
++             PageExtractionOptions options,
++             Callback callback);
++
++ private:
++  using CancelFlag = base::RefCountedData<base::AtomicFlag>;
++
++  static Result ExtractOnWorker(ui::AXTreeUpdate tree_update,
++                                PageExtractionOptions options,
++                                scoped_refptr<CancelFlag> cancel,
++                                base::TimeTicks posted_at);
++
++  void OnExtracted(Result result);
++
++  void Cancel();
++
++  // content::WebContentsObserver:
++  void PrimaryPageChanged(content::Page& page) override;
++  void WebContentsDestroyed() override;
++
++  const scoped_refptr<CancelFlag> cancel_;
++  Callback callback_;
++
++  base::WeakPtrFactory<ContentExtractionJob> weak_factory_{this};
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_CONTENT_EXTRACTION_JOB_H_
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/extensions/api/browser_os/browser_os_content_processor.cc b/chrome/browser/extensions/api/browser_os/browser_os_content_processor.cc
 new file mode 100644
-index 0000000000000..4166f1a38737c
+index 0000000000000..1deb270e6bc16
 --- /dev/null
 +++ b/chrome/browser/extensions/api/browser_os/browser_os_content_processor.cc
-@@ -0,0 +1,247 @@
+@@ -0,0 +1,237 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -11,9 +11,13 @@ index 0000000000000..4166f1a38737c
 +#include "chrome/browser/extensions/api/browser_os/browser_os_content_processor.h"
 +
 +#include <algorithm>
++#include <utility>
 +
 +#include "base/logging.h"
 +#include "base/strings/string_util.h"
++#include "base/timer/elapsed_timer.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_page_extractor.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_perf.h"
 +#include "ui/accessibility/ax_enum_util.h"
 +#include "ui/accessibility/ax_enums.mojom.h"
 +#include "ui/accessibility/ax_node_data.h"
@@ -50,90 +54,76 @@ index 0000000000000..4166f1a38737c
 +
 +}  // namespace
 +
-+// static
-+std::vector<browser_os::ContentItem> ContentProcessor::ExtractPageContent(
-+    const ui::AXTreeUpdate& tree_update) {
-+
-+  std::vector<browser_os::ContentItem> items;
++ContentItemSink::ContentItemSink() = default;
++ContentItemSink::~ContentItemSink() = default;
 +
-+  if (tree_update.nodes.empty()) {
-+    LOG(INFO) << "browseros: ExtractPageContent - tree is empty";
-+    return items;
-+  }
-+
-+  LOG(INFO) << "browseros: ExtractPageContent - processing " << tree_update.nodes.size() << " nodes";
-+
-+  // Build node map for O(1) lookup
-+  std::unordered_map<int32_t, ui::AXNodeData> node_map;
-+  for (const auto& node : tree_update.nodes) {
-+    node_map[node.id] = node;
++void ContentItemSink::Begin(const ui::AXTreeUpdate& tree_update) {
++  // Content roles bound the number of items
++  size_t max_items = 0;
++  for (const ui::AXNodeData& node : tree_update.nodes) {
++    if (ContentProcessor::IsContentRole(node.role)) {
++      ++max_items;
++    }
 +  }
-+
-+  // Start DFS from root
-+  TraverseDFS(tree_update.root_id, node_map, items);
-+
-+  LOG(INFO) << "browseros: ExtractPageContent - extracted " << items.size() << " items";
-+
-+  return items;
++  items_.reserve(max_items);
 +}
 +
-+// static
-+void ContentProcessor::TraverseDFS(
-+    int32_t node_id,
-+    const std::unordered_map<int32_t, ui::AXNodeData>& node_map,
-+    std::vector<browser_os::ContentItem>& items) {
-+
-+  auto it = node_map.find(node_id);
-+  if (it == node_map.end()) {
-+    return;
++bool ContentItemSink::EnterNode(const ui::AXNodeData& node) {
++  // Extract content at semantic boundaries
++  // Don't descend into these - their children are just formatting.
++  // Ignored nodes are not extracted, but their children still are.
++  if (node.IsIgnored() || !ContentProcessor::IsContentRole(node.role)) {
++    return true;
 +  }
 +
-+  const ui::AXNodeData& node = it->second;
-+
-+  // Skip extracting from ignored nodes, but still recurse to children
-+  if (node.IsIgnored()) {
-+    for (int32_t child_id : node.child_ids) {
-+      TraverseDFS(child_id, node_map, items);
++  if (ui::IsHeading(node.role)) {
++    items_.push_back(ContentProcessor::ExtractHeading(node));
++  } else if (ui::IsLink(node.role)) {
++    items_.push_back(ContentProcessor::ExtractLink(node));
++  } else if (ui::IsImage(node.role)) {
++    items_.push_back(ContentProcessor::ExtractImage(node));
++  } else if (node.role == ax::mojom::Role::kVideo) {
++    items_.push_back(ContentProcessor::ExtractVideo(node));
++  } else {
++    // Extract text content
++    auto item = ContentProcessor::ExtractText(node);
++    if (item.text.has_value() && !item.text->empty()) {
++      items_.push_back(std::move(item));
 +    }
-+    return;
 +  }
++  return false;
++}
 +
-+  // Extract content at semantic boundaries
-+  // Don't recurse into these - their children are just formatting
++// static
++std::vector<browser_os::ContentItem> ContentProcessor::ExtractPageContent(
++    const ui::AXTreeUpdate& tree_update,
++    const PageExtractionOptions& options,
++    const base::AtomicFlag* cancel,
++    PageExtractionStats* stats) {
 +
-+  if (ui::IsHeading(node.role)) {
-+    items.push_back(ExtractHeading(node));
-+    return;
++  if (tree_update.nodes.empty()) {
++    LOG(INFO) << "browseros: ExtractPageContent - tree is empty";
++    return {};
 +  }
 +
-+  if (ui::IsLink(node.role)) {
-+    items.push_back(ExtractLink(node));
-+    return;
-+  }
++  LOG(INFO) << "browseros: ExtractPageContent - processing " << tree_update.nodes.size() << " nodes";
++  base::ElapsedTimer timer;
 +
-+  if (ui::IsImage(node.role)) {
-+    items.push_back(ExtractImage(node));
-+    return;
-+  }
++  ContentItemSink sink;
++  PageExtractor::Extract(tree_update, &sink, options, cancel, stats);
++  std::vector<browser_os::ContentItem> items = sink.TakeItems();
 +
-+  if (node.role == ax::mojom::Role::kVideo) {
-+    items.push_back(ExtractVideo(node));
-+    return;
-+  }
++  LOG(INFO) << "browseros: ExtractPageContent - extracted " << items.size() << " items";
++  LogPerfRecord("page_content", tree_update.nodes.size(), items.size(),
++                timer.Elapsed());
 +
-+  if (ui::IsText(node.role)) {
-+    // Extract text content
-+    auto item = ExtractText(node);
-+    if (item.text.has_value() && !item.text->empty()) {
-+      items.push_back(std::move(item));
-+    }
-+    return;
-+  }
++  return items;
++}
 +
-+  // For container nodes (divs, sections, etc.), recurse to children
-+  for (int32_t child_id : node.child_ids) {
-+    TraverseDFS(child_id, node_map, items);
-+  }
++// static
++bool ContentProcessor::IsContentRole(ax::mojom::Role role) {
++  return ui::IsHeading(role) || ui::IsLink(role) || ui::IsImage(role) ||
++         role == ax::mojom::Role::kVideo || ui::IsText(role);
 +}
 +
 +// static
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/extensions/api/browser_os/browser_os_content_processor.h b/chrome/browser/extensions/api/browser_os/browser_os_content_processor.h
 new file mode 100644
-index 0000000000000..472c7b114fe97
+index 0000000000000..f51b64300d9f8
 --- /dev/null
 +++ b/chrome/browser/extensions/api/browser_os/browser_os_content_processor.h
-@@ -0,0 +1,57 @@
+@@ -0,0 +1,87 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -12,13 +12,19 @@ index 0000000000000..472c7b114fe97
 +#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_CONTENT_PROCESSOR_H_
 +
 +#include <string>
-+#include <unordered_map>
++#include <utility>
 +#include <vector>
 +
++#include "chrome/browser/extensions/api/browser_os/browser_os_page_extractor.h"
 +#include "chrome/common/extensions/api/browser_os.h"
++#include "ui/accessibility/ax_enums.mojom-forward.h"
 +#include "ui/accessibility/ax_tree_update.h"
 +#include "ui/gfx/geometry/size.h"
 +
++namespace base {
++class AtomicFlag;
++}  // namespace base
++
 +namespace ui {
 +struct AXNodeData;
 +}  // namespace ui
@@ -27,7 +33,8 @@ index 0000000000000..472c7b114fe97
 +namespace api {
 +
 +// Extracts page content (headings, text, links, images, videos) from
-+// accessibility tree in document order using depth-first traversal.
++// accessibility tree in document order, using PageExtractor with a
++// ContentItemSink.
 +class ContentProcessor {
 + public:
 +  ContentProcessor() = delete;
@@ -36,15 +43,20 @@ index 0000000000000..472c7b114fe97
 +
 +  // Extracts page content in document order.
 +  // Returns content items preserving the order they appear in the document.
++  // Safe to call off the UI thread. If |cancel| is set while running, stops
++  // early and returns the items found so far. |options| can trim the page to
++  // a budget and leave out boilerplate; |stats| says what was left out.
 +  static std::vector<browser_os::ContentItem> ExtractPageContent(
-+      const ui::AXTreeUpdate& tree_update);
++      const ui::AXTreeUpdate& tree_update,
++      const PageExtractionOptions& options = {},
++      const base::AtomicFlag* cancel = nullptr,
++      PageExtractionStats* stats = nullptr);
 +
 + private:
-+  // DFS traversal to extract content in document order
-+  static void TraverseDFS(
-+      int32_t node_id,
-+      const std::unordered_map<int32_t, ui::AXNodeData>& node_map,
-+      std::vector<browser_os::ContentItem>& items);
++  friend class ContentItemSink;
++
++  // True for roles that produce a content item and end the descent.
++  static bool IsContentRole(ax::mojom::Role role);
 +
 +  // Content extraction helpers
 +  static browser_os::ContentItem ExtractHeading(const ui::AXNodeData& node);
@@ -57,6 +69,24 @@ index 0000000000000..472c7b114fe97
 +  static std::string GetAccessibleName(const ui::AXNodeData& node);
 +};
 +
++// PageExtractor sink producing getSnapshot content items.
++class ContentItemSink : public PageExtractionSink {
++ public:
++  ContentItemSink();
++  ~ContentItemSink() override;
++
++  std::vector<browser_os::ContentItem> TakeItems() {
++    return std::move(items_);
++  }
++
++  // PageExtractionSink:
++  void Begin(const ui::AXTreeUpdate& tree_update) override;
++  bool EnterNode(const ui::AXNodeData& node) override;
++
++ private:
++  std::vector<browser_os::ContentItem> items_;
++};
++
 +}  // namespace api
 +}  // namespace extensions
 +
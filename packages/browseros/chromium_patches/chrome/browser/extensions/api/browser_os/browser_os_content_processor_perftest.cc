@@ -0,0 +1,79 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_content_processor_perftest.cc b/chrome/browser/extensions/api/browser_os/browser_os_content_processor_perftest.cc
+new file mode 100644
+index 0000000000000..8f2a49982d40a
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_content_processor_perftest.cc
+@@ -0,0 +1,73 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include <optional>
++#include <string>
++
++#include "base/strings/string_util.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_ax_corpus.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_content_processor.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_legacy_extraction.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_perftest_util.h"
++#include "testing/gtest/include/gtest/gtest.h"
++#include "ui/accessibility/ax_tree_update.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++constexpr int kIterations = 10;
++
++// getSnapshot content extraction against the map-copying recursive walk it
++// replaced. Both produce the same items; the in-place walk should need far
++// fewer allocations and less peak memory.
++class BrowserOSContentProcessorPerfTest
++    : public testing::TestWithParam<const char*> {
++ protected:
++  void SetUp() override {
++    update_ = LoadAXCorpus(GetParam());
++    ASSERT_TRUE(update_) << "Could not load " << GetParam();
++  }
++
++  std::string Story() const {
++    std::string story(GetParam());
++    base::ReplaceSubstringsAfterOffset(&story, 0, ".axtree", "");
++    return story;
++  }
++
++  std::optional<ui::AXTreeUpdate> update_;
++};
++
++TEST_P(BrowserOSContentProcessorPerfTest, InPlaceAgainstLegacy) {
++  size_t legacy_items = 0;
++  PerfMeasurement legacy = MeasureRuns(update_->nodes.size(), kIterations, [&] {
++    legacy_items = LegacyExtractPageContent(*update_).size();
++  });
++  size_t items = 0;
++  PerfMeasurement in_place =
++      MeasureRuns(update_->nodes.size(), kIterations, [&] {
++        items = ContentProcessor::ExtractPageContent(*update_).size();
++      });
++
++  ReportMeasurement("BrowserOS.PageContentLegacy", Story(), legacy);
++  ReportMeasurement("BrowserOS.PageContent", Story(), in_place);
++
++  EXPECT_EQ(legacy_items, items);
++  if (ScopedAllocationCounter::IsSupported()) {
++    EXPECT_LT(in_place.allocations_per_run, legacy.allocations_per_run);
++  }
++}
++
++INSTANTIATE_TEST_SUITE_P(All,
++                         BrowserOSContentProcessorPerfTest,
++                         testing::Values(kSmallFormCorpus,
++                                         kNewsPageCorpus,
++                                         kGridCorpus,
++                                         kIframeNestCorpus));
++
++}  // namespace
++
++}  // namespace api
++}  // namespace extensions
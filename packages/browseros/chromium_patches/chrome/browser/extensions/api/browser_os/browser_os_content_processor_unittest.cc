@@ -0,0 +1,113 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_content_processor_unittest.cc b/chrome/browser/extensions/api/browser_os/browser_os_content_processor_unittest.cc
+new file mode 100644
+index 0000000000000..096f210209307
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_content_processor_unittest.cc
+@@ -0,0 +1,107 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_content_processor.h"
++
++#include <optional>
++#include <vector>
++
++#include "base/values.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_ax_corpus.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_legacy_extraction.h"
++#include "testing/gtest/include/gtest/gtest.h"
++#include "ui/accessibility/ax_enums.mojom.h"
++#include "ui/accessibility/ax_tree_update.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++base::Value::List ToList(const std::vector<browser_os::ContentItem>& items) {
++  base::Value::List list;
++  for (const browser_os::ContentItem& item : items) {
++    list.Append(item.ToValue());
++  }
++  return list;
++}
++
++TEST(BrowserOSContentProcessorTest, ExtractsItemsInDocumentOrder) {
++  std::optional<ui::AXTreeUpdate> update = ParseAXCorpus(
++      "1\t-\trootWebArea\t-\tPage\n"
++      "2\t1\theading\tlevel=9\t  Title  \n"
++      "3\t2\tstaticText\t-\tTitle\n"
++      "4\t1\tgenericContainer\tignored\t\n"
++      "5\t4\tparagraph\t-\t\n"
++      "6\t5\tstaticText\t-\tSome   text\n"
++      "7\t1\tlink\turl=https://example.com/\tMore\n"
++      "8\t1\timage\turl=https://example.com/a.png\tLogo\n"
++      "9\t1\tstaticText\t-\t\n");
++  ASSERT_TRUE(update);
++
++  std::vector<browser_os::ContentItem> items =
++      ContentProcessor::ExtractPageContent(*update);
++  ASSERT_EQ(4u, items.size());
++
++  EXPECT_EQ(browser_os::ContentItemType::kHeading, items[0].type);
++  EXPECT_EQ("Title", items[0].text);
++  // Levels are clamped to 1-6
++  EXPECT_EQ(6, items[0].level);
++
++  // Ignored containers still pass their children on
++  EXPECT_EQ(browser_os::ContentItemType::kText, items[1].type);
++  EXPECT_EQ("Some text", items[1].text);
++
++  EXPECT_EQ(browser_os::ContentItemType::kLink, items[2].type);
++  EXPECT_EQ("More", items[2].text);
++  EXPECT_EQ("https://example.com/", items[2].url);
++
++  EXPECT_EQ(browser_os::ContentItemType::kImage, items[3].type);
++  EXPECT_EQ("Logo", items[3].alt);
++  EXPECT_EQ("https://example.com/a.png", items[3].url);
++}
++
++TEST(BrowserOSContentProcessorTest, EmptyTree) {
++  EXPECT_TRUE(ContentProcessor::ExtractPageContent(ui::AXTreeUpdate()).empty());
++}
++
++// Nesting deep enough to exhaust the stack of a recursive walk
++TEST(BrowserOSContentProcessorTest, DeepTree) {
++  constexpr int kDepth = 200'000;
++  ui::AXTreeUpdate update;
++  update.root_id = 1;
++  update.nodes.resize(kDepth + 1);
++  for (int i = 0; i < kDepth; ++i) {
++    update.nodes[i].id = i + 1;
++    update.nodes[i].role = ax::mojom::Role::kGenericContainer;
++    update.nodes[i].child_ids = {i + 2};
++  }
++  update.nodes[kDepth].id = kDepth + 1;
++  update.nodes[kDepth].role = ax::mojom::Role::kStaticText;
++  update.nodes[kDepth].SetName("Bottom");
++
++  std::vector<browser_os::ContentItem> items =
++      ContentProcessor::ExtractPageContent(update);
++  ASSERT_EQ(1u, items.size());
++  EXPECT_EQ("Bottom", items[0].text);
++}
++
++// Same items as the map-copying recursive walk, on every corpus
++TEST(BrowserOSContentProcessorTest, MatchesLegacyWalk) {
++  for (const char* name : {kSmallFormCorpus, kNewsPageCorpus, kGridCorpus,
++                           kIframeNestCorpus}) {
++    SCOPED_TRACE(name);
++    std::optional<ui::AXTreeUpdate> update = LoadAXCorpus(name);
++    ASSERT_TRUE(update);
++    std::vector<browser_os::ContentItem> items =
++        ContentProcessor::ExtractPageContent(*update);
++    EXPECT_FALSE(items.empty());
++    EXPECT_EQ(ToList(LegacyExtractPageContent(*update)), ToList(items));
++  }
++}
++
++}  // namespace
++
++}  // namespace api
++}  // namespace extensions
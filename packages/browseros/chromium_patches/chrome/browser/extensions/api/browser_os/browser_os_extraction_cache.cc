@@ -0,0 +1,120 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_extraction_cache.cc b/chrome/browser/extensions/api/browser_os/browser_os_extraction_cache.cc
+new file mode 100644
+index 0000000000000..37f5ff2d7f8c0
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_extraction_cache.cc
+@@ -0,0 +1,114 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_extraction_cache.h"
++
++#include <utility>
++
++#include "base/functional/bind.h"
++#include "base/logging.h"
++#include "content/public/browser/browser_accessibility_state.h"
++#include "content/public/browser/navigation_handle.h"
++#include "content/public/browser/scoped_accessibility_mode.h"
++#include "content/public/browser/web_contents.h"
++#include "ui/accessibility/ax_mode.h"
++#include "ui/accessibility/ax_updates_and_events.h"
++
++namespace extensions {
++namespace api {
++
++BrowserOSExtractionCache::Entry::Entry() = default;
++BrowserOSExtractionCache::Entry::Entry(const Entry&) = default;
++BrowserOSExtractionCache::Entry::Entry(Entry&&) = default;
++BrowserOSExtractionCache::Entry& BrowserOSExtractionCache::Entry::operator=(
++    const Entry&) = default;
++BrowserOSExtractionCache::Entry& BrowserOSExtractionCache::Entry::operator=(
++    Entry&&) = default;
++BrowserOSExtractionCache::Entry::~Entry() = default;
++
++BrowserOSExtractionCache::BrowserOSExtractionCache(
++    content::WebContents* web_contents)
++    : content::WebContentsObserver(web_contents),
++      content::WebContentsUserData<BrowserOSExtractionCache>(*web_contents) {}
++
++BrowserOSExtractionCache::~BrowserOSExtractionCache() = default;
++
++BrowserOSExtractionCache::Key BrowserOSExtractionCache::BeginExtraction() {
++  // Accessibility events only flow while some scope enables the mode. If
++  // this creates the first one, the renderer sends its tree afterwards,
++  // which bumps the generation; only the next extraction gets cached.
++  if (!scoped_accessibility_mode_) {
++    scoped_accessibility_mode_ =
++        content::BrowserAccessibilityState::GetInstance()
++            ->CreateScopedModeForWebContents(
++                web_contents(), ui::AXMode(ui::AXMode::kWebContents));
++  }
++  ttl_timer_.Start(FROM_HERE, kTtl,
++                   base::BindOnce(&BrowserOSExtractionCache::Release,
++                                  base::Unretained(this)));
++  return CurrentKey();
++}
++
++const BrowserOSExtractionCache::Entry* BrowserOSExtractionCache::Get(
++    const std::string& variant) {
++  if (entries_key_ != CurrentKey()) {
++    entries_.clear();
++    return nullptr;
++  }
++  auto it = entries_.find(variant);
++  if (it == entries_.end()) {
++    return nullptr;
++  }
++  if (ttl_timer_.IsRunning()) {
++    ttl_timer_.Reset();
++  }
++  VLOG(1) << "[browseros] Extraction cache hit for " << variant;
++  return &it->second;
++}
++
++void BrowserOSExtractionCache::Put(const Key& key,
++                                   const std::string& variant,
++                                   Entry entry) {
++  if (key != CurrentKey() || !scoped_accessibility_mode_) {
++    return;
++  }
++  if (entries_key_ != key) {
++    entries_.clear();
++    entries_key_ = key;
++  }
++  entries_.insert_or_assign(variant, std::move(entry));
++}
++
++void BrowserOSExtractionCache::AccessibilityEventReceived(
++    const ui::AXUpdatesAndEvents& details) {
++  ++generation_;
++}
++
++void BrowserOSExtractionCache::DidFinishNavigation(
++    content::NavigationHandle* navigation_handle) {
++  // Same-document navigations change content without a new page
++  if (navigation_handle->IsInPrimaryMainFrame() &&
++      navigation_handle->HasCommitted()) {
++    navigation_id_ = navigation_handle->GetNavigationId();
++  }
++}
++
++void BrowserOSExtractionCache::PrimaryPageChanged(content::Page& page) {
++  entries_.clear();
++  ++generation_;
++}
++
++void BrowserOSExtractionCache::Release() {
++  entries_.clear();
++  scoped_accessibility_mode_.reset();
++  ttl_timer_.Stop();
++  // Without the mode, later mutations go unseen; invalidate keys handed out
++  // so far.
++  ++generation_;
++}
++
++WEB_CONTENTS_USER_DATA_KEY_IMPL(BrowserOSExtractionCache);
++
++}  // namespace api
++}  // namespace extensions
@@ -0,0 +1,135 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_extraction_cache.h b/chrome/browser/extensions/api/browser_os/browser_os_extraction_cache.h
+new file mode 100644
+index 0000000000000..325437f439373
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_extraction_cache.h
+@@ -0,0 +1,129 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_EXTRACTION_CACHE_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_EXTRACTION_CACHE_H_
++
++#include <cstdint>
++#include <map>
++#include <memory>
++#include <string>
++#include <vector>
++
++#include "base/time/time.h"
++#include "base/timer/timer.h"
++#include "chrome/common/extensions/api/browser_os.h"
++#include "content/public/browser/web_contents_observer.h"
++#include "content/public/browser/web_contents_user_data.h"
++
++namespace content {
++class ScopedAccessibilityMode;
++}  // namespace content
++
++namespace ui {
++struct AXUpdatesAndEvents;
++}  // namespace ui
++
++namespace extensions {
++namespace api {
++
++// Per-tab cache of page extraction results, so repeated extractions of a
++// page that has not changed skip both the tree snapshot and the walk.
++//
++// Results are keyed by the last primary main frame navigation and a
++// generation counter that every accessibility event for the tab bumps. A
++// caller takes the Key before requesting the tree and stores its result
++// under that Key; if anything changed in between, the result is not
++// cached. While the cache holds results it keeps accessibility enabled for
++// the tab, so that no mutation can go unnoticed. Results and the mode are
++// dropped after kTtl without use.
++//
++// Lives on the UI thread.
++class BrowserOSExtractionCache
++    : public content::WebContentsObserver,
++      public content::WebContentsUserData<BrowserOSExtractionCache> {
++ public:
++  // How long results survive without being read.
++  static constexpr base::TimeDelta kTtl = base::Seconds(60);
++
++  // PlainTextSink output for a kSameOriginDirectDescendants snapshot, as
++  // the side panel copy actions take it.
++  static constexpr char kPlainTextVariant[] = "plain_text";
++
++  // What the page looked like when an extraction started.
++  struct Key {
++    int64_t navigation_id = 0;
++    uint64_t generation = 0;
++
++    bool operator==(const Key&) const = default;
++  };
++
++  // One cached extraction. Formats fill the fields they produce.
++  struct Entry {
++    Entry();
++    Entry(const Entry&);
++    Entry(Entry&&);
++    Entry& operator=(const Entry&);
++    Entry& operator=(Entry&&);
++    ~Entry();
++
++    std::vector<browser_os::ContentItem> items;
++    bool truncated = false;
++    size_t omitted_subtrees = 0;
++    std::u16string text;
++  };
++
++  ~BrowserOSExtractionCache() override;
++
++  BrowserOSExtractionCache(const BrowserOSExtractionCache&) = delete;
++  BrowserOSExtractionCache& operator=(const BrowserOSExtractionCache&) =
++      delete;
++
++  // Returns the key to store the result of an extraction starting now, and
++  // makes sure mutations from now on are observed.
++  Key BeginExtraction();
++
++  // Returns the result cached for |variant|, which names the format and its
++  // options, if the page has not changed since it was extracted. Restarts
++  // the TTL.
++  const Entry* Get(const std::string& variant);
++
++  // Caches |entry| for |variant| unless the page changed since |key| was
++  // taken.
++  void Put(const Key& key, const std::string& variant, Entry entry);
++
++ private:
++  friend class content::WebContentsUserData<BrowserOSExtractionCache>;
++
++  explicit BrowserOSExtractionCache(content::WebContents* web_contents);
++
++  // content::WebContentsObserver:
++  void AccessibilityEventReceived(
++      const ui::AXUpdatesAndEvents& details) override;
++  void DidFinishNavigation(
++      content::NavigationHandle* navigation_handle) override;
++  void PrimaryPageChanged(content::Page& page) override;
++
++  Key CurrentKey() const { return {navigation_id_, generation_}; }
++
++  // Drops all results and stops keeping accessibility enabled.
++  void Release();
++
++  int64_t navigation_id_ = 0;
++  uint64_t generation_ = 0;
++
++  // Results, all valid for |entries_key_|.
++  Key entries_key_;
++  std::map<std::string, Entry> entries_;
++
++  std::unique_ptr<content::ScopedAccessibilityMode> scoped_accessibility_mode_;
++  base::OneShotTimer ttl_timer_;
++
++  WEB_CONTENTS_USER_DATA_KEY_DECL();
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_EXTRACTION_CACHE_H_
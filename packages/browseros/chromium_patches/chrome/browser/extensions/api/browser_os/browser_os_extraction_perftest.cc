@@ -0,0 +1,104 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_extraction_perftest.cc b/chrome/browser/extensions/api/browser_os/browser_os_extraction_perftest.cc
+new file mode 100644
+index 0000000000000..76a47b86d6943
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_extraction_perftest.cc
+@@ -0,0 +1,98 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include <optional>
++#include <string>
++
++#include "base/run_loop.h"
++#include "base/strings/string_util.h"
++#include "base/test/bind.h"
++#include "base/test/task_environment.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_ax_corpus.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_content_processor.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_perftest_util.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_snapshot_processor.h"
++#include "chrome/browser/ui/views/side_panel/browseros_simple_page_extractor.h"
++#include "testing/gtest/include/gtest/gtest.h"
++#include "ui/accessibility/ax_tree_update.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++// Runs per measurement; the 50k-node grid takes most of the time.
++constexpr int kIterations = 10;
++
++// Each extraction path over each corpus, with no renderer: the tree is read
++// from disk and passed in as a snapshot would deliver it.
++class BrowserOSExtractionPerfTest : public testing::TestWithParam<const char*> {
++ protected:
++  void SetUp() override {
++    update_ = LoadAXCorpus(GetParam());
++    ASSERT_TRUE(update_) << "Could not load " << GetParam();
++  }
++
++  std::string Story() const {
++    std::string story(GetParam());
++    base::ReplaceSubstringsAfterOffset(&story, 0, ".axtree", "");
++    return story;
++  }
++
++  base::test::TaskEnvironment task_environment_;
++  std::optional<ui::AXTreeUpdate> update_;
++};
++
++TEST_P(BrowserOSExtractionPerfTest, InteractiveSnapshot) {
++  size_t elements = 0;
++  PerfMeasurement measurement =
++      MeasureRuns(update_->nodes.size(), kIterations, [&] {
++        base::RunLoop run_loop;
++        SnapshotProcessor::ProcessAccessibilityTree(
++            *update_, /*tab_id=*/1, /*snapshot_id=*/1,
++            /*web_contents=*/nullptr, /*screens_ahead=*/std::nullopt,
++            SnapshotProcessor::ChunkCallback(),
++            base::BindLambdaForTesting([&](SnapshotProcessingResult result) {
++              elements = result.snapshot.elements.size();
++              run_loop.Quit();
++            }));
++        run_loop.Run();
++      });
++  EXPECT_GT(elements, 0u);
++  ReportMeasurement("BrowserOS.InteractiveSnapshot", Story(), measurement);
++}
++
++TEST_P(BrowserOSExtractionPerfTest, PageContent) {
++  size_t items = 0;
++  PerfMeasurement measurement =
++      MeasureRuns(update_->nodes.size(), kIterations, [&] {
++        items = ContentProcessor::ExtractPageContent(*update_).size();
++      });
++  EXPECT_GT(items, 0u);
++  ReportMeasurement("BrowserOS.PageContent", Story(), measurement);
++}
++
++TEST_P(BrowserOSExtractionPerfTest, StructuredText) {
++  size_t chars = 0;
++  PerfMeasurement measurement =
++      MeasureRuns(update_->nodes.size(), kIterations, [&] {
++        chars = side_panel::BrowserOSSimplePageExtractor::ExtractStructuredText(
++                    *update_)
++                    .size();
++      });
++  EXPECT_GT(chars, 0u);
++  ReportMeasurement("BrowserOS.StructuredText", Story(), measurement);
++}
++
++INSTANTIATE_TEST_SUITE_P(All,
++                         BrowserOSExtractionPerfTest,
++                         testing::Values(kSmallFormCorpus,
++                                         kNewsPageCorpus,
++                                         kGridCorpus,
++                                         kIframeNestCorpus));
++
++}  // namespace
++
++}  // namespace api
++}  // namespace extensions
@@ -0,0 +1,343 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_legacy_extraction.cc b/chrome/browser/extensions/api/browser_os/browser_os_legacy_extraction.cc
+new file mode 100644
+index 0000000000000..13d9ed765b01d
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_legacy_extraction.cc
+@@ -0,0 +1,337 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_legacy_extraction.h"
++
++#include <algorithm>
++#include <map>
++#include <unordered_map>
++
++#include "base/strings/string_util.h"
++#include "base/strings/utf_string_conversions.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_content_processor.h"
++#include "ui/accessibility/ax_enums.mojom.h"
++#include "ui/accessibility/ax_node_data.h"
++#include "ui/accessibility/ax_role_properties.h"
++#include "ui/accessibility/ax_tree_update.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++void TraverseDFS(int32_t node_id,
++                 const std::unordered_map<int32_t, ui::AXNodeData>& node_map,
++                 ContentItemSink& sink) {
++  auto it = node_map.find(node_id);
++  if (it == node_map.end()) {
++    return;
++  }
++
++  const ui::AXNodeData& node = it->second;
++  if (!sink.EnterNode(node)) {
++    return;
++  }
++  for (int32_t child_id : node.child_ids) {
++    TraverseDFS(child_id, node_map, sink);
++  }
++}
++
++// Helper to get text from a node (name or value)
++std::u16string GetNodeText(const ui::AXNodeData* node) {
++  std::string text;
++
++  // Try name attribute first (most common)
++  if (node->HasStringAttribute(ax::mojom::StringAttribute::kName)) {
++    text = node->GetStringAttribute(ax::mojom::StringAttribute::kName);
++  }
++  // Fall back to value attribute (for input fields)
++  else if (node->HasStringAttribute(ax::mojom::StringAttribute::kValue)) {
++    text = node->GetStringAttribute(ax::mojom::StringAttribute::kValue);
++  }
++
++  // Clean up the text
++  text = std::string(base::TrimWhitespaceASCII(text, base::TRIM_ALL));
++
++  // Convert to UTF16 and return
++  return base::UTF8ToUTF16(text);
++}
++
++// Recursively extracts text from a node using DFS with semantic boundaries.
++// Stops recursion at headings, links, and images to prevent duplication.
++void ExtractNode(
++    int32_t node_id,
++    const std::unordered_map<int32_t, const ui::AXNodeData*>& node_map,
++    std::u16string& output,
++    int depth = 0) {
++  auto it = node_map.find(node_id);
++  if (it == node_map.end()) {
++    return;
++  }
++
++  const ui::AXNodeData* node = it->second;
++
++  // Skip invisible or ignored nodes but still process their children
++  if (node->IsInvisibleOrIgnored()) {
++    for (int32_t child_id : node->child_ids) {
++      ExtractNode(child_id, node_map, output, depth);
++    }
++    return;
++  }
++
++  // NAVIGATION - Separate from main content
++  if (node->role == ax::mojom::Role::kNavigation ||
++      node->role == ax::mojom::Role::kBanner) {
++    if (!output.empty() && output.back() != u'\n') {
++      output += u"\n\n";
++    }
++    for (int32_t child_id : node->child_ids) {
++      ExtractNode(child_id, node_map, output, depth);
++    }
++    output += u"\n\n";
++    return;
++  }
++
++  // HEADINGS - Extract and format as markdown
++  if (ui::IsHeading(node->role)) {
++    int level = 2;  // Default to h2
++    if (node->HasIntAttribute(ax::mojom::IntAttribute::kHierarchicalLevel)) {
++      level =
++          node->GetIntAttribute(ax::mojom::IntAttribute::kHierarchicalLevel);
++      level = std::clamp(level, 1, 6);
++    }
++
++    std::u16string text = GetNodeText(node);
++    if (!text.empty()) {
++      if (!output.empty() && output.back() != u'\n') {
++        output += u"\n\n";
++      }
++      output += std::u16string(level, u'#') + u" " + text + u"\n\n";
++    }
++    return;  // Don't recurse into heading children
++  }
++
++  // LINKS - Extract text only (no URLs)
++  if (ui::IsLink(node->role)) {
++    std::u16string text = GetNodeText(node);
++    if (!text.empty()) {
++      output += text + u" ";
++    }
++    return;
++  }
++
++  // IMAGES - Extract alt text
++  if (ui::IsImage(node->role)) {
++    std::u16string alt_text = GetNodeText(node);
++    if (!alt_text.empty()) {
++      output += u"[Image: " + alt_text + u"] ";
++    }
++    return;
++  }
++
++  // TEXT NODES - Extract actual text content
++  if (ui::IsText(node->role)) {
++    std::u16string text = GetNodeText(node);
++    if (!text.empty()) {
++      if (!output.empty() && output.back() != u' ' && output.back() != u'\n') {
++        output += u" ";
++      }
++      output += text;
++    }
++    return;
++  }
++
++  // LIST container - Increase depth for nested structure
++  if (node->role == ax::mojom::Role::kList) {
++    for (int32_t child_id : node->child_ids) {
++      ExtractNode(child_id, node_map, output, depth + 1);
++    }
++    return;
++  }
++
++  // LIST ITEMS - Start new line with indentation
++  if (node->role == ax::mojom::Role::kListItem) {
++    if (!output.empty() && output.back() != u'\n') {
++      output += u"\n";
++    }
++    if (depth > 0) {
++      output += std::u16string(depth, u'\t');
++    }
++    for (int32_t child_id : node->child_ids) {
++      ExtractNode(child_id, node_map, output, depth);
++    }
++    return;
++  }
++
++  // PARAGRAPHS - Add spacing
++  if (node->role == ax::mojom::Role::kParagraph) {
++    if (!output.empty() && output.back() != u'\n') {
++      output += u"\n\n";
++    }
++  }
++
++  // For all other container nodes, recurse to children
++  for (int32_t child_id : node->child_ids) {
++    ExtractNode(child_id, node_map, output, depth);
++  }
++
++  // Add spacing after certain block elements
++  if (node->role == ax::mojom::Role::kParagraph ||
++      node->role == ax::mojom::Role::kSection ||
++      node->role == ax::mojom::Role::kArticle) {
++    if (!output.empty() && output.back() != u'\n') {
++      output += u"\n\n";
++    }
++  }
++}
++
++// Clean up excessive whitespace in the final output
++void CleanupWhitespace(std::u16string& text) {
++  size_t pos = 0;
++  while ((pos = text.find(u"  ", pos)) != std::u16string::npos) {
++    text.replace(pos, 2, u" ");
++  }
++
++  pos = 0;
++  while ((pos = text.find(u"\n\n\n", pos)) != std::u16string::npos) {
++    text.replace(pos, 3, u"\n\n");
++  }
++
++  while (!text.empty() && (text.back() == u' ' || text.back() == u'\n')) {
++    text.pop_back();
++  }
++}
++
++void ExtractTextFromNodeData(
++    const ui::AXNodeData* node,
++    const std::map<ui::AXNodeID, const ui::AXNodeData*>& node_map,
++    std::u16string* output) {
++  // Skip UI elements and navigation
++  if (node->role == ax::mojom::Role::kButton ||
++      node->role == ax::mojom::Role::kNavigation ||
++      node->role == ax::mojom::Role::kBanner ||
++      node->role == ax::mojom::Role::kComplementary ||
++      node->role == ax::mojom::Role::kContentInfo ||
++      node->role == ax::mojom::Role::kForm ||
++      node->role == ax::mojom::Role::kSearch ||
++      node->role == ax::mojom::Role::kMenu ||
++      node->role == ax::mojom::Role::kMenuBar ||
++      node->role == ax::mojom::Role::kMenuItem ||
++      node->role == ax::mojom::Role::kToolbar) {
++    // For these elements, still traverse children but don't extract their
++    // text
++    for (ui::AXNodeID child_id : node->child_ids) {
++      auto it = node_map.find(child_id);
++      if (it != node_map.end()) {
++        ExtractTextFromNodeData(it->second, node_map, output);
++      }
++    }
++    return;
++  }
++
++  bool is_text_element = (node->role == ax::mojom::Role::kStaticText ||
++                          node->role == ax::mojom::Role::kInlineTextBox);
++  if (is_text_element) {
++    std::u16string text;
++    if (node->HasStringAttribute(ax::mojom::StringAttribute::kName)) {
++      text = node->GetString16Attribute(ax::mojom::StringAttribute::kName);
++    }
++    if (text.empty() &&
++        node->HasStringAttribute(ax::mojom::StringAttribute::kValue)) {
++      text = node->GetString16Attribute(ax::mojom::StringAttribute::kValue);
++    }
++    if (!text.empty()) {
++      if (!output->empty() && output->back() != ' ' &&
++          output->back() != '\n') {
++        *output += u" ";
++      }
++      *output += text;
++    }
++  }
++
++  // Handle line breaks
++  if (node->role == ax::mojom::Role::kLineBreak) {
++    *output += u"\n";
++  }
++
++  // Add paragraph breaks for block-level elements
++  bool needs_paragraph_break = (node->role == ax::mojom::Role::kParagraph ||
++                                node->role == ax::mojom::Role::kHeading ||
++                                node->role == ax::mojom::Role::kListItem ||
++                                node->role == ax::mojom::Role::kBlockquote ||
++                                node->role == ax::mojom::Role::kArticle ||
++                                node->role == ax::mojom::Role::kSection);
++  if (needs_paragraph_break && !output->empty() && output->back() != '\n') {
++    *output += u"\n\n";
++  }
++
++  // Recursively process children for all elements
++  for (ui::AXNodeID child_id : node->child_ids) {
++    auto it = node_map.find(child_id);
++    if (it != node_map.end()) {
++      ExtractTextFromNodeData(it->second, node_map, output);
++    }
++  }
++
++  // Add paragraph break after block-level elements if they had content
++  if (needs_paragraph_break && !output->empty() && output->back() != '\n') {
++    *output += u"\n\n";
++  }
++}
++
++}  // namespace
++
++std::vector<browser_os::ContentItem> LegacyExtractPageContent(
++    const ui::AXTreeUpdate& tree_update) {
++  if (tree_update.nodes.empty()) {
++    return {};
++  }
++
++  // Build node map for O(1) lookup
++  std::unordered_map<int32_t, ui::AXNodeData> node_map;
++  for (const auto& node : tree_update.nodes) {
++    node_map[node.id] = node;
++  }
++
++  ContentItemSink sink;
++  TraverseDFS(tree_update.root_id, node_map, sink);
++  return sink.TakeItems();
++}
++
++std::u16string LegacyExtractStructuredText(const ui::AXTreeUpdate& update) {
++  if (update.nodes.empty()) {
++    return u"";
++  }
++
++  // Build node map for O(1) lookup
++  std::unordered_map<int32_t, const ui::AXNodeData*> node_map;
++  for (const auto& node : update.nodes) {
++    node_map[node.id] = &node;
++  }
++
++  std::u16string output;
++  ExtractNode(update.root_id, node_map, output, -1);  // Start at depth -1
++  CleanupWhitespace(output);
++  return output;
++}
++
++std::u16string LegacyExtractPlainText(const ui::AXTreeUpdate& update) {
++  // Build a map of node IDs to node data for easy lookup
++  std::map<ui::AXNodeID, const ui::AXNodeData*> node_map;
++  for (const auto& node_data : update.nodes) {
++    node_map[node_data.id] = &node_data;
++  }
++
++  auto root = node_map.find(update.root_id);
++  if (root == node_map.end()) {
++    return std::u16string();
++  }
++
++  std::u16string extracted_text;
++  ExtractTextFromNodeData(root->second, node_map, &extracted_text);
++  return extracted_text;
++}
++
++}  // namespace api
++}  // namespace extensions
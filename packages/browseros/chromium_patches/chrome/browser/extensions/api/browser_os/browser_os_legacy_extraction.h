@@ -0,0 +1,47 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_legacy_extraction.h b/chrome/browser/extensions/api/browser_os/browser_os_legacy_extraction.h
+new file mode 100644
+index 0000000000000..3b83601b5b4ee
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_legacy_extraction.h
+@@ -0,0 +1,41 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_LEGACY_EXTRACTION_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_LEGACY_EXTRACTION_H_
++
++#include <string>
++#include <vector>
++
++#include "chrome/common/extensions/api/browser_os.h"
++
++namespace ui {
++struct AXTreeUpdate;
++}  // namespace ui
++
++namespace extensions {
++namespace api {
++
++// Extraction paths as they were before PageExtractor, kept for tests to
++// check that the current ones produce the same output, and for perftests to
++// measure against.
++
++// getSnapshot content items: copies every node into a map keyed by id and
++// recurses from the root. Per-node extraction is ContentItemSink's, which
++// the traversal rework left unchanged.
++std::vector<browser_os::ContentItem> LegacyExtractPageContent(
++    const ui::AXTreeUpdate& tree_update);
++
++// Markdown for the LLM side panels, as BrowserOSSimplePageExtractor built it
++// with its own recursive walk.
++std::u16string LegacyExtractStructuredText(const ui::AXTreeUpdate& update);
++
++// Plain text for the third-party LLM copy action, as
++// ThirdPartyLlmPanelCoordinator built it. Empty if the root is missing.
++std::u16string LegacyExtractPlainText(const ui::AXTreeUpdate& update);
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_LEGACY_EXTRACTION_H_
@@ -0,0 +1,559 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_live_snapshot.cc b/chrome/browser/extensions/api/browser_os/browser_os_live_snapshot.cc
+new file mode 100644
+index 0000000000000..32fe1c0a064eb
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_live_snapshot.cc
+@@ -0,0 +1,553 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_live_snapshot.h"
++
++#include <algorithm>
++#include <utility>
++#include <vector>
++
++#include "base/functional/bind.h"
++#include "base/logging.h"
++#include "base/task/single_thread_task_runner.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_api_utils.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_bounds_pass.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_perf.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_snapshot_outline.h"
++#include "content/browser/renderer_host/render_frame_host_impl.h"
++#include "content/common/render_accessibility.mojom.h"
++#include "content/public/browser/browser_accessibility_state.h"
++#include "content/public/browser/render_frame_host.h"
++#include "content/public/browser/scoped_accessibility_mode.h"
++#include "content/public/browser/web_contents.h"
++#include "ui/accessibility/ax_node.h"
++#include "ui/accessibility/ax_node_data.h"
++#include "ui/accessibility/ax_tree_update.h"
++#include "ui/accessibility/ax_updates_and_events.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++// Number of dirty nodes processed per UI thread task.
++constexpr size_t kNodesPerSlice = 200;
++
++// Maximum number of times a build picks up changes that arrived while it was
++// running before it answers with what it has.
++constexpr int kMaxBuildRounds = 3;
++
++bool HostsChildTree(const ui::AXNodeData& data) {
++  return data.HasStringAttribute(ax::mojom::StringAttribute::kChildTreeId);
++}
++
++// Snapshot without elements, for builds that cannot run
++SnapshotProcessingResult EmptyResult(uint32_t snapshot_id) {
++  SnapshotProcessingResult result;
++  result.snapshot.snapshot_id = snapshot_id;
++  result.snapshot.timestamp = base::Time::Now().InMillisecondsFSinceUnixEpoch();
++  return result;
++}
++
++}  // namespace
++
++BrowserOSLiveSnapshotEngine::PendingBuild::PendingBuild() = default;
++BrowserOSLiveSnapshotEngine::PendingBuild::PendingBuild(PendingBuild&&) =
++    default;
++BrowserOSLiveSnapshotEngine::PendingBuild&
++BrowserOSLiveSnapshotEngine::PendingBuild::operator=(PendingBuild&&) = default;
++BrowserOSLiveSnapshotEngine::PendingBuild::~PendingBuild() = default;
++
++BrowserOSLiveSnapshotEngine::BrowserOSLiveSnapshotEngine(
++    content::WebContents* web_contents)
++    : content::WebContentsObserver(web_contents),
++      content::WebContentsUserData<BrowserOSLiveSnapshotEngine>(
++          *web_contents) {
++  // The mode matches the full snapshot path so cached nodes carry the same
++  // names and attributes.
++  scoped_accessibility_mode_ =
++      content::BrowserAccessibilityState::GetInstance()
++          ->CreateScopedModeForWebContents(web_contents,
++                                           kInteractiveSnapshotAXMode);
++  // The renderer only sends a full tree if the scope changed the tab's mode,
++  // so ask for one explicitly.
++  RequestSeed();
++  idle_timer_.Start(FROM_HERE, kIdleTtl,
++                    base::BindOnce(&BrowserOSLiveSnapshotEngine::OnIdle,
++                                   base::Unretained(this)));
++}
++
++BrowserOSLiveSnapshotEngine::~BrowserOSLiveSnapshotEngine() {
++  // A build cut short by the tab closing still answers its caller
++  if (pending_ && pending_->callback) {
++    base::SingleThreadTaskRunner::GetCurrentDefault()->PostTask(
++        FROM_HERE, base::BindOnce(std::move(pending_->callback),
++                                  EmptyResult(pending_->snapshot_id)));
++  }
++}
++
++bool BrowserOSLiveSnapshotEngine::CanServeSnapshot() const {
++  return tree_ && child_tree_hosts_.empty() && !pending_;
++}
++
++void BrowserOSLiveSnapshotEngine::BuildSnapshot(
++    int tab_id,
++    uint32_t snapshot_id,
++    std::optional<int> screens_ahead,
++    base::OnceCallback<void(SnapshotProcessingResult)> callback) {
++  idle_timer_.Reset();
++  if (pending_) {
++    LOG(WARNING) << "[browseros] Live snapshot already in progress";
++    std::move(callback).Run(EmptyResult(snapshot_id));
++    return;
++  }
++
++  pending_.emplace();
++  pending_->tab_id = tab_id;
++  pending_->snapshot_id = snapshot_id;
++  pending_->start_time = base::TimeTicks::Now();
++  pending_->callback = std::move(callback);
++
++  // Bounds are cached in CSS pixels, so a zoom or display change invalidates
++  // every node.
++  auto [viewport_size, device_scale_factor] =
++      SnapshotProcessor::ExtractViewportInfo(web_contents());
++  pending_->region =
++      SnapshotProcessor::GetScopeRegion(viewport_size, screens_ahead);
++  if (tree_ && device_scale_factor != device_scale_factor_) {
++    device_scale_factor_ = device_scale_factor;
++    MarkDirty(tree_->root());
++  }
++  pending_->device_scale_factor = device_scale_factor_;
++
++  CollectDirtyWork();
++
++  // Always answer asynchronously, even when nothing changed.
++  base::SingleThreadTaskRunner::GetCurrentDefault()->PostTask(
++      FROM_HERE, base::BindOnce(&BrowserOSLiveSnapshotEngine::ProcessDirtySlice,
++                                weak_factory_.GetWeakPtr()));
++}
++
++void BrowserOSLiveSnapshotEngine::AccessibilityEventReceived(
++    const ui::AXUpdatesAndEvents& details) {
++  content::RenderFrameHost* rfh = web_contents()->GetPrimaryMainFrame();
++  if (!rfh || details.ax_tree_id != rfh->GetAXTreeID()) {
++    return;
++  }
++
++  // A new main frame tree means a new document; drop the old one and wait
++  // for the full tree it will send.
++  if (tree_ && details.ax_tree_id != tree_id_) {
++    ResetTree();
++  }
++
++  // Updates racing the seed snapshot are applied on top of it once it
++  // arrives.
++  if (seed_updates_) {
++    seed_updates_->insert(seed_updates_->end(), details.updates.begin(),
++                          details.updates.end());
++    return;
++  }
++
++  for (const ui::AXTreeUpdate& update : details.updates) {
++    if (!tree_) {
++      // Only a full tree can seed the resident tree; partial updates fail to
++      // unserialize into an empty tree and are dropped.
++      Seed(details.ax_tree_id, update);
++      continue;
++    }
++
++    if (!tree_->Unserialize(update)) {
++      LOG(WARNING) << "[browseros] Live snapshot update failed: "
++                   << tree_->error();
++      ResetTree();
++      RequestSeed();
++      return;
++    }
++  }
++}
++
++void BrowserOSLiveSnapshotEngine::PrimaryPageChanged(content::Page& page) {
++  ResetTree();
++}
++
++void BrowserOSLiveSnapshotEngine::OnNodeDataChanged(
++    ui::AXTree* tree,
++    const ui::AXNodeData& old_node_data,
++    const ui::AXNodeData& new_node_data) {
++  if (HostsChildTree(new_node_data)) {
++    child_tree_hosts_.insert(new_node_data.id);
++  } else {
++    child_tree_hosts_.erase(new_node_data.id);
++  }
++  MarkDirty(tree->GetFromId(new_node_data.id));
++}
++
++void BrowserOSLiveSnapshotEngine::OnNodeCreated(ui::AXTree* tree,
++                                                ui::AXNode* node) {
++  if (HostsChildTree(node->data())) {
++    child_tree_hosts_.insert(node->id());
++  }
++  MarkDirty(node);
++}
++
++void BrowserOSLiveSnapshotEngine::OnNodeWillBeReparented(ui::AXTree* tree,
++                                                         ui::AXNode* node) {
++  // The AXNode is recreated under its new parent; drop the cached pointer.
++  ForgetNode(node->id());
++}
++
++void BrowserOSLiveSnapshotEngine::OnNodeReparented(ui::AXTree* tree,
++                                                   ui::AXNode* node) {
++  if (HostsChildTree(node->data())) {
++    child_tree_hosts_.insert(node->id());
++  }
++  MarkDirty(node);
++}
++
++void BrowserOSLiveSnapshotEngine::OnNodeWillBeDeleted(ui::AXTree* tree,
++                                                      ui::AXNode* node) {
++  ForgetNode(node->id());
++  node_ids_.erase(node->id());
++  dirty_roots_.erase(node->id());
++  // Removing a node changes the text of the containers above it.
++  if (node->parent()) {
++    MarkDirty(node->parent());
++  }
++}
++
++bool BrowserOSLiveSnapshotEngine::Seed(const ui::AXTreeID& tree_id,
++                                       const ui::AXTreeUpdate& update) {
++  auto tree = std::make_unique<ui::AXTree>();
++  if (!tree->Unserialize(update)) {
++    return false;
++  }
++  tree_ = std::move(tree);
++  tree_id_ = tree_id;
++  tree_observation_.Observe(tree_.get());
++  for (const auto& node_data : update.nodes) {
++    if (HostsChildTree(node_data)) {
++      child_tree_hosts_.insert(node_data.id);
++    }
++  }
++  MarkDirty(tree_->root());
++  VLOG(1) << "[browseros] Live snapshot seeded with " << update.nodes.size()
++          << " nodes";
++  return true;
++}
++
++void BrowserOSLiveSnapshotEngine::RequestSeed() {
++  // WebContents::RequestAXTreeSnapshot() merges frames through
++  // AXTreeCombiner, which renumbers node ids, so later updates would not
++  // apply to its result. The frame's own snapshot keeps the renderer's ids.
++  auto* rfh = static_cast<content::RenderFrameHostImpl*>(
++      web_contents()->GetPrimaryMainFrame());
++  if (!rfh) {
++    return;
++  }
++  seed_updates_.emplace();
++  auto params = content::mojom::SnapshotAccessibilityTreeParams::New();
++  params->ax_mode = kInteractiveSnapshotAXMode.flags();
++  params->max_nodes = 0;  // No limit
++  params->timeout = base::TimeDelta();
++  rfh->RequestAXTreeSnapshot(
++      base::BindOnce(&BrowserOSLiveSnapshotEngine::OnSeedSnapshot,
++                     weak_factory_.GetWeakPtr(), rfh->GetAXTreeID()),
++      std::move(params));
++}
++
++void BrowserOSLiveSnapshotEngine::OnSeedSnapshot(
++    const ui::AXTreeID& tree_id,
++    ui::AXTreeUpdate& snapshot) {
++  content::RenderFrameHost* rfh = web_contents()->GetPrimaryMainFrame();
++  if (!seed_updates_ || !rfh || rfh->GetAXTreeID() != tree_id) {
++    return;
++  }
++  std::vector<ui::AXTreeUpdate> updates = std::move(*seed_updates_);
++  seed_updates_.reset();
++
++  ResetTree();
++  if (!Seed(tree_id, snapshot)) {
++    LOG(WARNING) << "[browseros] Live snapshot seed failed to unserialize";
++    return;
++  }
++  // An update may already be reflected in the snapshot; applying it again
++  // only rewrites the nodes it lists.
++  for (const ui::AXTreeUpdate& update : updates) {
++    if (!tree_->Unserialize(update)) {
++      LOG(WARNING) << "[browseros] Live snapshot update failed: "
++                   << tree_->error();
++      ResetTree();
++      RequestSeed();
++      return;
++    }
++  }
++}
++
++void BrowserOSLiveSnapshotEngine::ResetTree() {
++  seed_updates_.reset();
++  cache_.clear();
++  context_summaries_.clear();
++  node_ids_.clear();
++  dirty_roots_.clear();
++  child_tree_hosts_.clear();
++  tree_observation_.Reset();
++  tree_.reset();
++  tree_id_ = ui::AXTreeIDUnknown();
++  device_scale_factor_ = 0.0f;
++}
++
++void BrowserOSLiveSnapshotEngine::MarkDirty(const ui::AXNode* node) {
++  if (!node) {
++    return;
++  }
++  dirty_roots_.insert(node->id());
++  // The node's text may be part of the summary of any container above it
++  for (; node; node = node->parent()) {
++    context_summaries_.erase(node->id());
++  }
++}
++
++void BrowserOSLiveSnapshotEngine::CollectDirtyWork() {
++  pending_->work.clear();
++  pending_->next_work_index = 0;
++  if (!tree_ || dirty_roots_.empty()) {
++    dirty_roots_.clear();
++    return;
++  }
++
++  std::unordered_set<int32_t> roots;
++  roots.reserve(dirty_roots_.size());
++  for (int32_t id : dirty_roots_) {
++    if (tree_->GetFromId(id)) {
++      roots.insert(id);
++    }
++  }
++  dirty_roots_.clear();
++
++  // Walk the tree in pre-order and take every node inside a root's subtree,
++  // so new nodes get their nodeIds in document order. The walk stops once
++  // the last root's subtree is done.
++  std::vector<std::pair<const ui::AXNode*, bool>> stack;
++  stack.emplace_back(tree_->root(), false);
++  size_t roots_left = roots.size();
++  while (!stack.empty() && (roots_left > 0 || stack.back().second)) {
++    auto [node, in_dirty_subtree] = stack.back();
++    stack.pop_back();
++    if (roots.contains(node->id())) {
++      in_dirty_subtree = true;
++      --roots_left;
++    }
++    if (in_dirty_subtree) {
++      pending_->work.push_back(node->id());
++    }
++    for (auto it = node->children().rbegin(); it != node->children().rend();
++         ++it) {
++      stack.emplace_back(*it, in_dirty_subtree);
++    }
++  }
++}
++
++void BrowserOSLiveSnapshotEngine::ProcessDirtySlice() {
++  if (!pending_) {
++    return;
++  }
++
++  if (tree_) {
++    auto lookup = [this](int32_t id) -> const ui::AXNodeData* {
++      const ui::AXNode* node = tree_->GetFromId(id);
++      return node ? &node->data() : nullptr;
++    };
++
++    size_t end = std::min(pending_->work.size(),
++                          pending_->next_work_index + kNodesPerSlice);
++    std::vector<const ui::AXNode*> nodes;
++    nodes.reserve(end - pending_->next_work_index);
++    for (size_t i = pending_->next_work_index; i < end; ++i) {
++      if (const ui::AXNode* node = tree_->GetFromId(pending_->work[i])) {
++        nodes.push_back(node);
++      }
++    }
++
++    // The tree does not change within a slice, so one bounds pass can share
++    // container offsets across the whole slice.
++    AXBoundsPass bounds_pass(tree_.get());
++    std::vector<AXBoundsPass::NodeBounds> node_bounds = bounds_pass.ComputeAll(
++        nodes, /*clip_bounds=*/true, pending_->device_scale_factor);
++
++    // Context is filled in by FinishSnapshot() from |context_summaries_|
++    const SnapshotProcessor::ContextSummaries no_context;
++    for (size_t i = 0; i < nodes.size(); ++i) {
++      int32_t ax_id = nodes[i]->id();
++      SnapshotProcessor::ProcessedNode data;
++      if (!SnapshotProcessor::ProcessNode(nodes[i]->data(), lookup,
++                                          node_bounds[i], no_context, data)) {
++        cache_.erase(ax_id);
++        continue;
++      }
++      auto [it, inserted] = node_ids_.try_emplace(ax_id, next_node_id_);
++      if (inserted) {
++        ++next_node_id_;
++      }
++      data.node_id = it->second;
++      cache_[ax_id] = std::move(data);
++    }
++    pending_->nodes_processed += end - pending_->next_work_index;
++    pending_->next_work_index = end;
++
++    // Pick up changes that arrived while this build was running.
++    if (pending_->next_work_index == pending_->work.size() &&
++        !dirty_roots_.empty() && ++pending_->rounds < kMaxBuildRounds) {
++      CollectDirtyWork();
++    }
++
++    if (pending_->next_work_index < pending_->work.size()) {
++      base::SingleThreadTaskRunner::GetCurrentDefault()->PostTask(
++          FROM_HERE,
++          base::BindOnce(&BrowserOSLiveSnapshotEngine::ProcessDirtySlice,
++                         weak_factory_.GetWeakPtr()));
++      return;
++    }
++  }
++
++  FinishSnapshot();
++}
++
++void BrowserOSLiveSnapshotEngine::FinishSnapshot() {
++  PendingBuild build = std::move(*pending_);
++  pending_.reset();
++
++  SnapshotProcessingResult result;
++  result.snapshot.snapshot_id = build.snapshot_id;
++  result.snapshot.timestamp = base::Time::Now().InMillisecondsFSinceUnixEpoch();
++
++  // Clear previous mappings for this tab
++  GetNodeIdMappings()[build.tab_id].clear();
++
++  // List the cached nodes in document order, like the full snapshot path.
++  // NodeIds are stable rather than positional, so their order cannot be used.
++  std::vector<SnapshotProcessor::ProcessedNode*> ordered;
++  ordered.reserve(cache_.size());
++  if (tree_ && !cache_.empty()) {
++    std::vector<const ui::AXNode*> stack = {tree_->root()};
++    while (!stack.empty() && ordered.size() < cache_.size()) {
++      const ui::AXNode* node = stack.back();
++      stack.pop_back();
++      auto it = cache_.find(node->id());
++      if (it != cache_.end()) {
++        ordered.push_back(&it->second);
++      }
++      for (auto child = node->children().rbegin();
++           child != node->children().rend(); ++child) {
++        stack.push_back(*child);
++      }
++    }
++  }
++
++  // Scope is applied on output so the cache stays valid for any scope.
++  if (tree_ && !build.region.IsEmpty()) {
++    std::vector<const ui::AXNode*> nodes;
++    nodes.reserve(ordered.size());
++    for (const SnapshotProcessor::ProcessedNode* node_data : ordered) {
++      nodes.push_back(tree_->GetFromId(node_data->node_data->id));
++    }
++    AXBoundsPass bounds_pass(tree_.get());
++    std::vector<AXBoundsPass::NodeBounds> unclipped = bounds_pass.ComputeAll(
++        nodes, /*clip_bounds=*/false, build.device_scale_factor);
++    size_t kept = 0;
++    for (size_t i = 0; i < ordered.size(); ++i) {
++      if (SnapshotProcessor::IntersectsRegion(unclipped[i].bounds,
++                                              build.region)) {
++        ordered[kept++] = ordered[i];
++      }
++    }
++    ordered.resize(kept);
++  }
++
++  // A container's summary covers text anywhere under it, including nested
++  // containers, so it is resolved on output rather than cached per node.
++  // Summaries are kept until a node under the container changes.
++  if (tree_) {
++    std::unordered_set<int32_t> missing;
++    for (const SnapshotProcessor::ProcessedNode* node_data : ordered) {
++      int32_t container_id =
++          node_data->node_data->relative_bounds.offset_container_id;
++      if (container_id >= 0 && !context_summaries_.contains(container_id)) {
++        missing.insert(container_id);
++      }
++    }
++    if (!missing.empty()) {
++      auto lookup = [this](int32_t id) -> const ui::AXNodeData* {
++        const ui::AXNode* node = tree_->GetFromId(id);
++        return node ? &node->data() : nullptr;
++      };
++      SnapshotProcessor::ContextSummaries built =
++          SnapshotProcessor::BuildContextSummaries(missing, lookup);
++      for (int32_t container_id : missing) {
++        auto it = built.find(container_id);
++        context_summaries_[container_id] =
++            it != built.end() ? std::move(it->second) : nullptr;
++      }
++    }
++    for (SnapshotProcessor::ProcessedNode* node_data : ordered) {
++      int32_t container_id =
++          node_data->node_data->relative_bounds.offset_container_id;
++      auto it = context_summaries_.find(container_id);
++      node_data->attributes.context =
++          it != context_summaries_.end() ? it->second : nullptr;
++    }
++  }
++
++  result.snapshot.elements.reserve(ordered.size());
++  SnapshotOutline outline;
++  size_t name_bytes = 0;
++  std::vector<int32_t> landmark_ids;
++  landmark_ids.reserve(ordered.size());
++  for (const SnapshotProcessor::ProcessedNode* node_data : ordered) {
++    SnapshotProcessor::AppendProcessedNode(*node_data, build.tab_id, tree_id_,
++                                           result.snapshot);
++    name_bytes += node_data->name.size();
++    landmark_ids.push_back(outline.NearestLandmark(
++        tree_ ? tree_->GetFromId(node_data->node_data->id) : nullptr));
++  }
++
++  // Outline the nodes under their landmarks
++  outline.Reserve(ordered.size(), name_bytes);
++  for (size_t i = 0; i < ordered.size(); ++i) {
++    outline.AppendNode(landmark_ids[i], ordered[i]->node_id,
++                       ordered[i]->attributes.role, ordered[i]->name);
++  }
++  result.snapshot.hierarchical_structure = outline.Finish();
++
++  base::TimeDelta processing_time = base::TimeTicks::Now() - build.start_time;
++  // Only reprocessed nodes count as input; the rest came from the cache.
++  LogPerfRecord("live_snapshot", build.nodes_processed,
++                result.snapshot.elements.size(), processing_time);
++
++  result.snapshot.processing_time_ms = processing_time.InMilliseconds();
++  result.nodes_processed = build.nodes_processed;
++  result.processing_time_ms = processing_time.InMilliseconds();
++
++  std::move(build.callback).Run(std::move(result));
++}
++
++void BrowserOSLiveSnapshotEngine::ForgetNode(int32_t ax_id) {
++  cache_.erase(ax_id);
++  context_summaries_.erase(ax_id);
++  child_tree_hosts_.erase(ax_id);
++}
++
++void BrowserOSLiveSnapshotEngine::OnIdle() {
++  if (pending_) {
++    idle_timer_.Reset();
++    return;
++  }
++  VLOG(1) << "[browseros] Live snapshot engine idle, releasing";
++  web_contents()->RemoveUserData(UserDataKey());
++}
++
++WEB_CONTENTS_USER_DATA_KEY_IMPL(BrowserOSLiveSnapshotEngine);
++
++}  // namespace api
++}  // namespace extensions
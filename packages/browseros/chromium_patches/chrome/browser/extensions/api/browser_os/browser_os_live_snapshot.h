@@ -0,0 +1,222 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_live_snapshot.h b/chrome/browser/extensions/api/browser_os/browser_os_live_snapshot.h
+new file mode 100644
+index 0000000000000..a49cc0e6fc71d
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_live_snapshot.h
+@@ -0,0 +1,216 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_LIVE_SNAPSHOT_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_LIVE_SNAPSHOT_H_
++
++#include <cstdint>
++#include <memory>
++#include <optional>
++#include <unordered_map>
++#include <unordered_set>
++#include <vector>
++
++#include "base/functional/callback.h"
++#include "base/memory/weak_ptr.h"
++#include "base/scoped_observation.h"
++#include "base/time/time.h"
++#include "base/timer/timer.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_snapshot_processor.h"
++#include "content/public/browser/web_contents_observer.h"
++#include "content/public/browser/web_contents_user_data.h"
++#include "ui/accessibility/ax_tree.h"
++#include "ui/accessibility/ax_tree_id.h"
++#include "ui/accessibility/ax_tree_observer.h"
++#include "ui/accessibility/ax_tree_update.h"
++#include "ui/gfx/geometry/rect_f.h"
++
++namespace content {
++class ScopedAccessibilityMode;
++class WebContents;
++}  // namespace content
++
++namespace ui {
++struct AXUpdatesAndEvents;
++}  // namespace ui
++
++namespace extensions {
++namespace api {
++
++// Per-tab live interactive snapshot engine.
++//
++// Keeps a resident ui::AXTree for the tab's main frame that is kept current by
++// applying the AXTreeUpdates delivered through AccessibilityEventReceived,
++// and caches the processed result for every interactive node. A snapshot
++// request only reprocesses the subtrees that changed since the previous
++// request, so follow-up snapshots in an agent loop cost roughly the size of
++// the change rather than the size of the page.
++//
++// Snapshot nodeIds handed out by the engine are stable for as long as the
++// underlying AX node lives. Elements are still listed in document order, as
++// in a full snapshot, so a node added later may appear before nodes with
++// smaller nodeIds.
++//
++// The engine seeds the resident tree from a snapshot of the main frame, or
++// from a full tree the renderer sends after a navigation. It can only serve
++// snapshots once seeded, and only for pages without child frame trees
++// (iframes), which the main frame's tree does not contain. Callers should
++// fall back to SnapshotProcessor::ProcessAccessibilityTree() when
++// CanServeSnapshot() returns false.
++//
++// The engine keeps full accessibility serialization enabled for its tab. When
++// no snapshot was asked for within kIdleTtl it removes itself, which turns
++// the mode off again and frees the resident tree; the next request attaches
++// a new engine.
++//
++// Lives on the UI thread. Dirty nodes are processed in small slices posted to
++// the UI task runner so a large change never blocks the thread for long.
++class BrowserOSLiveSnapshotEngine
++    : public content::WebContentsObserver,
++      public content::WebContentsUserData<BrowserOSLiveSnapshotEngine>,
++      public ui::AXTreeObserver {
++ public:
++  // How long the engine survives without a snapshot request.
++  static constexpr base::TimeDelta kIdleTtl = base::Seconds(60);
++
++  ~BrowserOSLiveSnapshotEngine() override;
++
++  BrowserOSLiveSnapshotEngine(const BrowserOSLiveSnapshotEngine&) = delete;
++  BrowserOSLiveSnapshotEngine& operator=(const BrowserOSLiveSnapshotEngine&) =
++      delete;
++
++  // True once the resident tree mirrors the main frame and the page has no
++  // child frame trees.
++  bool CanServeSnapshot() const;
++
++  // Builds a snapshot from the resident tree, reprocessing only nodes that
++  // changed since the last snapshot. |callback| runs asynchronously on the UI
++  // thread. Only one build may be in flight at a time; a second request while
++  // one is pending is answered with an empty result, as is a pending build
++  // when the tab closes. |screens_ahead| limits the result as in
++  // SnapshotProcessor::ProcessAccessibilityTree(); the cache itself always
++  // covers the whole page.
++  void BuildSnapshot(
++      int tab_id,
++      uint32_t snapshot_id,
++      std::optional<int> screens_ahead,
++      base::OnceCallback<void(SnapshotProcessingResult)> callback);
++
++ private:
++  friend class content::WebContentsUserData<BrowserOSLiveSnapshotEngine>;
++
++  struct PendingBuild {
++    PendingBuild();
++    PendingBuild(PendingBuild&&);
++    PendingBuild& operator=(PendingBuild&&);
++    ~PendingBuild();
++
++    int tab_id = -1;
++    uint32_t snapshot_id = 0;
++    float device_scale_factor = 1.0f;
++    gfx::RectF region;
++    base::TimeTicks start_time;
++    int nodes_processed = 0;
++    int rounds = 0;
++    std::vector<int32_t> work;
++    size_t next_work_index = 0;
++    base::OnceCallback<void(SnapshotProcessingResult)> callback;
++  };
++
++  explicit BrowserOSLiveSnapshotEngine(content::WebContents* web_contents);
++
++  // content::WebContentsObserver:
++  void AccessibilityEventReceived(
++      const ui::AXUpdatesAndEvents& details) override;
++  void PrimaryPageChanged(content::Page& page) override;
++
++  // ui::AXTreeObserver:
++  void OnNodeDataChanged(ui::AXTree* tree,
++                         const ui::AXNodeData& old_node_data,
++                         const ui::AXNodeData& new_node_data) override;
++  void OnNodeCreated(ui::AXTree* tree, ui::AXNode* node) override;
++  void OnNodeWillBeReparented(ui::AXTree* tree, ui::AXNode* node) override;
++  void OnNodeReparented(ui::AXTree* tree, ui::AXNode* node) override;
++  void OnNodeWillBeDeleted(ui::AXTree* tree, ui::AXNode* node) override;
++
++  // Makes |update|, which must be a full tree, the resident tree. Returns
++  // false and leaves the engine unseeded if it does not unserialize.
++  bool Seed(const ui::AXTreeID& tree_id, const ui::AXTreeUpdate& update);
++
++  // Asks the main frame for a full tree snapshot to seed the resident tree.
++  // Updates received until it arrives are queued in |seed_updates_|.
++  void RequestSeed();
++  void OnSeedSnapshot(const ui::AXTreeID& tree_id, ui::AXTreeUpdate& snapshot);
++
++  // Drops the resident tree, all cached results and any pending seed.
++  void ResetTree();
++
++  // Records that the subtree under |node| must be reprocessed, and drops the
++  // context summaries of the containers above it.
++  void MarkDirty(const ui::AXNode* node);
++
++  // Expands the dirty roots into the list of node ids to process, in document
++  // order.
++  void CollectDirtyWork();
++
++  // Processes the next slice of dirty nodes, then reposts itself or finishes.
++  void ProcessDirtySlice();
++
++  // Emits the snapshot from the cache.
++  void FinishSnapshot();
++
++  void ForgetNode(int32_t ax_id);
++
++  // Removes the engine from its tab unless a build is running. Deletes this.
++  void OnIdle();
++
++  std::unique_ptr<content::ScopedAccessibilityMode> scoped_accessibility_mode_;
++
++  // Resident tree for the primary main frame, or null until a full tree
++  // has been received.
++  std::unique_ptr<ui::AXTree> tree_;
++  ui::AXTreeID tree_id_;
++  base::ScopedObservation<ui::AXTree, ui::AXTreeObserver> tree_observation_{
++      this};
++
++  // Ids of nodes that host a child tree (iframes). While non-empty the
++  // resident tree cannot describe the whole page.
++  std::unordered_set<int32_t> child_tree_hosts_;
++
++  // Updates received while a seed snapshot is in flight, or nullopt when
++  // none is.
++  std::optional<std::vector<ui::AXTreeUpdate>> seed_updates_;
++
++  // Scale factor the cached bounds were computed with.
++  float device_scale_factor_ = 0.0f;
++
++  // Roots of subtrees that changed since the last processed snapshot.
++  std::unordered_set<int32_t> dirty_roots_;
++
++  // Cached processing results for interactive nodes, keyed by AX node id.
++  // ProcessedNode::node_data points into |tree_|; entries are dropped before
++  // their AXNode is deleted.
++  std::unordered_map<int32_t, SnapshotProcessor::ProcessedNode> cache_;
++
++  // Context summaries of offset containers, built on output and dropped when
++  // any node under the container changes.
++  SnapshotProcessor::ContextSummaries context_summaries_;
++
++  // Stable snapshot nodeId per AX node id.
++  std::unordered_map<int32_t, uint32_t> node_ids_;
++  uint32_t next_node_id_ = 1;
++
++  std::optional<PendingBuild> pending_;
++
++  base::OneShotTimer idle_timer_;
++
++  base::WeakPtrFactory<BrowserOSLiveSnapshotEngine> weak_factory_{this};
++
++  WEB_CONTENTS_USER_DATA_KEY_DECL();
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_LIVE_SNAPSHOT_H_
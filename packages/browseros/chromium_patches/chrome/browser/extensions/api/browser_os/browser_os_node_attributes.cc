@@ -0,0 +1,132 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_node_attributes.cc b/chrome/browser/extensions/api/browser_os/browser_os_node_attributes.cc
+new file mode 100644
+index 0000000000000..24f0ba9e3c88a
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_node_attributes.cc
+@@ -0,0 +1,126 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_node_attributes.h"
++
++#include <algorithm>
++#include <array>
++
++#include "base/notreached.h"
++#include "base/strings/string_number_conversions.h"
++#include "ui/accessibility/ax_enum_util.h"
++#include "ui/accessibility/ax_enums.mojom.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++// Standard HTML tags, sorted for binary search. Blink reports tags in lower
++// case.
++constexpr auto kKnownHtmlTags = std::to_array<std::string_view>({
++    "a", "abbr", "address", "area", "article", "aside", "audio", "b", "bdi",
++    "bdo", "blockquote", "body", "br", "button", "canvas", "caption", "cite",
++    "code", "col", "colgroup", "data", "datalist", "dd", "del", "details",
++    "dfn", "dialog", "div", "dl", "dt", "em", "embed", "fieldset",
++    "figcaption", "figure", "footer", "form", "h1", "h2", "h3", "h4", "h5",
++    "h6", "header", "hgroup", "hr", "html", "i", "iframe", "img", "input",
++    "ins", "kbd", "label", "legend", "li", "main", "map", "mark", "menu",
++    "meter", "nav", "object", "ol", "optgroup", "option", "output", "p",
++    "picture", "pre", "progress", "q", "rp", "rt", "ruby", "s", "samp",
++    "search", "section", "select", "slot", "small", "source", "span", "strong",
++    "sub", "summary", "sup", "svg", "table", "tbody", "td", "template",
++    "textarea", "tfoot", "th", "thead", "time", "tr", "track", "u", "ul",
++    "var", "video", "wbr",
++});
++
++static_assert(std::ranges::is_sorted(kKnownHtmlTags));
++
++}  // namespace
++
++// static
++std::string_view NodeAttributes::KeyName(Key key) {
++  switch (key) {
++    case Key::kValue:
++      return "value";
++    case Key::kRoleDescription:
++      return "role-description";
++    case Key::kInputType:
++      return "input-type";
++    case Key::kTooltip:
++      return "tooltip";
++    case Key::kPlaceholder:
++      return "placeholder";
++    case Key::kDescription:
++      return "description";
++    case Key::kCheckedState:
++      return "checked-state";
++    case Key::kAutocomplete:
++      return "autocomplete";
++    case Key::kId:
++      return "id";
++    case Key::kClass:
++      return "class";
++    case Key::kPath:
++      return "path";
++  }
++  NOTREACHED();
++}
++
++NodeAttributes::NodeAttributes() : role(ax::mojom::Role::kUnknown) {}
++NodeAttributes::NodeAttributes(const NodeAttributes&) = default;
++NodeAttributes::NodeAttributes(NodeAttributes&&) = default;
++NodeAttributes& NodeAttributes::operator=(const NodeAttributes&) = default;
++NodeAttributes& NodeAttributes::operator=(NodeAttributes&&) = default;
++NodeAttributes::~NodeAttributes() = default;
++
++void NodeAttributes::Set(Key key, std::string value) {
++  for (auto& [existing_key, existing_value] : strings_) {
++    if (existing_key == key) {
++      existing_value = std::move(value);
++      return;
++    }
++  }
++  strings_.emplace_back(key, std::move(value));
++}
++
++std::string_view NodeAttributes::Get(Key key) const {
++  for (const auto& [existing_key, value] : strings_) {
++    if (existing_key == key) {
++      return value;
++    }
++  }
++  return std::string_view();
++}
++
++base::Value::Dict NodeAttributes::ToDict() const {
++  base::Value::Dict dict;
++  dict.Set("role", ui::ToString(role));
++  if (std::string_view tag = html_tag(); !tag.empty()) {
++    dict.Set("html-tag", tag);
++  }
++  for (const auto& [key, value] : strings_) {
++    dict.Set(KeyName(key), value);
++  }
++  if (context) {
++    dict.Set("context", context->as_string());
++  }
++  dict.Set("depth", base::NumberToString(depth));
++  dict.Set("in_viewport", in_viewport ? "true" : "false");
++  return dict;
++}
++
++void NodeAttributes::SetHtmlTag(std::string_view tag) {
++  auto it = std::ranges::lower_bound(kKnownHtmlTags, tag);
++  if (it != kKnownHtmlTags.end() && *it == tag) {
++    known_html_tag_ = *it;
++    other_html_tag_.clear();
++  } else {
++    known_html_tag_ = std::string_view();
++    other_html_tag_ = std::string(tag);
++  }
++}
++
++}  // namespace api
++}  // namespace extensions
@@ -0,0 +1,97 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_node_attributes.h b/chrome/browser/extensions/api/browser_os/browser_os_node_attributes.h
+new file mode 100644
+index 0000000000000..46cfb3a6cfa6f
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_node_attributes.h
+@@ -0,0 +1,91 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_NODE_ATTRIBUTES_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_NODE_ATTRIBUTES_H_
++
++#include <cstdint>
++#include <string>
++#include <string_view>
++#include <utility>
++#include <vector>
++
++#include "base/memory/ref_counted_memory.h"
++#include "base/memory/scoped_refptr.h"
++#include "base/values.h"
++#include "ui/accessibility/ax_enums.mojom-forward.h"
++
++namespace extensions {
++namespace api {
++
++// Computed attributes of one interactive snapshot node.
++//
++// Role, HTML tag, depth and viewport state are typed fields. Standard HTML
++// tags point into a fixed table, so nodes share one copy without any locking;
++// other tags, such as custom elements, are stored on the node. The remaining
++// attributes are optional strings stored as a short list keyed by an enum, so
++// absent attributes cost nothing. Converted to a base::Value dictionary only
++// when a snapshot is returned to the extension.
++class NodeAttributes {
++ public:
++  // Optional string attributes, in output order.
++  enum class Key : uint8_t {
++    kValue,
++    kRoleDescription,
++    kInputType,
++    kTooltip,
++    kPlaceholder,
++    kDescription,
++    kCheckedState,
++    kAutocomplete,
++    kId,
++    kClass,
++    kPath,
++  };
++
++  // Returns the name |key| has in the snapshot, e.g. "role-description".
++  static std::string_view KeyName(Key key);
++
++  NodeAttributes();
++  NodeAttributes(const NodeAttributes&);
++  NodeAttributes(NodeAttributes&&);
++  NodeAttributes& operator=(const NodeAttributes&);
++  NodeAttributes& operator=(NodeAttributes&&);
++  ~NodeAttributes();
++
++  // Sets |key| to |value|, replacing any previous value.
++  void Set(Key key, std::string value);
++
++  // Returns the value of |key|, or an empty string if it is not set.
++  std::string_view Get(Key key) const;
++
++  // Converts to the attributes dictionary of an InteractiveNode. Values are
++  // all strings, matching what the extension has always received.
++  base::Value::Dict ToDict() const;
++
++  void SetHtmlTag(std::string_view tag);
++  // Empty if the node has no HTML tag.
++  std::string_view html_tag() const {
++    return known_html_tag_.empty() ? std::string_view(other_html_tag_)
++                                   : known_html_tag_;
++  }
++
++  ax::mojom::Role role;
++  int depth = 0;
++  bool in_viewport = false;
++  // Text summary of the offset container, shared by all nodes under it.
++  scoped_refptr<base::RefCountedString> context;
++
++ private:
++  std::vector<std::pair<Key, std::string>> strings_;
++  // Entry of the static tag table, or empty
++  std::string_view known_html_tag_;
++  // Set only for tags missing from the table
++  std::string other_html_tag_;
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_NODE_ATTRIBUTES_H_
@@ -0,0 +1,174 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_node_attributes_perftest.cc b/chrome/browser/extensions/api/browser_os/browser_os_node_attributes_perftest.cc
+new file mode 100644
+index 0000000000000..9c15d96ef3d5c
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_node_attributes_perftest.cc
+@@ -0,0 +1,168 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_node_attributes.h"
++
++#include <optional>
++#include <string>
++#include <unordered_map>
++#include <vector>
++
++#include "base/memory/ref_counted_memory.h"
++#include "base/strings/string_number_conversions.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_ax_corpus.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_perftest_util.h"
++#include "testing/gtest/include/gtest/gtest.h"
++#include "testing/perf/perf_result_reporter.h"
++#include "ui/accessibility/ax_enum_util.h"
++#include "ui/accessibility/ax_enums.mojom.h"
++#include "ui/accessibility/ax_tree_update.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++// What the snapshot computes for one node, prepared up front so both
++// layouts below are fed the same strings.
++struct NodeInput {
++  ax::mojom::Role role;
++  std::string html_tag;
++  std::string input_type;
++  std::string path;
++  int depth = 0;
++  bool in_viewport = false;
++  scoped_refptr<base::RefCountedString> context;
++};
++
++std::vector<NodeInput> PrepareInputs(const ui::AXTreeUpdate& update) {
++  std::unordered_map<int32_t, const ui::AXNodeData*> by_id;
++  std::unordered_map<int32_t, scoped_refptr<base::RefCountedString>> contexts;
++  for (const ui::AXNodeData& node : update.nodes) {
++    by_id.emplace(node.id, &node);
++  }
++
++  std::vector<NodeInput> inputs;
++  inputs.reserve(update.nodes.size());
++  for (const ui::AXNodeData& node : update.nodes) {
++    NodeInput& input = inputs.emplace_back();
++    input.role = node.role;
++    input.html_tag =
++        node.GetStringAttribute(ax::mojom::StringAttribute::kHtmlTag);
++    input.input_type =
++        node.GetStringAttribute(ax::mojom::StringAttribute::kInputType);
++    input.in_viewport = node.relative_bounds.bounds.y() < 1000;
++
++    int32_t container = node.relative_bounds.offset_container_id;
++    for (int32_t id = node.id; id >= 0 && input.depth < 10; ++input.depth) {
++      auto it = by_id.find(id);
++      if (it == by_id.end()) {
++        break;
++      }
++      input.path = ui::ToString(it->second->role) +
++                   (input.path.empty() ? "" : " > ") + input.path;
++      id = it->second->relative_bounds.offset_container_id;
++    }
++    if (container >= 0) {
++      scoped_refptr<base::RefCountedString>& context = contexts[container];
++      if (!context) {
++        context = base::MakeRefCounted<base::RefCountedString>(
++            by_id[container]->GetStringAttribute(
++                ax::mojom::StringAttribute::kName) +
++            " " + ui::ToString(by_id[container]->role));
++      }
++      input.context = context;
++    }
++  }
++  return inputs;
++}
++
++// The per-node string map the snapshot used before NodeAttributes
++using StringAttributes = std::unordered_map<std::string, std::string>;
++
++StringAttributes ToStringAttributes(const NodeInput& input) {
++  StringAttributes attributes;
++  attributes["role"] = ui::ToString(input.role);
++  if (!input.html_tag.empty()) {
++    attributes["html-tag"] = input.html_tag;
++  }
++  if (!input.input_type.empty()) {
++    attributes["input-type"] = input.input_type;
++  }
++  if (input.context) {
++    attributes["context"] = input.context->as_string();
++  }
++  attributes["path"] = input.path;
++  attributes["depth"] = base::NumberToString(input.depth);
++  attributes["in_viewport"] = input.in_viewport ? "true" : "false";
++  return attributes;
++}
++
++NodeAttributes ToNodeAttributes(const NodeInput& input) {
++  NodeAttributes attributes;
++  attributes.role = input.role;
++  attributes.SetHtmlTag(input.html_tag);
++  if (!input.input_type.empty()) {
++    attributes.Set(NodeAttributes::Key::kInputType, input.input_type);
++  }
++  attributes.context = input.context;
++  attributes.Set(NodeAttributes::Key::kPath, input.path);
++  attributes.depth = input.depth;
++  attributes.in_viewport = input.in_viewport;
++  return attributes;
++}
++
++struct MemoryCost {
++  size_t allocations = 0;
++  size_t bytes = 0;
++};
++
++// Builds the attributes of every node, then copies them once more, as the
++// snapshot does when it stores them into the tab's node table.
++template <typename Attributes>
++MemoryCost Measure(const std::vector<NodeInput>& inputs,
++                   Attributes (*convert)(const NodeInput&)) {
++  ScopedAllocationCounter counter;
++  std::vector<Attributes> built;
++  built.reserve(inputs.size());
++  for (const NodeInput& input : inputs) {
++    built.push_back(convert(input));
++  }
++  std::vector<Attributes> stored(built);
++  return {counter.count(), counter.bytes()};
++}
++
++void Report(const std::string& story, const MemoryCost& cost, size_t nodes) {
++  perf_test::PerfResultReporter reporter("BrowserOS.NodeAttributes", story);
++  reporter.RegisterImportantMetric(".allocations_per_node", "count");
++  reporter.RegisterImportantMetric(".bytes_per_node", "bytes");
++  reporter.AddResult(".allocations_per_node",
++                     static_cast<double>(cost.allocations) / nodes);
++  reporter.AddResult(".bytes_per_node",
++                     static_cast<double>(cost.bytes) / nodes);
++}
++
++// Heap cost of the typed record against the string map it replaced, over
++// every node of the news page.
++TEST(BrowserOSNodeAttributesPerfTest, TypedRecordAgainstStringMap) {
++  if (!ScopedAllocationCounter::IsSupported()) {
++    GTEST_SKIP() << "No allocator shim in this build";
++  }
++  std::optional<ui::AXTreeUpdate> update = LoadAXCorpus(kNewsPageCorpus);
++  ASSERT_TRUE(update);
++  std::vector<NodeInput> inputs = PrepareInputs(*update);
++
++  MemoryCost string_map = Measure(inputs, &ToStringAttributes);
++  MemoryCost typed = Measure(inputs, &ToNodeAttributes);
++  Report("news_5k_string_map", string_map, inputs.size());
++  Report("news_5k_typed", typed, inputs.size());
++
++  EXPECT_LT(typed.allocations * 2, string_map.allocations);
++  EXPECT_LT(typed.bytes * 2, string_map.bytes);
++}
++
++}  // namespace
++
++}  // namespace api
++}  // namespace extensions
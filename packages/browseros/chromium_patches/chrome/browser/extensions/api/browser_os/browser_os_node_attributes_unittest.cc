@@ -0,0 +1,83 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_node_attributes_unittest.cc b/chrome/browser/extensions/api/browser_os/browser_os_node_attributes_unittest.cc
+new file mode 100644
+index 0000000000000..01abe4d6592ff
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_node_attributes_unittest.cc
+@@ -0,0 +1,77 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_node_attributes.h"
++
++#include <string>
++
++#include "base/memory/ref_counted_memory.h"
++#include "base/test/values_test_util.h"
++#include "testing/gtest/include/gtest/gtest.h"
++#include "ui/accessibility/ax_enums.mojom.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++TEST(BrowserOSNodeAttributesTest, SetReplacesValue) {
++  NodeAttributes attributes;
++  EXPECT_EQ("", attributes.Get(NodeAttributes::Key::kValue));
++  attributes.Set(NodeAttributes::Key::kValue, "a");
++  attributes.Set(NodeAttributes::Key::kValue, "b");
++  EXPECT_EQ("b", attributes.Get(NodeAttributes::Key::kValue));
++  EXPECT_EQ("", attributes.Get(NodeAttributes::Key::kTooltip));
++}
++
++TEST(BrowserOSNodeAttributesTest, HtmlTag) {
++  NodeAttributes attributes;
++  EXPECT_EQ("", attributes.html_tag());
++  attributes.SetHtmlTag("button");
++  EXPECT_EQ("button", attributes.html_tag());
++  attributes.SetHtmlTag("my-widget");
++  EXPECT_EQ("my-widget", attributes.html_tag());
++  attributes.SetHtmlTag("a");
++  EXPECT_EQ("a", attributes.html_tag());
++}
++
++// The dictionary keeps the string values the extension has always received
++TEST(BrowserOSNodeAttributesTest, ToDict) {
++  NodeAttributes attributes;
++  attributes.role = ax::mojom::Role::kButton;
++  attributes.SetHtmlTag("button");
++  attributes.Set(NodeAttributes::Key::kRoleDescription, "toggle");
++  attributes.Set(NodeAttributes::Key::kPath, "rootWebArea > button");
++  attributes.context = base::MakeRefCounted<base::RefCountedString>(
++      std::string("Settings"));
++  attributes.depth = 2;
++  attributes.in_viewport = true;
++
++  EXPECT_EQ(base::test::ParseJsonDict(R"({
++              "role": "button",
++              "html-tag": "button",
++              "role-description": "toggle",
++              "path": "rootWebArea > button",
++              "context": "Settings",
++              "depth": "2",
++              "in_viewport": "true"
++            })"),
++            attributes.ToDict());
++}
++
++TEST(BrowserOSNodeAttributesTest, ToDictOmitsUnsetFields) {
++  NodeAttributes attributes;
++  attributes.role = ax::mojom::Role::kLink;
++  EXPECT_EQ(base::test::ParseJsonDict(R"({
++              "role": "link",
++              "depth": "0",
++              "in_viewport": "false"
++            })"),
++            attributes.ToDict());
++}
++
++}  // namespace
++
++}  // namespace api
++}  // namespace extensions
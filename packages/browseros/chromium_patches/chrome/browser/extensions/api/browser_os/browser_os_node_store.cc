@@ -0,0 +1,47 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_node_store.cc b/chrome/browser/extensions/api/browser_os/browser_os_node_store.cc
+new file mode 100644
+index 0000000000000..19da405c66c3a
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_node_store.cc
+@@ -0,0 +1,41 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_node_store.h"
++
++#include <utility>
++
++#include "ui/accessibility/ax_tree_update.h"
++
++namespace extensions {
++namespace api {
++
++// static
++scoped_refptr<AXNodeStore> AXNodeStore::Create(
++    const ui::AXTreeUpdate& tree_update) {
++  return base::WrapRefCounted(new AXNodeStore(tree_update.nodes));
++}
++
++AXNodeStore::AXNodeStore(std::vector<ui::AXNodeData> nodes)
++    : nodes_(std::move(nodes)) {
++  index_by_id_.reserve(nodes_.size());
++  for (size_t i = 0; i < nodes_.size(); ++i) {
++    index_by_id_.emplace(nodes_[i].id, i);
++  }
++}
++
++AXNodeStore::~AXNodeStore() = default;
++
++const ui::AXNodeData* AXNodeStore::Find(int32_t ax_id) const {
++  size_t index = IndexOf(ax_id);
++  return index == kInvalidIndex ? nullptr : &nodes_[index];
++}
++
++size_t AXNodeStore::IndexOf(int32_t ax_id) const {
++  auto it = index_by_id_.find(ax_id);
++  return it == index_by_id_.end() ? kInvalidIndex : it->second;
++}
++
++}  // namespace api
++}  // namespace extensions
@@ -0,0 +1,71 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_node_store.h b/chrome/browser/extensions/api/browser_os/browser_os_node_store.h
+new file mode 100644
+index 0000000000000..39fd5b918134c
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_node_store.h
+@@ -0,0 +1,65 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_NODE_STORE_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_NODE_STORE_H_
++
++#include <cstddef>
++#include <cstdint>
++#include <unordered_map>
++#include <vector>
++
++#include "base/memory/ref_counted.h"
++#include "ui/accessibility/ax_node_data.h"
++
++namespace ui {
++struct AXTreeUpdate;
++}  // namespace ui
++
++namespace extensions {
++namespace api {
++
++// Read-only, index-addressed store of the nodes in an accessibility snapshot.
++// Nodes live in one flat array in tree update order, with an id -> index
++// table for lookups. The store is built once per snapshot and then shared by
++// reference between all worker tasks, so batches never copy node data.
++//
++// The store is immutable after Create() and therefore safe to read from any
++// thread.
++class AXNodeStore : public base::RefCountedThreadSafe<AXNodeStore> {
++ public:
++  static constexpr size_t kInvalidIndex = static_cast<size_t>(-1);
++
++  // Builds a store holding a copy of every node in |tree_update|.
++  static scoped_refptr<AXNodeStore> Create(const ui::AXTreeUpdate& tree_update);
++
++  AXNodeStore(const AXNodeStore&) = delete;
++  AXNodeStore& operator=(const AXNodeStore&) = delete;
++
++  // Returns the node with the given AX id, or nullptr if not present.
++  const ui::AXNodeData* Find(int32_t ax_id) const;
++
++  // Returns the array index of the node with the given AX id, or
++  // kInvalidIndex if not present.
++  size_t IndexOf(int32_t ax_id) const;
++
++  const ui::AXNodeData& at(size_t index) const { return nodes_[index]; }
++  size_t size() const { return nodes_.size(); }
++  bool empty() const { return nodes_.empty(); }
++  const std::vector<ui::AXNodeData>& nodes() const { return nodes_; }
++
++ private:
++  friend class base::RefCountedThreadSafe<AXNodeStore>;
++
++  explicit AXNodeStore(std::vector<ui::AXNodeData> nodes);
++  ~AXNodeStore();
++
++  const std::vector<ui::AXNodeData> nodes_;
++  std::unordered_map<int32_t, size_t> index_by_id_;
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_NODE_STORE_H_
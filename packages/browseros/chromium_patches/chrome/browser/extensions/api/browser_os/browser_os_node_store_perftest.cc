@@ -0,0 +1,107 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_node_store_perftest.cc b/chrome/browser/extensions/api/browser_os/browser_os_node_store_perftest.cc
+new file mode 100644
+index 0000000000000..018df8d8093ef
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_node_store_perftest.cc
+@@ -0,0 +1,101 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_node_store.h"
++
++#include <algorithm>
++#include <atomic>
++#include <optional>
++#include <string>
++
++#include "base/barrier_closure.h"
++#include "base/functional/bind.h"
++#include "base/run_loop.h"
++#include "base/strings/strcat.h"
++#include "base/strings/string_number_conversions.h"
++#include "base/task/thread_pool.h"
++#include "base/test/task_environment.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_ax_corpus.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_perftest_util.h"
++#include "testing/gtest/include/gtest/gtest.h"
++#include "testing/perf/perf_result_reporter.h"
++#include "ui/accessibility/ax_tree_update.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++// Posting a task, running it and dropping its reference costs a handful of
++// allocations. A batch that copied the nodes would cost one per node.
++constexpr size_t kMaxAllocationsPerBatch = 16;
++
++void ReadRange(scoped_refptr<AXNodeStore> store,
++               size_t begin,
++               size_t end,
++               std::atomic<size_t>* seen) {
++  size_t count = 0;
++  for (size_t i = begin; i < end; ++i) {
++    count += store->at(i).child_ids.size();
++  }
++  seen->fetch_add(count, std::memory_order_relaxed);
++}
++
++class BrowserOSNodeStorePerfTest : public testing::Test {
++ protected:
++  // Hands |store| to |batches| thread pool tasks, the way snapshot batches
++  // get it, and returns the allocations that cost.
++  size_t AllocationsForBatches(scoped_refptr<AXNodeStore> store,
++                               size_t batches) {
++    std::atomic<size_t> seen{0};
++    base::RunLoop run_loop;
++    ScopedAllocationCounter counter;
++    base::RepeatingClosure barrier =
++        base::BarrierClosure(batches, run_loop.QuitClosure());
++    size_t grain = (store->size() + batches - 1) / batches;
++    for (size_t i = 0; i < batches; ++i) {
++      size_t begin = std::min(i * grain, store->size());
++      size_t end = std::min(begin + grain, store->size());
++      base::ThreadPool::PostTaskAndReply(
++          FROM_HERE, base::BindOnce(&ReadRange, store, begin, end, &seen),
++          barrier);
++    }
++    run_loop.Run();
++    return counter.count();
++  }
++
++  base::test::TaskEnvironment task_environment_;
++};
++
++// Sharing the store costs the same per batch whatever the size of the tree,
++// so allocations grow with the number of batches only by task overhead.
++TEST_F(BrowserOSNodeStorePerfTest, AllocationsPerBatch) {
++  if (!ScopedAllocationCounter::IsSupported()) {
++    GTEST_SKIP() << "No allocator shim in this build";
++  }
++  std::optional<ui::AXTreeUpdate> update = LoadAXCorpus(kGridCorpus);
++  ASSERT_TRUE(update);
++  scoped_refptr<AXNodeStore> store = AXNodeStore::Create(*update);
++
++  // Warm up the thread pool so its workers are not counted
++  AllocationsForBatches(store, 8);
++
++  size_t one_batch = AllocationsForBatches(store, 1);
++  for (size_t batches : {16u, 128u, 512u}) {
++    size_t allocations = AllocationsForBatches(store, batches);
++    perf_test::PerfResultReporter reporter(
++        "BrowserOS.NodeStore",
++        base::StrCat({"grid_50k_", base::NumberToString(batches), "_batches"}));
++    reporter.RegisterImportantMetric(".allocations", "count");
++    reporter.AddResult(".allocations", allocations);
++    EXPECT_LE(allocations, one_batch + batches * kMaxAllocationsPerBatch)
++        << batches << " batches";
++    EXPECT_LT(allocations, store->size()) << batches << " batches";
++  }
++}
++
++}  // namespace
++
++}  // namespace api
++}  // namespace extensions
@@ -0,0 +1,72 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_node_store_unittest.cc b/chrome/browser/extensions/api/browser_os/browser_os_node_store_unittest.cc
+new file mode 100644
+index 0000000000000..12d5791d142fd
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_node_store_unittest.cc
+@@ -0,0 +1,66 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_node_store.h"
++
++#include "testing/gtest/include/gtest/gtest.h"
++#include "ui/accessibility/ax_enums.mojom.h"
++#include "ui/accessibility/ax_tree_update.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++ui::AXTreeUpdate MakeUpdate() {
++  ui::AXTreeUpdate update;
++  update.root_id = 10;
++  update.nodes.resize(3);
++  update.nodes[0].id = 10;
++  update.nodes[0].role = ax::mojom::Role::kRootWebArea;
++  update.nodes[0].child_ids = {30, 20};
++  update.nodes[1].id = 30;
++  update.nodes[1].role = ax::mojom::Role::kButton;
++  update.nodes[2].id = 20;
++  update.nodes[2].role = ax::mojom::Role::kLink;
++  return update;
++}
++
++TEST(BrowserOSNodeStoreTest, KeepsUpdateOrder) {
++  scoped_refptr<AXNodeStore> store = AXNodeStore::Create(MakeUpdate());
++  ASSERT_EQ(3u, store->size());
++  EXPECT_FALSE(store->empty());
++  EXPECT_EQ(10, store->at(0).id);
++  EXPECT_EQ(30, store->at(1).id);
++  EXPECT_EQ(20, store->at(2).id);
++}
++
++TEST(BrowserOSNodeStoreTest, LooksUpById) {
++  scoped_refptr<AXNodeStore> store = AXNodeStore::Create(MakeUpdate());
++  EXPECT_EQ(1u, store->IndexOf(30));
++  EXPECT_EQ(2u, store->IndexOf(20));
++
++  const ui::AXNodeData* link = store->Find(20);
++  ASSERT_TRUE(link);
++  EXPECT_EQ(ax::mojom::Role::kLink, link->role);
++  EXPECT_EQ(&store->at(2), link);
++}
++
++TEST(BrowserOSNodeStoreTest, MissingId) {
++  scoped_refptr<AXNodeStore> store = AXNodeStore::Create(MakeUpdate());
++  EXPECT_EQ(AXNodeStore::kInvalidIndex, store->IndexOf(40));
++  EXPECT_EQ(nullptr, store->Find(40));
++}
++
++TEST(BrowserOSNodeStoreTest, Empty) {
++  scoped_refptr<AXNodeStore> store = AXNodeStore::Create(ui::AXTreeUpdate());
++  EXPECT_TRUE(store->empty());
++  EXPECT_EQ(0u, store->size());
++  EXPECT_EQ(nullptr, store->Find(1));
++}
++
++}  // namespace
++
++}  // namespace api
++}  // namespace extensions
@@ -0,0 +1,255 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_page_budget.cc b/chrome/browser/extensions/api/browser_os/browser_os_page_budget.cc
+new file mode 100644
+index 0000000000000..60ffdb176eff6
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_page_budget.cc
+@@ -0,0 +1,249 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_page_budget.h"
++
++#include <algorithm>
++#include <string_view>
++#include <unordered_map>
++
++#include "base/check.h"
++#include "base/logging.h"
++#include "base/numerics/safe_conversions.h"
++#include "ui/accessibility/ax_enums.mojom.h"
++#include "ui/accessibility/ax_node_data.h"
++#include "ui/accessibility/ax_role_properties.h"
++#include "ui/accessibility/ax_tree_update.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++// Characters of text per node at which a region counts as fully dense.
++// Navigation menus sit well below this, article bodies above.
++constexpr double kDenseCharsPerNode = 20.0;
++
++// Headings beyond this many do not raise a region's score further.
++constexpr size_t kMaxScoredHeadings = 4;
++
++// Characters in the name of |node|, counted as code points so the budget
++// means the same for every script.
++size_t NameChars(const ui::AXNodeData& node) {
++  std::string_view name =
++      node.GetStringAttribute(ax::mojom::StringAttribute::kName);
++  return std::ranges::count_if(name, [](char c) {
++    return (static_cast<uint8_t>(c) & 0xC0) != 0x80;
++  });
++}
++
++bool IsRegionRole(ax::mojom::Role role) {
++  return ui::IsLandmark(role) || ui::IsDialog(role);
++}
++
++// How much a region of |role| is worth per character.
++double RoleWeight(ax::mojom::Role role) {
++  switch (role) {
++    case ax::mojom::Role::kMain:
++      return 3.0;
++    case ax::mojom::Role::kArticle:
++      return 2.5;
++    case ax::mojom::Role::kRegion:
++      return 1.5;
++    case ax::mojom::Role::kComplementary:
++      return 0.6;
++    case ax::mojom::Role::kForm:
++    case ax::mojom::Role::kSearch:
++      return 0.4;
++    case ax::mojom::Role::kNavigation:
++    case ax::mojom::Role::kBanner:
++    case ax::mojom::Role::kContentInfo:
++      return 0.2;
++    default:
++      // Dialogs and content outside any landmark
++      return 1.0;
++  }
++}
++
++}  // namespace
++
++BudgetedSink::BudgetedSink(PageExtractionSink* inner, size_t max_chars)
++    : inner_(inner), max_chars_(max_chars) {
++  DCHECK(inner_);
++}
++
++BudgetedSink::~BudgetedSink() = default;
++
++void BudgetedSink::Begin(const ui::AXTreeUpdate& tree_update) {
++  const std::vector<ui::AXNodeData>& nodes = tree_update.nodes;
++  nodes_ = nodes.data();
++
++  std::unordered_map<int32_t, size_t> index_by_id;
++  index_by_id.reserve(nodes.size());
++  for (size_t i = 0; i < nodes.size(); ++i) {
++    index_by_id.emplace(nodes[i].id, i);
++  }
++  std::vector<size_t> parent(nodes.size(), kNoNode);
++  for (size_t i = 0; i < nodes.size(); ++i) {
++    for (int32_t child_id : nodes[i].child_ids) {
++      if (auto it = index_by_id.find(child_id); it != index_by_id.end()) {
++        parent[it->second] = i;
++      }
++    }
++  }
++
++  FindRegions(tree_update, parent);
++  GrantBudget(parent);
++  inner_->Begin(tree_update);
++}
++
++void BudgetedSink::FindRegions(const ui::AXTreeUpdate& tree_update,
++                               const std::vector<size_t>& parent) {
++  const std::vector<ui::AXNodeData>& nodes = tree_update.nodes;
++  constexpr uint32_t kUnresolved = 0xFFFFFFFF;
++
++  regions_.clear();
++  regions_.push_back({kNoNode, ax::mojom::Role::kNone});
++  region_of_.assign(nodes.size(), kUnresolved);
++
++  // Walk up to the nearest region root or resolved node, then resolve
++  // every node on the way.
++  std::vector<size_t> walked;
++  for (size_t i = 0; i < nodes.size(); ++i) {
++    uint32_t region = 0;
++    for (size_t current = i; current != kNoNode; current = parent[current]) {
++      if (region_of_[current] != kUnresolved) {
++        region = region_of_[current];
++        break;
++      }
++      walked.push_back(current);
++      const ui::AXNodeData& node = nodes[current];
++      if (!node.IsIgnored() && IsRegionRole(node.role)) {
++        region = base::checked_cast<uint32_t>(regions_.size());
++        regions_.push_back({current, node.role});
++        break;
++      }
++      // Guard against malformed trees with cycles
++      if (walked.size() > nodes.size()) {
++        break;
++      }
++    }
++    for (size_t node_index : walked) {
++      region_of_[node_index] = region;
++    }
++    walked.clear();
++  }
++
++  for (size_t i = 0; i < nodes.size(); ++i) {
++    const ui::AXNodeData& node = nodes[i];
++    if (node.IsIgnored()) {
++      continue;
++    }
++    Region& region = regions_[region_of_[i]];
++    ++region.nodes;
++    if (ui::IsHeading(node.role)) {
++      ++region.headings;
++    } else if (node.role == ax::mojom::Role::kStaticText) {
++      region.text_chars += NameChars(node);
++    }
++  }
++}
++
++void BudgetedSink::GrantBudget(const std::vector<size_t>& parent) {
++  std::vector<uint32_t> ranked;
++  ranked.reserve(regions_.size());
++  size_t total_chars = 0;
++  for (size_t i = 0; i < regions_.size(); ++i) {
++    if (regions_[i].text_chars > 0) {
++      ranked.push_back(base::checked_cast<uint32_t>(i));
++      total_chars += regions_[i].text_chars;
++    }
++  }
++  std::ranges::stable_sort(ranked, [this](uint32_t a, uint32_t b) {
++    return Score(regions_[a]) > Score(regions_[b]);
++  });
++
++  // Whole regions while they fit, then what is left to the next one
++  size_t remaining = max_chars_;
++  for (uint32_t index : ranked) {
++    if (remaining == 0) {
++      break;
++    }
++    Region& region = regions_[index];
++    region.allowance = std::min(region.text_chars, remaining);
++    remaining -= region.allowance;
++  }
++  truncated_ = total_chars > max_chars_;
++
++  // A granted region may sit inside one that got nothing; keep the path to
++  // it open.
++  on_path_.assign(region_of_.size(), false);
++  for (const Region& region : regions_) {
++    if (region.allowance == 0 || region.root == kNoNode) {
++      continue;
++    }
++    for (size_t current = parent[region.root];
++         current != kNoNode && !on_path_[current];
++         current = parent[current]) {
++      on_path_[current] = true;
++    }
++  }
++
++  LOG(INFO) << "[browseros] Page budget " << max_chars_ << " chars over "
++            << ranked.size() << " regions, " << total_chars << " chars of text";
++}
++
++// static
++double BudgetedSink::Score(const Region& region) {
++  double density = std::min(
++      1.0, region.text_chars / (kDenseCharsPerNode * std::max<size_t>(
++                                                         region.nodes, 1)));
++  double headings =
++      1.0 + 0.25 * std::min(region.headings, kMaxScoredHeadings);
++  return RoleWeight(region.role) * headings * (0.5 + 0.5 * density);
++}
++
++bool BudgetedSink::EnterNode(const ui::AXNodeData& node) {
++  if (IsDone()) {
++    return false;
++  }
++  size_t index = static_cast<size_t>(&node - nodes_.get());
++  Region& region = regions_[region_of_[index]];
++  if (region.used >= region.allowance && !on_path_[index]) {
++    return false;
++  }
++
++  bool descend = inner_->EnterNode(node);
++  // Leaves the inner sink consumed whole, and text it reads one by one
++  if (!descend || node.role == ax::mojom::Role::kStaticText) {
++    size_t chars = NameChars(node);
++    region.used += chars;
++    used_ += chars;
++  }
++  return descend;
++}
++
++void BudgetedSink::LeaveNode(const ui::AXNodeData& node) {
++  inner_->LeaveNode(node);
++}
++
++void BudgetedSink::OnSubtreeOmitted(const ui::AXNodeData& node) {
++  // Only mention what the budget would have shown
++  size_t index = static_cast<size_t>(&node - nodes_.get());
++  const Region& region = regions_[region_of_[index]];
++  if (!IsDone() && (region.used < region.allowance || on_path_[index])) {
++    inner_->OnSubtreeOmitted(node);
++  }
++}
++
++void BudgetedSink::Finish() {
++  inner_->Finish();
++}
++
++bool BudgetedSink::IsDone() const {
++  return used_ >= max_chars_;
++}
++
++}  // namespace api
++}  // namespace extensions
@@ -0,0 +1,101 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_page_budget.h b/chrome/browser/extensions/api/browser_os/browser_os_page_budget.h
+new file mode 100644
+index 0000000000000..ac21cdf9329ad
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_page_budget.h
+@@ -0,0 +1,95 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_PAGE_BUDGET_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_PAGE_BUDGET_H_
++
++#include <cstddef>
++#include <cstdint>
++#include <vector>
++
++#include "base/memory/raw_ptr.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_page_extractor.h"
++#include "ui/accessibility/ax_enums.mojom-forward.h"
++
++namespace extensions {
++namespace api {
++
++// Wraps another sink so that it only sees the best parts of the page that
++// fit in a character budget.
++//
++// Begin() splits the page into regions, one per landmark plus one for
++// content outside any landmark, and ranks them by landmark role (main and
++// article over navigation, banner and contentinfo), headings and text
++// density. Regions are granted budget in rank order; regions that get none
++// are hidden from the inner sink, so PageExtractor does not walk them. The
++// walk ends once the budget is spent.
++//
++// The budget counts the text of the nodes the inner sink consumes, so the
++// formatted output of the inner sink is somewhat larger.
++class BudgetedSink : public PageExtractionSink {
++ public:
++  // Rough size of an LLM token, for callers budgeting in tokens.
++  static constexpr size_t kCharsPerToken = 4;
++
++  BudgetedSink(PageExtractionSink* inner, size_t max_chars);
++  ~BudgetedSink() override;
++
++  BudgetedSink(const BudgetedSink&) = delete;
++  BudgetedSink& operator=(const BudgetedSink&) = delete;
++
++  // True if some of the page's text was left out.
++  bool truncated() const { return truncated_; }
++
++  // PageExtractionSink:
++  void Begin(const ui::AXTreeUpdate& tree_update) override;
++  bool EnterNode(const ui::AXNodeData& node) override;
++  void LeaveNode(const ui::AXNodeData& node) override;
++  void OnSubtreeOmitted(const ui::AXNodeData& node) override;
++  void Finish() override;
++  bool IsDone() const override;
++
++ private:
++  struct Region {
++    // Landmark node index, or kNoNode for the content outside landmarks.
++    size_t root;
++    ax::mojom::Role role;
++    size_t nodes = 0;
++    size_t headings = 0;
++    size_t text_chars = 0;
++    // Characters granted and used.
++    size_t allowance = 0;
++    size_t used = 0;
++  };
++
++  static constexpr size_t kNoNode = static_cast<size_t>(-1);
++
++  // Splits the page into regions and fills |region_of_|.
++  void FindRegions(const ui::AXTreeUpdate& tree_update,
++                   const std::vector<size_t>& parent);
++
++  // Grants the budget to regions in rank order and marks the ancestors of
++  // granted regions in |on_path_|.
++  void GrantBudget(const std::vector<size_t>& parent);
++
++  static double Score(const Region& region);
++
++  const raw_ptr<PageExtractionSink> inner_;
++  const size_t max_chars_;
++  size_t used_ = 0;
++  bool truncated_ = false;
++
++  // Base of tree_update.nodes, to turn nodes back into indices.
++  raw_ptr<const ui::AXNodeData, AllowPtrArithmetic> nodes_ = nullptr;
++  std::vector<Region> regions_;
++  // Region of each node.
++  std::vector<uint32_t> region_of_;
++  // Nodes that lead to a granted region from outside it.
++  std::vector<bool> on_path_;
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_PAGE_BUDGET_H_
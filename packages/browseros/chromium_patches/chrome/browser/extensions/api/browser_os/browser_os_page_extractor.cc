@@ -0,0 +1,349 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_page_extractor.cc b/chrome/browser/extensions/api/browser_os/browser_os_page_extractor.cc
+new file mode 100644
+index 0000000000000..d397796c159ef
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_page_extractor.cc
+@@ -0,0 +1,343 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_page_extractor.h"
++
++#include <algorithm>
++#include <cstdint>
++#include <unordered_map>
++
++#include "base/check_op.h"
++#include "base/logging.h"
++#include "base/strings/string_util.h"
++#include "base/strings/utf_string_conversions.h"
++#include "base/synchronization/atomic_flag.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_boilerplate.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_page_budget.h"
++#include "ui/accessibility/ax_enum_util.h"
++#include "ui/accessibility/ax_enums.mojom.h"
++#include "ui/accessibility/ax_node_data.h"
++#include "ui/accessibility/ax_role_properties.h"
++#include "ui/accessibility/ax_tree_update.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++// Nodes visited between checks of the cancel flag.
++constexpr size_t kCancelCheckInterval = 1024;
++
++// Name, else value, trimmed.
++std::string GetNodeText(const ui::AXNodeData& node) {
++  std::string text;
++  if (node.HasStringAttribute(ax::mojom::StringAttribute::kName)) {
++    text = node.GetStringAttribute(ax::mojom::StringAttribute::kName);
++  } else if (node.HasStringAttribute(ax::mojom::StringAttribute::kValue)) {
++    text = node.GetStringAttribute(ax::mojom::StringAttribute::kValue);
++  }
++  return std::string(base::TrimWhitespaceASCII(text, base::TRIM_ALL));
++}
++
++// Appends a blank line unless the text already ends a line.
++void EndBlock(std::u16string& text) {
++  if (!text.empty() && text.back() != u'\n') {
++    text += u"\n\n";
++  }
++}
++
++// Collapses runs of spaces and blank lines and trims the end.
++void CleanupWhitespace(std::u16string& text) {
++  size_t pos = 0;
++  while ((pos = text.find(u"  ", pos)) != std::u16string::npos) {
++    text.replace(pos, 2, u" ");
++  }
++
++  pos = 0;
++  while ((pos = text.find(u"\n\n\n", pos)) != std::u16string::npos) {
++    text.replace(pos, 3, u"\n\n");
++  }
++
++  while (!text.empty() && (text.back() == u' ' || text.back() == u'\n')) {
++    text.pop_back();
++  }
++}
++
++bool IsPlainTextBlock(ax::mojom::Role role) {
++  return role == ax::mojom::Role::kParagraph ||
++         role == ax::mojom::Role::kHeading ||
++         role == ax::mojom::Role::kListItem ||
++         role == ax::mojom::Role::kBlockquote ||
++         role == ax::mojom::Role::kArticle ||
++         role == ax::mojom::Role::kSection;
++}
++
++}  // namespace
++
++PageExtractionOptions::PageExtractionOptions() = default;
++PageExtractionOptions::PageExtractionOptions(const PageExtractionOptions&) =
++    default;
++PageExtractionOptions& PageExtractionOptions::operator=(
++    const PageExtractionOptions&) = default;
++PageExtractionOptions::~PageExtractionOptions() = default;
++
++// static
++bool PageExtractor::Run(const ui::AXTreeUpdate& tree_update,
++                        base::span<PageExtractionSink* const> sinks,
++                        const base::AtomicFlag* cancel) {
++  DCHECK_LE(sinks.size(), kMaxSinks);
++  const std::vector<ui::AXNodeData>& nodes = tree_update.nodes;
++
++  for (PageExtractionSink* sink : sinks) {
++    sink->Begin(tree_update);
++  }
++
++  std::unordered_map<int32_t, size_t> index_by_id;
++  index_by_id.reserve(nodes.size());
++  for (size_t i = 0; i < nodes.size(); ++i) {
++    index_by_id.emplace(nodes[i].id, i);
++  }
++  auto root = index_by_id.find(tree_update.root_id);
++  if (root == index_by_id.end()) {
++    return false;
++  }
++
++  // A node on the walk, with the sinks that entered it.
++  struct Frame {
++    const ui::AXNodeData* node;
++    size_t next_child;
++    uint32_t active;
++  };
++  std::vector<Frame> stack;
++  auto enter = [&](const ui::AXNodeData& node, uint32_t mask) {
++    uint32_t active = 0;
++    for (size_t i = 0; i < sinks.size(); ++i) {
++      uint32_t bit = 1u << i;
++      if ((mask & bit) && sinks[i]->EnterNode(node)) {
++        active |= bit;
++      }
++    }
++    if (active) {
++      stack.push_back({&node, 0, active});
++    }
++  };
++
++  uint32_t all_sinks =
++      sinks.size() == kMaxSinks ? ~0u : (1u << sinks.size()) - 1;
++  enter(nodes[root->second], all_sinks);
++  size_t visited = 0;
++  while (!stack.empty()) {
++    if (cancel && ++visited % kCancelCheckInterval == 0 && cancel->IsSet()) {
++      LOG(INFO) << "[browseros] Page extraction cancelled";
++      return true;
++    }
++
++    if (std::ranges::all_of(sinks, &PageExtractionSink::IsDone)) {
++      break;
++    }
++
++    Frame& frame = stack.back();
++    if (frame.next_child < frame.node->child_ids.size()) {
++      int32_t child_id = frame.node->child_ids[frame.next_child++];
++      uint32_t active = frame.active;
++      if (auto child = index_by_id.find(child_id);
++          child != index_by_id.end()) {
++        enter(nodes[child->second], active);
++      }
++      continue;
++    }
++
++    Frame done = frame;
++    stack.pop_back();
++    for (size_t i = 0; i < sinks.size(); ++i) {
++      if (done.active & (1u << i)) {
++        sinks[i]->LeaveNode(*done.node);
++      }
++    }
++  }
++
++  for (PageExtractionSink* sink : sinks) {
++    sink->Finish();
++  }
++  return true;
++}
++
++// static
++bool PageExtractor::Extract(const ui::AXTreeUpdate& tree_update,
++                            PageExtractionSink* sink,
++                            const PageExtractionOptions& options,
++                            const base::AtomicFlag* cancel,
++                            PageExtractionStats* stats) {
++  // The budget sits inside, so boilerplate never takes its share of it
++  std::optional<BudgetedSink> budgeted;
++  if (options.max_chars) {
++    sink = &budgeted.emplace(sink, *options.max_chars);
++  }
++  std::optional<BoilerplateSink> boilerplate;
++  if (options.boilerplate) {
++    sink = &boilerplate.emplace(sink, options.boilerplate, options.page_url);
++  }
++
++  PageExtractionSink* sinks[] = {sink};
++  bool found_root = Run(tree_update, sinks, cancel);
++  if (stats) {
++    stats->truncated = budgeted && budgeted->truncated();
++    stats->omitted_subtrees = boilerplate ? boilerplate->omitted() : 0;
++    stats->boilerplate_revision = boilerplate ? boilerplate->revision() : 0;
++  }
++  return found_root;
++}
++
++MarkdownSink::MarkdownSink() = default;
++MarkdownSink::~MarkdownSink() = default;
++
++bool MarkdownSink::EnterNode(const ui::AXNodeData& node) {
++  // Invisible and ignored nodes only pass their children through
++  if (node.IsInvisibleOrIgnored()) {
++    return true;
++  }
++
++  // Navigation is set apart from the main content
++  if (node.role == ax::mojom::Role::kNavigation ||
++      node.role == ax::mojom::Role::kBanner) {
++    EndBlock(text_);
++    return true;
++  }
++
++  // Headings, links, images and text end the descent, so their child text
++  // is not extracted twice
++  if (ui::IsHeading(node.role)) {
++    int level = 2;
++    if (node.HasIntAttribute(ax::mojom::IntAttribute::kHierarchicalLevel)) {
++      level = std::clamp(
++          node.GetIntAttribute(ax::mojom::IntAttribute::kHierarchicalLevel), 1,
++          6);
++    }
++    std::u16string heading = base::UTF8ToUTF16(GetNodeText(node));
++    if (!heading.empty()) {
++      EndBlock(text_);
++      text_ += std::u16string(level, u'#') + u" " + heading + u"\n\n";
++    }
++    return false;
++  }
++
++  if (ui::IsLink(node.role)) {
++    std::u16string link = base::UTF8ToUTF16(GetNodeText(node));
++    if (!link.empty()) {
++      text_ += link + u" ";
++    }
++    return false;
++  }
++
++  if (ui::IsImage(node.role)) {
++    std::u16string alt = base::UTF8ToUTF16(GetNodeText(node));
++    if (!alt.empty()) {
++      text_ += u"[Image: " + alt + u"] ";
++    }
++    return false;
++  }
++
++  if (ui::IsText(node.role)) {
++    std::u16string content = base::UTF8ToUTF16(GetNodeText(node));
++    if (!content.empty()) {
++      if (!text_.empty() && text_.back() != u' ' && text_.back() != u'\n') {
++        text_ += u" ";
++      }
++      text_ += content;
++    }
++    return false;
++  }
++
++  if (node.role == ax::mojom::Role::kList) {
++    ++list_depth_;
++    return true;
++  }
++
++  // List items start a new line, indented by list nesting
++  if (node.role == ax::mojom::Role::kListItem) {
++    if (!text_.empty() && text_.back() != u'\n') {
++      text_ += u"\n";
++    }
++    if (list_depth_ > 0) {
++      text_ += std::u16string(list_depth_, u'\t');
++    }
++    return true;
++  }
++
++  if (node.role == ax::mojom::Role::kParagraph) {
++    EndBlock(text_);
++  }
++  return true;
++}
++
++void MarkdownSink::LeaveNode(const ui::AXNodeData& node) {
++  if (node.IsInvisibleOrIgnored()) {
++    return;
++  }
++
++  switch (node.role) {
++    case ax::mojom::Role::kNavigation:
++    case ax::mojom::Role::kBanner:
++      text_ += u"\n\n";
++      break;
++    case ax::mojom::Role::kList:
++      --list_depth_;
++      break;
++    case ax::mojom::Role::kParagraph:
++    case ax::mojom::Role::kSection:
++    case ax::mojom::Role::kArticle:
++      EndBlock(text_);
++      break;
++    default:
++      break;
++  }
++}
++
++void MarkdownSink::OnSubtreeOmitted(const ui::AXNodeData& node) {
++  EndBlock(text_);
++  text_ += u"[Repeated " + base::UTF8ToUTF16(ui::ToString(node.role)) +
++           u" omitted]\n\n";
++}
++
++void MarkdownSink::Finish() {
++  CleanupWhitespace(text_);
++}
++
++PlainTextSink::PlainTextSink() = default;
++PlainTextSink::~PlainTextSink() = default;
++
++bool PlainTextSink::EnterNode(const ui::AXNodeData& node) {
++  if (node.role == ax::mojom::Role::kStaticText ||
++      node.role == ax::mojom::Role::kInlineTextBox) {
++    std::u16string content =
++        node.GetString16Attribute(ax::mojom::StringAttribute::kName);
++    if (content.empty()) {
++      content = node.GetString16Attribute(ax::mojom::StringAttribute::kValue);
++    }
++    if (!content.empty()) {
++      if (!text_.empty() && text_.back() != u' ' && text_.back() != u'\n') {
++        text_ += u" ";
++      }
++      text_ += content;
++    }
++  }
++
++  if (node.role == ax::mojom::Role::kLineBreak) {
++    text_ += u"\n";
++  }
++
++  if (IsPlainTextBlock(node.role)) {
++    EndBlock(text_);
++  }
++  return true;
++}
++
++void PlainTextSink::LeaveNode(const ui::AXNodeData& node) {
++  if (IsPlainTextBlock(node.role)) {
++    EndBlock(text_);
++  }
++}
++
++}  // namespace api
++}  // namespace extensions
@@ -0,0 +1,163 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_page_extractor.h b/chrome/browser/extensions/api/browser_os/browser_os_page_extractor.h
+new file mode 100644
+index 0000000000000..8457c2e9d2944
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_page_extractor.h
+@@ -0,0 +1,157 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_PAGE_EXTRACTOR_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_PAGE_EXTRACTOR_H_
++
++#include <cstddef>
++#include <cstdint>
++#include <optional>
++#include <string>
++#include <utility>
++#include <vector>
++
++#include "base/containers/span.h"
++#include "base/memory/scoped_refptr.h"
++#include "url/gurl.h"
++
++namespace base {
++class AtomicFlag;
++}  // namespace base
++
++namespace ui {
++struct AXNodeData;
++struct AXTreeUpdate;
++}  // namespace ui
++
++namespace extensions {
++namespace api {
++
++class BoilerplateRegistry;
++
++// Receives the nodes of one PageExtractor walk. Each sink turns them into
++// one output format.
++class PageExtractionSink {
++ public:
++  virtual ~PageExtractionSink() = default;
++
++  // Called once before the walk.
++  virtual void Begin(const ui::AXTreeUpdate& tree_update) {}
++
++  // Called when the walk reaches |node|, an element of the nodes passed to
++  // Begin(), in document order. Returning false hides the node's subtree
++  // from this sink and skips its LeaveNode().
++  virtual bool EnterNode(const ui::AXNodeData& node) = 0;
++
++  // Called after the subtree of a node whose EnterNode() returned true.
++  virtual void LeaveNode(const ui::AXNodeData& node) {}
++
++  // Called instead of EnterNode() for a subtree that a wrapping sink left
++  // out as repeated page chrome (see BoilerplateSink).
++  virtual void OnSubtreeOmitted(const ui::AXNodeData& node) {}
++
++  // Called once after the walk, unless it was cancelled.
++  virtual void Finish() {}
++
++  // True once the sink wants no more nodes. The walk ends when every sink
++  // is done.
++  virtual bool IsDone() const { return false; }
++};
++
++// How PageExtractor::Extract() trims a page.
++struct PageExtractionOptions {
++  PageExtractionOptions();
++  PageExtractionOptions(const PageExtractionOptions&);
++  PageExtractionOptions& operator=(const PageExtractionOptions&);
++  ~PageExtractionOptions();
++
++  // Keep only the best ranked content that fits (see BudgetedSink).
++  std::optional<size_t> max_chars;
++  // If set, leave out subtrees that other pages of |page_url|'s origin
++  // repeat (see BoilerplateSink).
++  scoped_refptr<BoilerplateRegistry> boilerplate;
++  GURL page_url;
++};
++
++// What PageExtractor::Extract() left out.
++struct PageExtractionStats {
++  bool truncated = false;
++  size_t omitted_subtrees = 0;
++  // BoilerplateRegistry::revision() the omitted subtrees were chosen at.
++  uint64_t boilerplate_revision = 0;
++};
++
++// Walks an accessibility tree once, depth first from the root, and feeds
++// every sink. A subtree is only walked while some sink still wants it, so
++// several formats cost about as much as the most thorough one, and the walk
++// ends early once every sink is done.
++//
++// Safe to call off the UI thread.
++class PageExtractor {
++ public:
++  // Sinks per walk; each gets a bit in the per-node mask.
++  static constexpr size_t kMaxSinks = 32;
++
++  PageExtractor() = delete;
++  PageExtractor(const PageExtractor&) = delete;
++  PageExtractor& operator=(const PageExtractor&) = delete;
++
++  // Feeds |tree_update| to |sinks|. Stops early, skipping Finish(), if
++  // |cancel| is set. Returns false if the root is not in the tree.
++  static bool Run(const ui::AXTreeUpdate& tree_update,
++                  base::span<PageExtractionSink* const> sinks,
++                  const base::AtomicFlag* cancel = nullptr);
++
++  // Feeds |tree_update| to |sink| through the wrappers |options| ask for,
++  // and fills |stats| if given. Same return value as Run().
++  static bool Extract(const ui::AXTreeUpdate& tree_update,
++                      PageExtractionSink* sink,
++                      const PageExtractionOptions& options,
++                      const base::AtomicFlag* cancel = nullptr,
++                      PageExtractionStats* stats = nullptr);
++};
++
++// Markdown-like text for LLM prompts: headings as "#", list items indented
++// with tabs, link text without URLs, images as "[Image: alt]" and omitted
++// boilerplate as "[Repeated navigation omitted]".
++class MarkdownSink : public PageExtractionSink {
++ public:
++  MarkdownSink();
++  ~MarkdownSink() override;
++
++  std::u16string TakeText() { return std::move(text_); }
++
++  // PageExtractionSink:
++  bool EnterNode(const ui::AXNodeData& node) override;
++  void LeaveNode(const ui::AXNodeData& node) override;
++  void OnSubtreeOmitted(const ui::AXNodeData& node) override;
++  void Finish() override;
++
++ private:
++  std::u16string text_;
++  // Nesting of the current list; -1 outside lists.
++  int list_depth_ = -1;
++};
++
++// Plain text with paragraph breaks, for pasting a page into a prompt.
++// Reads every text node, including those inside navigation and buttons.
++class PlainTextSink : public PageExtractionSink {
++ public:
++  PlainTextSink();
++  ~PlainTextSink() override;
++
++  std::u16string TakeText() { return std::move(text_); }
++
++  // PageExtractionSink:
++  bool EnterNode(const ui::AXNodeData& node) override;
++  void LeaveNode(const ui::AXNodeData& node) override;
++
++ private:
++  std::u16string text_;
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_PAGE_EXTRACTOR_H_
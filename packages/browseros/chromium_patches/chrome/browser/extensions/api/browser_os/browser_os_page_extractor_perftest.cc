@@ -0,0 +1,101 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_page_extractor_perftest.cc b/chrome/browser/extensions/api/browser_os/browser_os_page_extractor_perftest.cc
+new file mode 100644
+index 0000000000000..9f516c9d4cc71
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_page_extractor_perftest.cc
+@@ -0,0 +1,95 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include <optional>
++#include <string>
++
++#include "base/strings/string_util.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_ax_corpus.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_content_processor.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_legacy_extraction.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_page_extractor.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_perftest_util.h"
++#include "testing/gtest/include/gtest/gtest.h"
++#include "ui/accessibility/ax_tree_update.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++constexpr int kIterations = 10;
++
++// Content items, markdown and plain text for one page: first through the
++// three walks PageExtractor replaced, then through three PageExtractor runs,
++// then through one run feeding all three sinks.
++class BrowserOSPageExtractorPerfTest
++    : public testing::TestWithParam<const char*> {
++ protected:
++  void SetUp() override {
++    update_ = LoadAXCorpus(GetParam());
++    ASSERT_TRUE(update_) << "Could not load " << GetParam();
++  }
++
++  std::string Story() const {
++    std::string story(GetParam());
++    base::ReplaceSubstringsAfterOffset(&story, 0, ".axtree", "");
++    return story;
++  }
++
++  std::optional<ui::AXTreeUpdate> update_;
++};
++
++TEST_P(BrowserOSPageExtractorPerfTest, AllFormats) {
++  const ui::AXTreeUpdate& update = *update_;
++  size_t nodes = update.nodes.size();
++
++  PerfMeasurement legacy = MeasureRuns(nodes, kIterations, [&] {
++    LegacyExtractPageContent(update);
++    LegacyExtractStructuredText(update);
++    LegacyExtractPlainText(update);
++  });
++
++  PerfMeasurement separate = MeasureRuns(nodes, kIterations, [&] {
++    ContentItemSink items;
++    MarkdownSink markdown;
++    PlainTextSink plain_text;
++    for (PageExtractionSink* sink :
++         {static_cast<PageExtractionSink*>(&items),
++          static_cast<PageExtractionSink*>(&markdown),
++          static_cast<PageExtractionSink*>(&plain_text)}) {
++      PageExtractionSink* sinks[] = {sink};
++      PageExtractor::Run(update, sinks);
++    }
++  });
++
++  PerfMeasurement shared = MeasureRuns(nodes, kIterations, [&] {
++    ContentItemSink items;
++    MarkdownSink markdown;
++    PlainTextSink plain_text;
++    PageExtractionSink* sinks[] = {&items, &markdown, &plain_text};
++    PageExtractor::Run(update, sinks);
++  });
++
++  ReportMeasurement("BrowserOS.AllFormatsLegacy", Story(), legacy);
++  ReportMeasurement("BrowserOS.AllFormatsSeparate", Story(), separate);
++  ReportMeasurement("BrowserOS.AllFormatsShared", Story(), shared);
++
++  if (ScopedAllocationCounter::IsSupported()) {
++    EXPECT_LT(shared.allocations_per_run, legacy.allocations_per_run);
++    EXPECT_LE(shared.allocations_per_run, separate.allocations_per_run);
++  }
++}
++
++INSTANTIATE_TEST_SUITE_P(All,
++                         BrowserOSPageExtractorPerfTest,
++                         testing::Values(kSmallFormCorpus,
++                                         kNewsPageCorpus,
++                                         kGridCorpus,
++                                         kIframeNestCorpus));
++
++}  // namespace
++
++}  // namespace api
++}  // namespace extensions
@@ -0,0 +1,179 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_page_extractor_unittest.cc b/chrome/browser/extensions/api/browser_os/browser_os_page_extractor_unittest.cc
+new file mode 100644
+index 0000000000000..76088add0ddd0
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_page_extractor_unittest.cc
+@@ -0,0 +1,173 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_page_extractor.h"
++
++#include <optional>
++#include <string>
++#include <vector>
++
++#include "base/strings/strcat.h"
++#include "base/strings/string_number_conversions.h"
++#include "base/synchronization/atomic_flag.h"
++#include "base/values.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_ax_corpus.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_content_processor.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_legacy_extraction.h"
++#include "testing/gtest/include/gtest/gtest.h"
++#include "ui/accessibility/ax_node_data.h"
++#include "ui/accessibility/ax_tree_update.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++constexpr char kArticle[] =
++    "1\t-\trootWebArea\t-\tPage\n"
++    "2\t1\theading\tlevel=3\tTitle\n"
++    "3\t2\tstaticText\t-\tTitle\n"
++    "4\t1\tparagraph\t-\t\n"
++    "5\t4\tstaticText\t-\tHello world\n"
++    "6\t1\tlist\t-\t\n"
++    "7\t6\tlistItem\t-\t\n"
++    "8\t7\tstaticText\t-\tOne\n"
++    "9\t6\tlistItem\t-\t\n"
++    "10\t9\tstaticText\t-\tTwo\n";
++
++// Records the calls it gets, and declines to enter |skip_id|.
++class RecordingSink : public PageExtractionSink {
++ public:
++  explicit RecordingSink(int32_t skip_id = -1) : skip_id_(skip_id) {}
++
++  bool EnterNode(const ui::AXNodeData& node) override {
++    calls_.push_back(base::StrCat({"+", base::NumberToString(node.id)}));
++    return node.id != skip_id_;
++  }
++  void LeaveNode(const ui::AXNodeData& node) override {
++    calls_.push_back(base::StrCat({"-", base::NumberToString(node.id)}));
++  }
++  void Finish() override { finished_ = true; }
++
++  const std::vector<std::string>& calls() const { return calls_; }
++  bool finished() const { return finished_; }
++
++ private:
++  const int32_t skip_id_;
++  std::vector<std::string> calls_;
++  bool finished_ = false;
++};
++
++TEST(BrowserOSPageExtractorTest, EntersAndLeavesInDocumentOrder) {
++  std::optional<ui::AXTreeUpdate> update = ParseAXCorpus(kArticle);
++  ASSERT_TRUE(update);
++  RecordingSink sink(/*skip_id=*/6);
++  PageExtractionSink* sinks[] = {&sink};
++  EXPECT_TRUE(PageExtractor::Run(*update, sinks));
++  EXPECT_EQ((std::vector<std::string>{"+1", "+2", "+3", "-3", "-2", "+4",
++                                      "+5", "-5", "-4", "+6", "-1"}),
++            sink.calls());
++  EXPECT_TRUE(sink.finished());
++}
++
++// A subtree one sink declines is still walked for the others
++TEST(BrowserOSPageExtractorTest, SinksDeclineIndependently) {
++  std::optional<ui::AXTreeUpdate> update = ParseAXCorpus(kArticle);
++  ASSERT_TRUE(update);
++  RecordingSink declines(/*skip_id=*/1);
++  RecordingSink enters_all;
++  PageExtractionSink* sinks[] = {&declines, &enters_all};
++  EXPECT_TRUE(PageExtractor::Run(*update, sinks));
++  EXPECT_EQ((std::vector<std::string>{"+1"}), declines.calls());
++  EXPECT_EQ(20u, enters_all.calls().size());
++}
++
++TEST(BrowserOSPageExtractorTest, MissingRoot) {
++  std::optional<ui::AXTreeUpdate> update = ParseAXCorpus(kArticle);
++  ASSERT_TRUE(update);
++  update->root_id = 99;
++  RecordingSink sink;
++  PageExtractionSink* sinks[] = {&sink};
++  EXPECT_FALSE(PageExtractor::Run(*update, sinks));
++  EXPECT_TRUE(sink.calls().empty());
++}
++
++TEST(BrowserOSPageExtractorTest, CancelSkipsFinish) {
++  std::optional<ui::AXTreeUpdate> update = LoadAXCorpus(kNewsPageCorpus);
++  ASSERT_TRUE(update);
++  base::AtomicFlag cancel;
++  cancel.Set();
++  RecordingSink sink;
++  PageExtractionSink* sinks[] = {&sink};
++  PageExtractor::Run(*update, sinks, &cancel);
++  EXPECT_FALSE(sink.finished());
++  EXPECT_LT(sink.calls().size(), 2 * update->nodes.size());
++}
++
++TEST(BrowserOSPageExtractorTest, Markdown) {
++  std::optional<ui::AXTreeUpdate> update = ParseAXCorpus(kArticle);
++  ASSERT_TRUE(update);
++  MarkdownSink sink;
++  PageExtractionSink* sinks[] = {&sink};
++  ASSERT_TRUE(PageExtractor::Run(*update, sinks));
++  EXPECT_EQ(u"### Title\n\nHello world\n\nOne\nTwo", sink.TakeText());
++}
++
++TEST(BrowserOSPageExtractorTest, PlainText) {
++  std::optional<ui::AXTreeUpdate> update = ParseAXCorpus(kArticle);
++  ASSERT_TRUE(update);
++  PlainTextSink sink;
++  PageExtractionSink* sinks[] = {&sink};
++  ASSERT_TRUE(PageExtractor::Run(*update, sinks));
++  EXPECT_EQ(u"Title\n\nHello world\n\nOne\n\nTwo\n\n", sink.TakeText());
++}
++
++// Each sink gives what the walk it replaced gave, whether it runs alone or
++// shares the walk with the others.
++TEST(BrowserOSPageExtractorTest, MatchesLegacyWalks) {
++  for (const char* name : {kSmallFormCorpus, kNewsPageCorpus, kGridCorpus,
++                           kIframeNestCorpus}) {
++    SCOPED_TRACE(name);
++    std::optional<ui::AXTreeUpdate> update = LoadAXCorpus(name);
++    ASSERT_TRUE(update);
++    std::u16string legacy_markdown = LegacyExtractStructuredText(*update);
++    std::u16string legacy_plain_text = LegacyExtractPlainText(*update);
++    EXPECT_FALSE(legacy_markdown.empty());
++    EXPECT_FALSE(legacy_plain_text.empty());
++
++    MarkdownSink markdown;
++    PageExtractionSink* markdown_only[] = {&markdown};
++    ASSERT_TRUE(PageExtractor::Run(*update, markdown_only));
++    EXPECT_EQ(legacy_markdown, markdown.TakeText());
++
++    PlainTextSink plain_text;
++    PageExtractionSink* plain_text_only[] = {&plain_text};
++    ASSERT_TRUE(PageExtractor::Run(*update, plain_text_only));
++    EXPECT_EQ(legacy_plain_text, plain_text.TakeText());
++
++    ContentItemSink items;
++    MarkdownSink shared_markdown;
++    PlainTextSink shared_plain_text;
++    PageExtractionSink* all[] = {&items, &shared_markdown, &shared_plain_text};
++    ASSERT_TRUE(PageExtractor::Run(*update, all));
++    EXPECT_EQ(legacy_markdown, shared_markdown.TakeText());
++    EXPECT_EQ(legacy_plain_text, shared_plain_text.TakeText());
++
++    base::Value::List shared_items;
++    for (const browser_os::ContentItem& item : items.TakeItems()) {
++      shared_items.Append(item.ToValue());
++    }
++    base::Value::List legacy_items;
++    for (const browser_os::ContentItem& item :
++         LegacyExtractPageContent(*update)) {
++      legacy_items.Append(item.ToValue());
++    }
++    EXPECT_EQ(legacy_items, shared_items);
++  }
++}
++
++}  // namespace
++
++}  // namespace api
++}  // namespace extensions
@@ -0,0 +1,32 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_perf.cc b/chrome/browser/extensions/api/browser_os/browser_os_perf.cc
+new file mode 100644
+index 0000000000000..ceac94db1a9ee
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_perf.cc
+@@ -0,0 +1,26 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_perf.h"
++
++#include <cstdint>
++
++#include "base/logging.h"
++
++namespace extensions {
++namespace api {
++
++void LogPerfRecord(std::string_view stage,
++                   size_t nodes,
++                   size_t items,
++                   base::TimeDelta elapsed) {
++  int64_t wall_ns = elapsed.InNanoseconds();
++  int64_t ns_per_node = nodes ? wall_ns / static_cast<int64_t>(nodes) : 0;
++  VLOG(1) << "[PERF] stage=" << stage << " nodes=" << nodes
++          << " items=" << items << " wall_us=" << wall_ns / 1000
++          << " ns_per_node=" << ns_per_node;
++}
++
++}  // namespace api
++}  // namespace extensions
@@ -0,0 +1,39 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_perf.h b/chrome/browser/extensions/api/browser_os/browser_os_perf.h
+new file mode 100644
+index 0000000000000..d0db3e8e06bee
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_perf.h
+@@ -0,0 +1,33 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_PERF_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_PERF_H_
++
++#include <cstddef>
++#include <string_view>
++
++#include "base/time/time.h"
++
++namespace extensions {
++namespace api {
++
++// Logs one machine-readable record for a processing stage:
++//
++//   [PERF] stage=<stage> nodes=<n> items=<m> wall_us=<t> ns_per_node=<t/n>
++//
++// |nodes| is the number of AX nodes the stage was given and |items| the
++// size of what it produced (elements, content items or characters). Every
++// extraction path logs the same record, so runs over the same pages can be
++// compared across builds by grepping the --vmodule=browser_os_perf=1 log for
++// "[PERF] stage=".
++void LogPerfRecord(std::string_view stage,
++                   size_t nodes,
++                   size_t items,
++                   base::TimeDelta elapsed);
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_PERF_H_
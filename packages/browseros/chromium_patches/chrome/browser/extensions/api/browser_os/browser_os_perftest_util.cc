@@ -0,0 +1,167 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_perftest_util.cc b/chrome/browser/extensions/api/browser_os/browser_os_perftest_util.cc
+new file mode 100644
+index 0000000000000..0432dcb7906e8
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_perftest_util.cc
+@@ -0,0 +1,161 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_perftest_util.h"
++
++#include <atomic>
++#include <string_view>
++#include <tuple>
++#include <vector>
++
++#include "base/allocator/dispatcher/dispatcher.h"
++#include "base/allocator/dispatcher/notification_data.h"
++#include "base/files/file_path.h"
++#include "base/files/file_util.h"
++#include "base/strings/string_number_conversions.h"
++#include "base/strings/string_split.h"
++#include "base/threading/thread_restrictions.h"
++#include "base/timer/elapsed_timer.h"
++#include "build/build_config.h"
++#include "partition_alloc/buildflags.h"
++#include "testing/perf/perf_result_reporter.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++std::atomic<size_t> g_allocations{0};
++std::atomic<size_t> g_allocated_bytes{0};
++
++struct AllocationObserver {
++  void OnAllocation(
++      const base::allocator::dispatcher::AllocationNotificationData& data) {
++    g_allocations.fetch_add(1, std::memory_order_relaxed);
++    g_allocated_bytes.fetch_add(data.size(), std::memory_order_relaxed);
++  }
++  void OnFree(const base::allocator::dispatcher::FreeNotificationData&) {}
++};
++
++AllocationObserver g_observer;
++
++}  // namespace
++
++ScopedAllocationCounter::ScopedAllocationCounter() {
++  g_allocations.store(0, std::memory_order_relaxed);
++  g_allocated_bytes.store(0, std::memory_order_relaxed);
++  if (IsSupported()) {
++    base::allocator::dispatcher::Dispatcher::GetInstance().Initialize(
++        std::make_tuple(&g_observer));
++  }
++}
++
++ScopedAllocationCounter::~ScopedAllocationCounter() {
++  if (IsSupported()) {
++    base::allocator::dispatcher::Dispatcher::GetInstance().ResetForTesting();
++  }
++}
++
++// static
++bool ScopedAllocationCounter::IsSupported() {
++#if PA_BUILDFLAG(USE_ALLOCATOR_SHIM)
++  return true;
++#else
++  return false;
++#endif
++}
++
++size_t ScopedAllocationCounter::count() const {
++  return g_allocations.load(std::memory_order_relaxed);
++}
++
++size_t ScopedAllocationCounter::bytes() const {
++  return g_allocated_bytes.load(std::memory_order_relaxed);
++}
++
++std::optional<size_t> GetPeakRssBytes() {
++#if BUILDFLAG(IS_LINUX) || BUILDFLAG(IS_CHROMEOS)
++  base::ScopedAllowBlockingForTesting allow_blocking;
++  std::string status;
++  if (!base::ReadFileToString(base::FilePath("/proc/self/status"), &status)) {
++    return std::nullopt;
++  }
++  // "VmHWM:    123456 kB"
++  for (std::string_view line : base::SplitStringPiece(
++           status, "\n", base::TRIM_WHITESPACE, base::SPLIT_WANT_NONEMPTY)) {
++    if (!line.starts_with("VmHWM:")) {
++      continue;
++    }
++    std::vector<std::string_view> parts =
++        base::SplitStringPiece(line.substr(6), " ", base::TRIM_WHITESPACE,
++                               base::SPLIT_WANT_NONEMPTY);
++    size_t kilobytes;
++    if (!parts.empty() && base::StringToSizeT(parts[0], &kilobytes)) {
++      return kilobytes * 1024;
++    }
++  }
++#endif
++  return std::nullopt;
++}
++
++void ResetPeakRss() {
++#if BUILDFLAG(IS_LINUX) || BUILDFLAG(IS_CHROMEOS)
++  // Writing 5 to clear_refs sets the peak back to the current RSS
++  base::ScopedAllowBlockingForTesting allow_blocking;
++  base::WriteFile(base::FilePath("/proc/self/clear_refs"), "5");
++#endif
++}
++
++PerfMeasurement MeasureRuns(size_t nodes,
++                            int iterations,
++                            base::FunctionRef<void()> body) {
++  PerfMeasurement measurement;
++  body();
++
++  // Timed runs go without the allocation hooks, which slow every
++  // allocation down
++  ResetPeakRss();
++  base::ElapsedTimer timer;
++  for (int i = 0; i < iterations; ++i) {
++    body();
++  }
++  base::TimeDelta elapsed = timer.Elapsed();
++  measurement.time_per_run = elapsed / iterations;
++  if (nodes) {
++    measurement.ns_per_node = elapsed.InNanosecondsF() /
++                              (static_cast<double>(iterations) * nodes);
++  }
++  measurement.peak_rss_bytes = GetPeakRssBytes();
++
++  {
++    ScopedAllocationCounter counter;
++    body();
++    measurement.allocations_per_run = counter.count();
++  }
++  return measurement;
++}
++
++void ReportMeasurement(const std::string& metric,
++                       const std::string& story,
++                       const PerfMeasurement& measurement) {
++  perf_test::PerfResultReporter reporter(metric, story);
++  reporter.RegisterImportantMetric(".ns_per_node", "ns");
++  reporter.RegisterImportantMetric(".time_per_run", "ms");
++  reporter.RegisterImportantMetric(".allocations", "count");
++  reporter.RegisterImportantMetric(".peak_rss", "bytes");
++
++  reporter.AddResult(".time_per_run", measurement.time_per_run);
++  if (measurement.ns_per_node > 0) {
++    reporter.AddResult(".ns_per_node", measurement.ns_per_node);
++  }
++  if (ScopedAllocationCounter::IsSupported()) {
++    reporter.AddResult(".allocations", measurement.allocations_per_run);
++  }
++  if (measurement.peak_rss_bytes) {
++    reporter.AddResult(".peak_rss", *measurement.peak_rss_bytes);
++  }
++}
++
++}  // namespace api
++}  // namespace extensions
@@ -0,0 +1,76 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_perftest_util.h b/chrome/browser/extensions/api/browser_os/browser_os_perftest_util.h
+new file mode 100644
+index 0000000000000..9e17043b3aae6
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_perftest_util.h
+@@ -0,0 +1,70 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_PERFTEST_UTIL_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_PERFTEST_UTIL_H_
++
++#include <cstddef>
++#include <optional>
++#include <string>
++
++#include "base/functional/function_ref.h"
++#include "base/time/time.h"
++
++namespace extensions {
++namespace api {
++
++// Counts heap allocations made on any thread while it is alive, through the
++// allocator dispatcher. Only one may exist at a time, and none while
++// something else owns the dispatcher.
++class ScopedAllocationCounter {
++ public:
++  ScopedAllocationCounter();
++  ~ScopedAllocationCounter();
++
++  ScopedAllocationCounter(const ScopedAllocationCounter&) = delete;
++  ScopedAllocationCounter& operator=(const ScopedAllocationCounter&) = delete;
++
++  // False in builds without the allocator shim, where count() stays 0.
++  static bool IsSupported();
++
++  // Allocations since construction.
++  size_t count() const;
++  // Bytes requested by those allocations, whether or not freed since.
++  size_t bytes() const;
++};
++
++// Peak resident set size of the process in bytes, or nullopt where the
++// platform does not report one.
++std::optional<size_t> GetPeakRssBytes();
++
++// Restarts the peak at the current RSS, so the next GetPeakRssBytes() only
++// sees what ran after this call. Does nothing where unsupported.
++void ResetPeakRss();
++
++// What one measured body cost per run.
++struct PerfMeasurement {
++  base::TimeDelta time_per_run;
++  // Time per input node, when the body was given a node count.
++  double ns_per_node = 0;
++  size_t allocations_per_run = 0;
++  std::optional<size_t> peak_rss_bytes;
++};
++
++// Runs |body| once to warm up, then |iterations| times while timing and
++// counting allocations. |nodes| is the size of the input of each run.
++PerfMeasurement MeasureRuns(size_t nodes,
++                            int iterations,
++                            base::FunctionRef<void()> body);
++
++// Reports |measurement| as <metric>.ns_per_node, <metric>.allocations and
++// <metric>.peak_rss for |story|, in the format perf dashboards read.
++void ReportMeasurement(const std::string& metric,
++                       const std::string& story,
++                       const PerfMeasurement& measurement);
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_PERFTEST_UTIL_H_
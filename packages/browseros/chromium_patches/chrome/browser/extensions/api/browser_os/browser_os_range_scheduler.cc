@@ -0,0 +1,135 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_range_scheduler.cc b/chrome/browser/extensions/api/browser_os/browser_os_range_scheduler.cc
+new file mode 100644
+index 0000000000000..db6cc9ca4c3ba
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_range_scheduler.cc
+@@ -0,0 +1,129 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_range_scheduler.h"
++
++#include <algorithm>
++#include <atomic>
++#include <utility>
++
++#include "base/check.h"
++#include "base/functional/bind.h"
++#include "base/memory/ref_counted.h"
++#include "base/memory/scoped_refptr.h"
++#include "base/system/sys_info.h"
++#include "base/task/sequenced_task_runner.h"
++#include "base/task/thread_pool.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++// Below this many items per worker, the cost of another task outweighs the
++// parallelism it buys.
++constexpr size_t kMinItemsPerWorker = 128;
++
++// Each worker should get to claim about this many ranges, so uneven ranges
++// even out between workers.
++constexpr size_t kRangesPerWorker = 4;
++
++constexpr size_t kMinGrain = 32;
++constexpr size_t kMaxGrain = 512;
++
++// State shared by all workers of one Run().
++class SharedRun : public base::RefCountedThreadSafe<SharedRun> {
++ public:
++  SharedRun(size_t count,
++            size_t grain,
++            size_t workers,
++            RangeScheduler::RangeCallback work,
++            RangeScheduler::RangeCallback range_done,
++            base::OnceClosure done)
++      : count_(count),
++        grain_(grain),
++        remaining_workers_(workers),
++        work_(std::move(work)),
++        range_done_(std::move(range_done)),
++        done_(std::move(done)),
++        reply_runner_(base::SequencedTaskRunner::GetCurrentDefault()) {}
++
++  SharedRun(const SharedRun&) = delete;
++  SharedRun& operator=(const SharedRun&) = delete;
++
++  void RunWorker() {
++    while (true) {
++      size_t begin = cursor_.fetch_add(grain_, std::memory_order_relaxed);
++      if (begin >= count_) {
++        break;
++      }
++      size_t end = std::min(begin + grain_, count_);
++      work_.Run(begin, end);
++      if (range_done_) {
++        reply_runner_->PostTask(FROM_HERE,
++                                base::BindOnce(range_done_, begin, end));
++      }
++    }
++
++    // The last worker out replies. acq_rel makes every other worker's writes
++    // visible to it, and so to the reply.
++    if (remaining_workers_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
++      reply_runner_->PostTask(FROM_HERE, std::move(done_));
++    }
++  }
++
++ private:
++  friend class base::RefCountedThreadSafe<SharedRun>;
++  ~SharedRun() = default;
++
++  const size_t count_;
++  const size_t grain_;
++  std::atomic<size_t> cursor_{0};
++  std::atomic<size_t> remaining_workers_;
++  const RangeScheduler::RangeCallback work_;
++  const RangeScheduler::RangeCallback range_done_;
++  base::OnceClosure done_;
++  const scoped_refptr<base::SequencedTaskRunner> reply_runner_;
++};
++
++}  // namespace
++
++// static
++RangeScheduler::Plan RangeScheduler::PlanFor(size_t count) {
++  Plan plan;
++  size_t cores =
++      static_cast<size_t>(std::max(1, base::SysInfo::NumberOfProcessors()));
++  plan.workers = std::clamp<size_t>(count / kMinItemsPerWorker, 1, cores);
++  plan.grain = std::clamp(count / (plan.workers * kRangesPerWorker),
++                          kMinGrain, kMaxGrain);
++  return plan;
++}
++
++// static
++void RangeScheduler::Run(size_t count,
++                         RangeCallback work,
++                         RangeCallback range_done,
++                         base::OnceClosure done) {
++  DCHECK(work);
++  DCHECK(done);
++  if (count == 0) {
++    base::SequencedTaskRunner::GetCurrentDefault()->PostTask(FROM_HERE,
++                                                             std::move(done));
++    return;
++  }
++
++  Plan plan = PlanFor(count);
++  auto run = base::MakeRefCounted<SharedRun>(count, plan.grain, plan.workers,
++                                             std::move(work),
++                                             std::move(range_done),
++                                             std::move(done));
++  for (size_t i = 0; i < plan.workers; ++i) {
++    base::ThreadPool::PostTask(
++        FROM_HERE, {base::TaskPriority::USER_VISIBLE},
++        base::BindOnce(&SharedRun::RunWorker, run));
++  }
++}
++
++}  // namespace api
++}  // namespace extensions
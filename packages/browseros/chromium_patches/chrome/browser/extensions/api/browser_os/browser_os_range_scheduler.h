@@ -0,0 +1,62 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_range_scheduler.h b/chrome/browser/extensions/api/browser_os/browser_os_range_scheduler.h
+new file mode 100644
+index 0000000000000..3f93254ec6d15
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_range_scheduler.h
+@@ -0,0 +1,56 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_RANGE_SCHEDULER_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_RANGE_SCHEDULER_H_
++
++#include <cstddef>
++
++#include "base/functional/callback.h"
++
++namespace extensions {
++namespace api {
++
++// Runs work over an index range [0, count) on the thread pool.
++//
++// The number of workers is chosen from |count| and the number of cores, so
++// small inputs run on a single worker and large ones spread out. Workers
++// claim fixed-size ranges from a shared atomic cursor until the input is
++// exhausted, so a worker that finishes early keeps taking work instead of
++// idling behind a slow one. Ranges never overlap, which lets |work| write
++// results into preallocated slots indexed by position without locking.
++class RangeScheduler {
++ public:
++  // Processes [begin, end). Runs concurrently on several workers.
++  using RangeCallback = base::RepeatingCallback<void(size_t begin, size_t end)>;
++
++  // How a run of |count| items is split up.
++  struct Plan {
++    size_t workers = 0;
++    // Items claimed from the cursor at a time
++    size_t grain = 0;
++  };
++
++  RangeScheduler() = delete;
++  RangeScheduler(const RangeScheduler&) = delete;
++  RangeScheduler& operator=(const RangeScheduler&) = delete;
++
++  // Returns the split used for |count| items.
++  static Plan PlanFor(size_t count);
++
++  // Runs |work| over [0, count). If |range_done| is set, it is posted to the
++  // calling sequence with each range once that range is finished. |done| is
++  // posted to the calling sequence exactly once, after every range and every
++  // |range_done| call. Writes made by |work| are visible to both callbacks.
++  // Must be called on a sequence.
++  static void Run(size_t count,
++                  RangeCallback work,
++                  RangeCallback range_done,
++                  base::OnceClosure done);
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_RANGE_SCHEDULER_H_
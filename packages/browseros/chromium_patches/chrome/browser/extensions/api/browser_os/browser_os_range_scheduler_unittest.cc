@@ -0,0 +1,121 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_range_scheduler_unittest.cc b/chrome/browser/extensions/api/browser_os/browser_os_range_scheduler_unittest.cc
+new file mode 100644
+index 0000000000000..f1a1a6b773917
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_range_scheduler_unittest.cc
+@@ -0,0 +1,115 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_range_scheduler.h"
++
++#include <atomic>
++#include <vector>
++
++#include "base/functional/bind.h"
++#include "base/run_loop.h"
++#include "base/system/sys_info.h"
++#include "base/task/sequenced_task_runner.h"
++#include "base/test/bind.h"
++#include "base/test/task_environment.h"
++#include "testing/gtest/include/gtest/gtest.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++class BrowserOSRangeSchedulerTest : public testing::Test {
++ protected:
++  base::test::TaskEnvironment task_environment_;
++};
++
++TEST_F(BrowserOSRangeSchedulerTest, SmallInputsRunOnOneWorker) {
++  for (size_t count : {1u, 17u, 127u}) {
++    RangeScheduler::Plan plan = RangeScheduler::PlanFor(count);
++    EXPECT_EQ(1u, plan.workers) << count;
++    EXPECT_GT(plan.grain, 0u) << count;
++  }
++}
++
++TEST_F(BrowserOSRangeSchedulerTest, LargeInputsUseEveryCore) {
++  size_t cores = static_cast<size_t>(base::SysInfo::NumberOfProcessors());
++  RangeScheduler::Plan plan = RangeScheduler::PlanFor(1'000'000);
++  EXPECT_EQ(cores, plan.workers);
++  // Each worker claims several ranges so uneven ranges even out
++  EXPECT_LT(plan.grain * plan.workers, 1'000'000u);
++}
++
++TEST_F(BrowserOSRangeSchedulerTest, PlanCoversInput) {
++  for (size_t count : {1u, 100u, 5'000u, 50'000u}) {
++    RangeScheduler::Plan plan = RangeScheduler::PlanFor(count);
++    EXPECT_GE(plan.workers, 1u) << count;
++    EXPECT_LE(plan.workers, count) << count;
++    EXPECT_GT(plan.grain, 0u) << count;
++  }
++}
++
++// Every index is processed exactly once, every range is reported back on the
++// calling sequence, and |done| comes last.
++TEST_F(BrowserOSRangeSchedulerTest, RunVisitsEveryIndexOnce) {
++  constexpr size_t kCount = 10'000;
++  std::vector<std::atomic<int>> visits(kCount);
++  size_t reported = 0;
++  bool done = false;
++  scoped_refptr<base::SequencedTaskRunner> caller =
++      base::SequencedTaskRunner::GetCurrentDefault();
++
++  base::RunLoop run_loop;
++  RangeScheduler::Run(
++      kCount, base::BindLambdaForTesting([&](size_t begin, size_t end) {
++        for (size_t i = begin; i < end; ++i) {
++          visits[i].fetch_add(1, std::memory_order_relaxed);
++        }
++      }),
++      base::BindLambdaForTesting([&](size_t begin, size_t end) {
++        EXPECT_TRUE(caller->RunsTasksInCurrentSequence());
++        EXPECT_FALSE(done);
++        EXPECT_LT(begin, end);
++        reported += end - begin;
++      }),
++      base::BindLambdaForTesting([&] {
++        EXPECT_TRUE(caller->RunsTasksInCurrentSequence());
++        done = true;
++        run_loop.Quit();
++      }));
++  run_loop.Run();
++
++  EXPECT_TRUE(done);
++  EXPECT_EQ(kCount, reported);
++  for (size_t i = 0; i < kCount; ++i) {
++    ASSERT_EQ(1, visits[i].load()) << i;
++  }
++}
++
++TEST_F(BrowserOSRangeSchedulerTest, RunWithoutRangeCallback) {
++  std::atomic<size_t> processed{0};
++  base::RunLoop run_loop;
++  RangeScheduler::Run(
++      300, base::BindLambdaForTesting([&](size_t begin, size_t end) {
++        processed.fetch_add(end - begin);
++      }),
++      RangeScheduler::RangeCallback(), run_loop.QuitClosure());
++  run_loop.Run();
++  EXPECT_EQ(300u, processed.load());
++}
++
++TEST_F(BrowserOSRangeSchedulerTest, EmptyRunStillReplies) {
++  bool worked = false;
++  base::RunLoop run_loop;
++  RangeScheduler::Run(
++      0, base::BindLambdaForTesting([&](size_t, size_t) { worked = true; }),
++      RangeScheduler::RangeCallback(), run_loop.QuitClosure());
++  run_loop.Run();
++  EXPECT_FALSE(worked);
++}
++
++}  // namespace
++
++}  // namespace api
++}  // namespace extensions
@@ -0,0 +1,163 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_snapshot_outline.cc b/chrome/browser/extensions/api/browser_os/browser_os_snapshot_outline.cc
+new file mode 100644
+index 0000000000000..7a5757847f2fd
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_snapshot_outline.cc
+@@ -0,0 +1,157 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_snapshot_outline.h"
++
++#include <algorithm>
++#include <utility>
++
++#include "base/strings/string_number_conversions.h"
++#include "ui/accessibility/ax_enum_util.h"
++#include "ui/accessibility/ax_enums.mojom.h"
++#include "ui/accessibility/ax_node.h"
++#include "ui/accessibility/ax_node_data.h"
++#include "ui/accessibility/ax_role_properties.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++// Names longer than this are cut; the full name is in the element itself.
++constexpr size_t kMaxNameBytes = 80;
++
++// Indent, "[id] ", role and quotes of a typical node line.
++constexpr size_t kLineOverhead = 32;
++
++bool IsOutlineLandmark(ax::mojom::Role role) {
++  return ui::IsLandmark(role) || ui::IsDialog(role);
++}
++
++// Appends |text| in quotes, cut to kMaxNameBytes without splitting a UTF-8
++// sequence, with line breaks and tabs turned into spaces so every entry
++// stays on one line.
++void AppendQuoted(std::string_view text, std::string& output) {
++  if (text.size() > kMaxNameBytes) {
++    size_t cut = kMaxNameBytes;
++    while (cut > 0 && (static_cast<unsigned char>(text[cut]) & 0xC0) == 0x80) {
++      --cut;
++    }
++    text = text.substr(0, cut);
++  }
++  output.push_back('"');
++  for (char c : text) {
++    output.push_back(c == '\n' || c == '\r' || c == '\t' ? ' ' : c);
++  }
++  output.push_back('"');
++}
++
++}  // namespace
++
++SnapshotOutline::SnapshotOutline() = default;
++
++SnapshotOutline::~SnapshotOutline() = default;
++
++int32_t SnapshotOutline::NearestLandmark(const ui::AXNode* node) {
++  if (!node) {
++    return kNoLandmark;
++  }
++
++  // Walk up until a landmark or an already resolved node, then resolve every
++  // node on the way so later walks through them stop immediately.
++  std::vector<int32_t> walked;
++  int32_t result = kNoLandmark;
++  for (const ui::AXNode* current = node->parent(); current;
++       current = current->parent()) {
++    auto it = nearest_.find(current->id());
++    if (it != nearest_.end()) {
++      result = it->second;
++      break;
++    }
++    walked.push_back(current->id());
++    if (IsOutlineLandmark(current->data().role)) {
++      result = current->id();
++      Landmark landmark;
++      landmark.parent = NearestLandmark(current);
++      landmark.label = ui::ToString(current->data().role);
++      const std::string& name =
++          current->data().GetStringAttribute(ax::mojom::StringAttribute::kName);
++      if (!name.empty()) {
++        landmark.label.push_back(' ');
++        AppendQuoted(name, landmark.label);
++      }
++      landmarks_[result] = std::move(landmark);
++      break;
++    }
++  }
++
++  for (int32_t id : walked) {
++    nearest_[id] = result;
++  }
++  return result;
++}
++
++void SnapshotOutline::Reserve(size_t node_count, size_t name_bytes) {
++  size_t landmark_bytes = 0;
++  for (const auto& [id, landmark] : landmarks_) {
++    landmark_bytes += landmark.label.size() + kLineOverhead;
++  }
++  output_.reserve(node_count * kLineOverhead +
++                  std::min(name_bytes, node_count * kMaxNameBytes) +
++                  landmark_bytes);
++}
++
++void SnapshotOutline::AppendNode(int32_t landmark_id,
++                                 uint32_t node_id,
++                                 ax::mojom::Role role,
++                                 std::string_view name) {
++  // Landmarks containing the node, outermost first
++  std::vector<int32_t> chain;
++  for (int32_t id = landmark_id; id != kNoLandmark;) {
++    auto it = landmarks_.find(id);
++    if (it == landmarks_.end()) {
++      break;
++    }
++    chain.push_back(id);
++    id = it->second.parent;
++  }
++  std::reverse(chain.begin(), chain.end());
++
++  // Close landmarks the node is not in, then open the ones it is.
++  size_t common = 0;
++  while (common < open_.size() && common < chain.size() &&
++         open_[common] == chain[common]) {
++    ++common;
++  }
++  open_.resize(common);
++  for (size_t depth = common; depth < chain.size(); ++depth) {
++    AppendLine(depth, landmarks_[chain[depth]].label);
++    open_.push_back(chain[depth]);
++  }
++
++  AppendLine(chain.size(), "[");
++  output_.append(base::NumberToString(node_id));
++  output_.append("] ");
++  output_.append(ui::ToString(role));
++  if (!name.empty()) {
++    output_.push_back(' ');
++    AppendQuoted(name, output_);
++  }
++}
++
++std::string SnapshotOutline::Finish() {
++  open_.clear();
++  return std::exchange(output_, std::string());
++}
++
++void SnapshotOutline::AppendLine(size_t depth, std::string_view text) {
++  if (!output_.empty()) {
++    output_.push_back('\n');
++  }
++  output_.append(depth * 2, ' ');
++  output_.append(text);
++}
++
++}  // namespace api
++}  // namespace extensions
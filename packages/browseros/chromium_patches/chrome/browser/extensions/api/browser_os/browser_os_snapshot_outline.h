@@ -0,0 +1,98 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_snapshot_outline.h b/chrome/browser/extensions/api/browser_os/browser_os_snapshot_outline.h
+new file mode 100644
+index 0000000000000..d805c3475035a
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_snapshot_outline.h
+@@ -0,0 +1,92 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_SNAPSHOT_OUTLINE_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_SNAPSHOT_OUTLINE_H_
++
++#include <cstddef>
++#include <cstdint>
++#include <string>
++#include <string_view>
++#include <unordered_map>
++#include <vector>
++
++#include "ui/accessibility/ax_enums.mojom-forward.h"
++
++namespace ui {
++class AXNode;
++}  // namespace ui
++
++namespace extensions {
++namespace api {
++
++// Builds the compact outline returned as
++// InteractiveSnapshot::hierarchical_structure.
++//
++// The outline lists the snapshot's interactive nodes in document order, each
++// indented under the landmarks (main, navigation, dialog, ...) that contain
++// it. Landmarks without interactive nodes are left out. For example:
++//
++//   navigation "Primary"
++//     [1] link "Home"
++//   main
++//     [4] textField "Search"
++//     dialog "Sign in"
++//       [7] button "Continue"
++//
++// Landmark ancestors are resolved from a ui::AXTree while it is available,
++// with one memoized upward walk shared by all nodes; the outline itself is
++// appended into a single string reserved up front.
++class SnapshotOutline {
++ public:
++  // Landmark id for nodes that are not inside any landmark.
++  static constexpr int32_t kNoLandmark = -1;
++
++  SnapshotOutline();
++  ~SnapshotOutline();
++
++  SnapshotOutline(const SnapshotOutline&) = delete;
++  SnapshotOutline& operator=(const SnapshotOutline&) = delete;
++
++  // Returns the AX id of the nearest landmark strictly above |node|, or
++  // kNoLandmark. Records that landmark and the landmarks above it.
++  int32_t NearestLandmark(const ui::AXNode* node);
++
++  // Reserves room for |node_count| node lines whose names total
++  // |name_bytes|. Call once before the first AppendNode().
++  void Reserve(size_t node_count, size_t name_bytes);
++
++  // Appends the line for one interactive node under |landmark_id|. Nodes
++  // must be appended in document order.
++  void AppendNode(int32_t landmark_id,
++                  uint32_t node_id,
++                  ax::mojom::Role role,
++                  std::string_view name);
++
++  // Returns the outline and resets the builder's output.
++  std::string Finish();
++
++ private:
++  struct Landmark {
++    int32_t parent = kNoLandmark;
++    std::string label;
++  };
++
++  // Appends one line: |depth| levels of indent, then |text|.
++  void AppendLine(size_t depth, std::string_view text);
++
++  // Landmarks seen so far, by AX id.
++  std::unordered_map<int32_t, Landmark> landmarks_;
++  // Nearest landmark of each visited node, the node itself included.
++  std::unordered_map<int32_t, int32_t> nearest_;
++
++  std::string output_;
++  // Landmarks currently open in |output_|, outermost first.
++  std::vector<int32_t> open_;
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_SNAPSHOT_OUTLINE_H_
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/extensions/api/browser_os/browser_os_snapshot_processor.cc b/chrome/browser/extensions/api/browser_os/browser_os_snapshot_processor.cc
 new file mode 100644
-index 0000000000000..885942336dcd6
+index 0000000000000..9a4a8f1c24ff1
 --- /dev/null
 +++ b/chrome/browser/extensions/api/browser_os/browser_os_snapshot_processor.cc
-@@ -0,0 +1,648 @@
+@@ -0,0 +1,781 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -15,26 +15,36 @@ index 0000000000000..885942336dcd6
 +#include <cctype>
 +#include <functional>
 +#include <future>
++#include <map>
 +#include <memory>
-+#include <queue>
++#include <optional>
 +#include <sstream>
++#include <string_view>
 +#include <unordered_set>
 +#include <utility>
 +
++#include "base/check.h"
 +#include "base/functional/bind.h"
 +#include "base/logging.h"
 +#include "base/memory/raw_ptr.h"
 +#include "base/memory/ref_counted.h"
++#include "base/memory/ref_counted_memory.h"
++#include "base/strings/strcat.h"
 +#include "base/strings/string_util.h"
 +#include "base/task/thread_pool.h"
 +#include "base/time/time.h"
 +#include "chrome/browser/extensions/api/browser_os/browser_os_api_utils.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_bounds_pass.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_node_attributes.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_node_store.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_perf.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_range_scheduler.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_snapshot_outline.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_text_sanitizer.h"
 +#include "content/public/browser/browser_thread.h"
 +#include "content/public/browser/render_widget_host_view.h"
 +#include "content/browser/renderer_host/render_widget_host_view_base.h"
 +#include "content/public/browser/web_contents.h"
-+#include "ui/accessibility/ax_clipping_behavior.h"
-+#include "ui/accessibility/ax_coordinate_system.h"
 +#include "ui/accessibility/ax_enum_util.h"
 +#include "ui/accessibility/ax_node.h"
 +#include "ui/accessibility/ax_node_data.h"
@@ -44,50 +54,10 @@ index 0000000000000..885942336dcd6
 +#include "ui/gfx/geometry/rect.h"
 +#include "ui/gfx/geometry/rect_conversions.h"
 +#include "ui/gfx/geometry/rect_f.h"
-+#include "ui/gfx/geometry/transform.h"
 +
 +namespace extensions {
 +namespace api {
 +
-+// Static method to compute bounds for a node using AXTree and convert to CSS pixels
-+// This implements the same logic as BrowserAccessibility::GetBoundsRect
-+gfx::RectF SnapshotProcessor::GetNodeBounds(
-+    ui::AXTree* tree,
-+    const ui::AXNode* node,
-+    const ui::AXCoordinateSystem coordinate_system,
-+    const ui::AXClippingBehavior clipping_behavior,
-+    float device_scale_factor,
-+    bool* out_offscreen) {
-+  if (!tree || !node) {
-+    return gfx::RectF();
-+  }
-+  
-+  // Start with empty bounds (same as GetBoundsRect does)
-+  gfx::RectF bounds;
-+  
-+  // Apply RelativeToTreeBounds to get absolute bounds
-+  const bool clip_bounds = clipping_behavior == ui::AXClippingBehavior::kClipped;
-+  bool offscreen = false;
-+  bounds = tree->RelativeToTreeBounds(node, bounds, &offscreen, clip_bounds);
-+  
-+  // Return offscreen status to caller
-+  if (out_offscreen) {
-+    *out_offscreen = offscreen;
-+  }
-+  
-+  // Convert physical pixels to CSS pixels
-+  if (device_scale_factor > 0.0f && device_scale_factor != 1.0f) {
-+    bounds.set_x(bounds.x() / device_scale_factor);
-+    bounds.set_y(bounds.y() / device_scale_factor);
-+    bounds.set_width(bounds.width() / device_scale_factor);
-+    bounds.set_height(bounds.height() / device_scale_factor);
-+  }
-+  
-+  // Return bounds in CSS pixels
-+  return bounds;
-+}
-+
-+
 +// ProcessedNode implementation
 +SnapshotProcessor::ProcessedNode::ProcessedNode()
 +    : node_data(nullptr), node_id(0) {}
@@ -103,23 +73,6 @@ index 0000000000000..885942336dcd6
 +
 +namespace {
 +
-+// Helper to sanitize strings to ensure valid UTF-8 by keeping only printable ASCII
-+std::string SanitizeStringForOutput(const std::string& input) {
-+  std::string output;
-+  output.reserve(input.size());
-+  
-+  for (char c : input) {
-+    // Only include printable ASCII and whitespace
-+    if ((c >= 32 && c <= 126) || c == '\t' || c == '\n') {
-+      output.push_back(c);
-+    } else {
-+      output.push_back(' ');  // Replace non-printable with space
-+    }
-+  }
-+  
-+  return output;
-+}
-+
 +// Helper to determine if a node should be skipped for the interactive snapshot
 +bool ShouldSkipNode(const ui::AXNodeData& node_data) {
 +  // Skip invisible or ignored nodes
@@ -142,18 +95,34 @@ index 0000000000000..885942336dcd6
 +struct SnapshotProcessor::ProcessingContext 
 +    : public base::RefCountedThreadSafe<ProcessingContext> {
 +  browser_os::InteractiveSnapshot snapshot;
-+  std::unordered_map<int32_t, ui::AXNodeData> node_map;
-+  std::unordered_map<int32_t, int32_t> parent_map;  // child_id -> parent_id  
-+  std::unordered_map<int32_t, std::vector<int32_t>> children_map;  // parent_id -> child_ids
-+  std::unique_ptr<ui::AXTree> ax_tree;  // AXTree for computing accurate bounds
++  // Immutable node store shared by reference with every worker. Also keeps
++  // ProcessedNode::node_data valid until the slots are merged.
++  scoped_refptr<AXNodeStore> node_store;
 +  int tab_id;
 +  ui::AXTreeID tree_id;  // Tree ID for change detection
 +  float device_scale_factor = 1.0f;  // For converting physical to CSS pixels
 +  gfx::Size viewport_size;  // For visibility checks
++  gfx::RectF region;  // Nodes outside are culled; empty keeps everything
 +  base::TimeTicks start_time;
 +  size_t total_nodes;
-+  size_t processed_batches;
-+  size_t total_batches;
++  // Worker input, read-only while workers run: store indices of the nodes to
++  // process, their clipped CSS pixel bounds, and the container summaries.
++  std::vector<size_t> node_indices;
++  std::vector<AXBoundsPass::NodeBounds> node_bounds;
++  scoped_refptr<SharedContextSummaries> context_summaries;
++  // Worker output, one slot per entry of |node_indices|. Workers write
++  // disjoint ranges; a slot stays empty if its node was dropped. Slot order
++  // is nodeId order, so no sort is needed when merging.
++  std::vector<std::optional<SnapshotProcessor::ProcessedNode>> slots;
++  // Nearest landmark of each entry of |node_indices|, resolved while the
++  // AXTree is alive, and the outline built from them once slots are merged.
++  std::vector<int32_t> landmark_ids;
++  SnapshotOutline outline;
++  // Streaming only: finished ranges not yet emitted (begin -> end), and the
++  // position the stream has reached.
++  std::map<size_t, size_t> finished_ranges;
++  size_t next_to_emit = 0;
++  SnapshotProcessor::ChunkCallback chunk_callback;
 +  base::OnceCallback<void(SnapshotProcessingResult)> callback;
 +  
 + private:
@@ -161,63 +130,133 @@ index 0000000000000..885942336dcd6
 +  ~ProcessingContext() = default;
 +};
 +
-+// Helper to collect text from a node's subtree
-+std::string CollectTextFromNode(
-+    int32_t node_id,
-+    const std::unordered_map<int32_t, ui::AXNodeData>& node_map,
-+    int max_chars = 200) {
-+  
-+  auto node_it = node_map.find(node_id);
-+  if (node_it == node_map.end()) {
-+    return "";
++// Appends the sanitized name of |node| to |buffer|, space separated
++void AppendNodeText(const ui::AXNodeData& node, std::string& buffer) {
++  if (!node.HasStringAttribute(ax::mojom::StringAttribute::kName)) {
++    return;
 +  }
++  std::string_view text = base::TrimWhitespaceASCII(
++      node.GetStringAttribute(ax::mojom::StringAttribute::kName),
++      base::TRIM_ALL);
++  if (text.empty()) {
++    return;
++  }
++  size_t old_size = buffer.size();
++  if (!buffer.empty()) {
++    buffer += ' ';
++  }
++  size_t text_start = buffer.size();
++  AppendSanitizedText(text, buffer);
++  // Nothing survived sanitizing; drop the separator too
++  if (buffer.size() == text_start) {
++    buffer.resize(old_size);
++  }
++}
++
++// static
++SnapshotProcessor::ContextSummaries SnapshotProcessor::BuildContextSummaries(
++    const std::unordered_set<int32_t>& container_ids,
++    NodeLookup lookup,
++    size_t max_chars) {
++  ContextSummaries summaries;
++  summaries.reserve(container_ids.size());
++  
++  // A container currently on the walk path and where its text starts in
++  // the buffer.
++  struct OpenContainer {
++    int32_t id;
++    size_t start;
++  };
++  
++  std::string buffer;
++  std::vector<OpenContainer> open;
++  // Node ids to visit; negative entries close the container with id ~entry.
++  std::vector<int32_t> stack;
++  
++  auto close = [&](const OpenContainer& container) {
++    std::string_view text = std::string_view(buffer).substr(container.start);
++    if (!text.empty() && text.front() == ' ') {
++      text.remove_prefix(1);
++    }
++    if (text.empty()) {
++      summaries.emplace(container.id, nullptr);
++      return;
++    }
++    std::string summary;
++    if (text.length() > max_chars) {
++      // Cut at a code point boundary; the text may hold multi-byte UTF-8
++      size_t cut = max_chars - 3;
++      while (cut > 0 &&
++             (static_cast<unsigned char>(text[cut]) & 0xC0) == 0x80) {
++        --cut;
++      }
++      summary = base::StrCat({text.substr(0, cut), "..."});
++    } else {
++      summary = std::string(text);
++    }
++    summaries.emplace(container.id,
++                      base::MakeRefCounted<base::RefCountedString>(
++                          std::move(summary)));
++  };
 +  
-+  std::vector<std::string> text_parts;
-+  
-+  // BFS to collect text from this node and its children
-+  std::queue<int32_t> queue;
-+  queue.push(node_id);
-+  int chars_collected = 0;
-+  
-+  while (!queue.empty() && chars_collected < max_chars) {
-+    int32_t current_id = queue.front();
-+    queue.pop();
-+    
-+    auto current_it = node_map.find(current_id);
-+    if (current_it == node_map.end()) continue;
-+    
-+    const ui::AXNodeData& current = current_it->second;
++  for (int32_t root_id : container_ids) {
++    if (summaries.contains(root_id)) {
++      continue;
++    }
 +    
-+    // Collect text from this node
-+    if (current.HasStringAttribute(ax::mojom::StringAttribute::kName)) {
-+      std::string text = current.GetStringAttribute(ax::mojom::StringAttribute::kName);
-+      text = std::string(base::TrimWhitespaceASCII(text, base::TRIM_ALL));
-+      if (!text.empty()) {
-+        std::string clean_text = SanitizeStringForOutput(text);
-+        if (!clean_text.empty()) {
-+          text_parts.push_back(clean_text);
-+          chars_collected += clean_text.length();
++    // One pre-order walk covers the root and every needed container nested
++    // under it. The walk ends as soon as the innermost open container has
++    // more text than it can use, since all outer ones then have too.
++    buffer.clear();
++    stack.assign(1, root_id);
++    while (!stack.empty()) {
++      int32_t entry = stack.back();
++      stack.pop_back();
++      if (entry < 0) {
++        close(open.back());
++        open.pop_back();
++        continue;
++      }
++      
++      const ui::AXNodeData* node = lookup(entry);
++      if (!node) {
++        if (entry == root_id) {
++          summaries.emplace(root_id, nullptr);
 +        }
++        continue;
++      }
++      
++      if (container_ids.contains(entry) && !summaries.contains(entry)) {
++        open.push_back({entry, buffer.size()});
++        stack.push_back(~entry);
++      }
++      
++      AppendNodeText(*node, buffer);
++      
++      // +1 for the separator a container's text may start with
++      if (!open.empty() && buffer.size() - open.back().start > max_chars + 1) {
++        while (!open.empty()) {
++          close(open.back());
++          open.pop_back();
++        }
++        stack.clear();
++        break;
++      }
++      
++      for (auto it = node->child_ids.rbegin(); it != node->child_ids.rend();
++           ++it) {
++        stack.push_back(*it);
 +      }
-+    }
-+    
-+    // Add children to queue
-+    for (int32_t child_id : current.child_ids) {
-+      queue.push(child_id);
 +    }
 +  }
 +  
-+  std::string result = base::JoinString(text_parts, " ");
-+  if (result.length() > static_cast<size_t>(max_chars)) {
-+    result = result.substr(0, max_chars - 3) + "...";
-+  }
-+  return result;
++  return summaries;
 +}
 +
 +// Helper to build path using offset_container_id and return depth
 +std::pair<std::string, int> BuildPathAndDepth(
 +    int32_t node_id,
-+    const std::unordered_map<int32_t, ui::AXNodeData>& node_map) {
++    SnapshotProcessor::NodeLookup lookup) {
 +  
 +  std::vector<std::string> path_parts;
 +  int32_t current_id = node_id;
@@ -225,10 +264,10 @@ index 0000000000000..885942336dcd6
 +  const int max_depth = 10;
 +  
 +  while (current_id >= 0 && depth < max_depth) {
-+    auto node_it = node_map.find(current_id);
-+    if (node_it == node_map.end()) break;
++    const ui::AXNodeData* node_ptr = lookup(current_id);
++    if (!node_ptr) break;
 +    
-+    const ui::AXNodeData& node = node_it->second;
++    const ui::AXNodeData& node = *node_ptr;
 +    
 +    // Just append the role
 +    path_parts.push_back(ui::ToString(node.role));
@@ -246,269 +285,318 @@ index 0000000000000..885942336dcd6
 +// Helper to populate all attributes for a node
 +void PopulateNodeAttributes(
 +    const ui::AXNodeData& node_data,
-+    std::unordered_map<std::string, std::string>& attributes) {
++    NodeAttributes& attributes) {
 +  
-+  // Add role as string
-+  attributes["role"] = ui::ToString(node_data.role);
++  // Add role
++  attributes.role = node_data.role;
 +  
 +  // Add value attribute for inputs
 +  if (node_data.HasStringAttribute(ax::mojom::StringAttribute::kValue)) {
-+    std::string value = node_data.GetStringAttribute(ax::mojom::StringAttribute::kValue);
-+    attributes["value"] = SanitizeStringForOutput(value);
++    attributes.Set(NodeAttributes::Key::kValue,
++                   SanitizeText(node_data.GetStringAttribute(
++                       ax::mojom::StringAttribute::kValue)));
 +  }
 +  
 +  // Add HTML tag if available
 +  if (node_data.HasStringAttribute(ax::mojom::StringAttribute::kHtmlTag)) {
-+    attributes["html-tag"] = node_data.GetStringAttribute(ax::mojom::StringAttribute::kHtmlTag);
++    attributes.SetHtmlTag(
++        node_data.GetStringAttribute(ax::mojom::StringAttribute::kHtmlTag));
 +  }
 +  
 +  // Add role description
 +  if (node_data.HasStringAttribute(ax::mojom::StringAttribute::kRoleDescription)) {
-+    std::string role_desc = node_data.GetStringAttribute(ax::mojom::StringAttribute::kRoleDescription);
-+    attributes["role-description"] = SanitizeStringForOutput(role_desc);
++    attributes.Set(NodeAttributes::Key::kRoleDescription,
++                   SanitizeText(node_data.GetStringAttribute(
++                       ax::mojom::StringAttribute::kRoleDescription)));
 +  }
 +  
 +  // Add input type
 +  if (node_data.HasStringAttribute(ax::mojom::StringAttribute::kInputType)) {
-+    std::string input_type = node_data.GetStringAttribute(ax::mojom::StringAttribute::kInputType);
-+    attributes["input-type"] = SanitizeStringForOutput(input_type);
++    attributes.Set(NodeAttributes::Key::kInputType,
++                   SanitizeText(node_data.GetStringAttribute(
++                       ax::mojom::StringAttribute::kInputType)));
 +  }
 +  
 +  // Add tooltip
 +  if (node_data.HasStringAttribute(ax::mojom::StringAttribute::kTooltip)) {
-+    std::string tooltip = node_data.GetStringAttribute(ax::mojom::StringAttribute::kTooltip);
-+    attributes["tooltip"] = SanitizeStringForOutput(tooltip);
++    attributes.Set(NodeAttributes::Key::kTooltip,
++                   SanitizeText(node_data.GetStringAttribute(
++                       ax::mojom::StringAttribute::kTooltip)));
 +  }
 +  
 +  // Add placeholder for input fields
 +  if (node_data.HasStringAttribute(ax::mojom::StringAttribute::kPlaceholder)) {
-+    std::string placeholder = node_data.GetStringAttribute(ax::mojom::StringAttribute::kPlaceholder);
-+    attributes["placeholder"] = SanitizeStringForOutput(placeholder);
++    attributes.Set(NodeAttributes::Key::kPlaceholder,
++                   SanitizeText(node_data.GetStringAttribute(
++                       ax::mojom::StringAttribute::kPlaceholder)));
 +  }
 +  
 +  // Add description for more context
 +  if (node_data.HasStringAttribute(ax::mojom::StringAttribute::kDescription)) {
-+    std::string description = node_data.GetStringAttribute(ax::mojom::StringAttribute::kDescription);
-+    attributes["description"] = SanitizeStringForOutput(description);
++    attributes.Set(NodeAttributes::Key::kDescription,
++                   SanitizeText(node_data.GetStringAttribute(
++                       ax::mojom::StringAttribute::kDescription)));
 +  }
 +  
 +  // Add URL for links
 +  // if (node_data.HasStringAttribute(ax::mojom::StringAttribute::kUrl)) {
 +  //   std::string url = node_data.GetStringAttribute(ax::mojom::StringAttribute::kUrl);
-+  //   attributes["url"] = SanitizeStringForOutput(url);
++  //   attributes["url"] = SanitizeText(url);
 +  // }
 +  
 +  // Add checked state description
 +  if (node_data.HasStringAttribute(ax::mojom::StringAttribute::kCheckedStateDescription)) {
-+    std::string checked_desc = node_data.GetStringAttribute(ax::mojom::StringAttribute::kCheckedStateDescription);
-+    attributes["checked-state"] = SanitizeStringForOutput(checked_desc);
++    attributes.Set(NodeAttributes::Key::kCheckedState,
++                   SanitizeText(node_data.GetStringAttribute(
++                       ax::mojom::StringAttribute::kCheckedStateDescription)));
 +  }
 +  
 +  // Add autocomplete hint
 +  if (node_data.HasStringAttribute(ax::mojom::StringAttribute::kAutoComplete)) {
-+    std::string autocomplete = node_data.GetStringAttribute(ax::mojom::StringAttribute::kAutoComplete);
-+    attributes["autocomplete"] = SanitizeStringForOutput(autocomplete);
++    attributes.Set(NodeAttributes::Key::kAutocomplete,
++                   SanitizeText(node_data.GetStringAttribute(
++                       ax::mojom::StringAttribute::kAutoComplete)));
 +  }
 +  
 +  // Add HTML ID for form associations
 +  if (node_data.HasStringAttribute(ax::mojom::StringAttribute::kHtmlId)) {
-+    std::string html_id = node_data.GetStringAttribute(ax::mojom::StringAttribute::kHtmlId);
-+    attributes["id"] = SanitizeStringForOutput(html_id);
++    attributes.Set(NodeAttributes::Key::kId,
++                   SanitizeText(node_data.GetStringAttribute(
++                       ax::mojom::StringAttribute::kHtmlId)));
 +  }
 +  
 +  // Add HTML class names
 +  if (node_data.HasStringAttribute(ax::mojom::StringAttribute::kClassName)) {
-+    std::string class_name = node_data.GetStringAttribute(ax::mojom::StringAttribute::kClassName);
-+    attributes["class"] = SanitizeStringForOutput(class_name);
++    attributes.Set(NodeAttributes::Key::kClass,
++                   SanitizeText(node_data.GetStringAttribute(
++                       ax::mojom::StringAttribute::kClassName)));
 +  }
 +}
 +
-+// Process a batch of nodes
-+std::vector<SnapshotProcessor::ProcessedNode> SnapshotProcessor::ProcessNodeBatch(
-+    const std::vector<ui::AXNodeData>& nodes_to_process,
-+    const std::unordered_map<int32_t, ui::AXNodeData>& node_map,
-+    ui::AXTree* ax_tree,
-+    uint32_t start_node_id,
-+    float device_scale_factor) {
-+  std::vector<ProcessedNode> results;
-+  results.reserve(nodes_to_process.size());
-+  
-+  uint32_t current_node_id = start_node_id;
-+  
-+  for (const auto& node_data : nodes_to_process) {
-+    // Skip invisible, ignored, or non-interactive elements
-+    if (ShouldSkipNode(node_data)) {
-+      continue;
-+    }
-+    
-+    // Double-check invisibility (already done in ShouldSkipNode, but being explicit)
-+    if (node_data.IsInvisibleOrIgnored()) {
-+      continue;
++// Process a single node into |data|
++bool SnapshotProcessor::ProcessNode(const ui::AXNodeData& node_data,
++                                    NodeLookup lookup,
++                                    const AXBoundsPass::NodeBounds& bounds,
++                                    const ContextSummaries& context_summaries,
++                                    ProcessedNode& data) {
++  // Skip invisible, ignored, or non-interactive elements
++  if (ShouldSkipNode(node_data)) {
++    return false;
++  }
++  
++  // Get the interactive node type
++  browser_os::InteractiveNodeType node_type = GetInteractiveNodeType(node_data);
++  
++  data.node_data = &node_data;
++  data.node_type = node_type;
++  
++  // Get accessible name
++  if (node_data.HasStringAttribute(ax::mojom::StringAttribute::kName)) {
++    data.name = SanitizeText(
++        node_data.GetStringAttribute(ax::mojom::StringAttribute::kName));
++  }
++
++  // Bounds come precomputed from the bounds pass, already in CSS pixels
++  data.absolute_bounds = bounds.bounds;
++  bool is_offscreen = bounds.offscreen;
++  VLOG(3) << "[browseros] Node " << node_data.id 
++          << " CSS bounds: " << data.absolute_bounds.ToString()
++          << " offscreen: " << is_offscreen;
++  
++  // Populate all attributes using helper function
++  PopulateNodeAttributes(node_data, data.attributes);
++  
++  // Add context from the offset container's memoized summary
++  int32_t parent_id = node_data.relative_bounds.offset_container_id;
++  if (parent_id >= 0) {
++    auto context_it = context_summaries.find(parent_id);
++    if (context_it != context_summaries.end()) {
++      data.attributes.context = context_it->second;
 +    }
-+    
-+    // Get the interactive node type
-+    browser_os::InteractiveNodeType node_type = GetInteractiveNodeType(node_data);
-+    
++  }
++  
++  // Add path and depth using offset_container_id chain
++  auto [path, depth] = BuildPathAndDepth(node_data.id, lookup);
++  if (!path.empty()) {
++    data.attributes.Set(NodeAttributes::Key::kPath, std::move(path));
++  }
++  data.attributes.depth = depth;
++  
++  // Set viewport status based on offscreen flag
++  // Note: offscreen=false means the node IS in viewport (at least partially visible)
++  // offscreen=true means the node is NOT in viewport (completely hidden)
++  data.attributes.in_viewport = !is_offscreen;
++  
++  return true;
++}
++
++// Process one range of nodes into the context's output slots
++// static
++void SnapshotProcessor::ProcessRange(ProcessingContext* context,
++                                     size_t begin,
++                                     size_t end) {
++  const AXNodeStore* node_store = context->node_store.get();
++  auto lookup = [node_store](int32_t id) { return node_store->Find(id); };
++  
++  for (size_t i = begin; i < end; ++i) {
 +    ProcessedNode data;
-+    data.node_data = &node_data;
-+    data.node_id = current_node_id++;
-+    data.node_type = node_type;
-+    
-+    // Get accessible name
-+    if (node_data.HasStringAttribute(ax::mojom::StringAttribute::kName)) {
-+      std::string name = node_data.GetStringAttribute(ax::mojom::StringAttribute::kName);
-+      data.name = SanitizeStringForOutput(name);
++    if (!ProcessNode(node_store->at(context->node_indices[i]), lookup,
++                     context->node_bounds[i],
++                     context->context_summaries->data, data)) {
++      continue;
 +    }
++    data.node_id = i + 1;  // Node IDs start at 1
++    context->slots[i] = std::move(data);
++  }
++}
 +
-+    // Compute bounds using AXTree
-+    bool is_offscreen = false;
-+    if (ax_tree) {
-+      ui::AXNode* ax_node = ax_tree->GetFromId(node_data.id);
-+      if (ax_node) {
-+        // GetNodeBounds now returns CSS pixels directly
-+        data.absolute_bounds = GetNodeBounds(
-+            ax_tree, 
-+            ax_node,
-+            ui::AXCoordinateSystem::kFrame,
-+            // Use clipped bounds so the center lies within the visible area of
-+            // scrolled/clip containers. This matches how clicks should target
-+            // on-screen rects.
-+            ui::AXClippingBehavior::kClipped,
-+            device_scale_factor,  // Pass DSF for CSS pixel conversion
-+            &is_offscreen);
-+        
-+        VLOG(3) << "[browseros] Node " << node_data.id 
-+                << " CSS bounds: " << data.absolute_bounds.ToString()
-+                << " offscreen: " << is_offscreen;
-+      } else {
-+        // Node not found in AXTree, skip bounds computation
-+        VLOG(3) << "[browseros] Node " << node_data.id 
-+                << " not found in AXTree, skipping bounds";
-+      }
-+    } else {
-+      // No AXTree available
-+      LOG(WARNING) << "[browseros] No AXTree available for bounds computation";
-+    }
-+    
-+    // Populate all attributes using helper function
-+    PopulateNodeAttributes(node_data, data.attributes);
-+    
-+    // Add context from parent node
-+    int32_t parent_id = node_data.relative_bounds.offset_container_id;
-+    if (parent_id >= 0) {
-+      std::string context = CollectTextFromNode(parent_id, node_map, 200);
-+      if (!context.empty()) {
-+        data.attributes["context"] = context;
++// Record a processed node in the tab's node mappings and the snapshot
++void SnapshotProcessor::AppendProcessedNode(
++    const ProcessedNode& node_data,
++    int tab_id,
++    const ui::AXTreeID& tree_id,
++    browser_os::InteractiveSnapshot& snapshot) {
++  // Store mapping from our nodeId to AX node ID, bounds, and attributes
++  NodeInfo info;
++  info.ax_node_id = node_data.node_data->id;
++  info.ax_tree_id = tree_id;  // Store tree ID for change detection
++  info.bounds = node_data.absolute_bounds;
++  info.attributes = node_data.attributes;  // Store all computed attributes
++  info.node_type = node_data.node_type;  // Store node type for efficient filtering
++  info.in_viewport = node_data.attributes.in_viewport;
++  GetNodeIdMappings()[tab_id][node_data.node_id] = info;
++  
++  // Log the mapping for debugging
++  VLOG(2) << "Node ID Mapping: Interactive nodeId=" << node_data.node_id 
++          << " -> AX node ID=" << info.ax_node_id 
++          << " (name: " << node_data.name << ")";
++  
++  // Create interactive node
++  browser_os::InteractiveNode interactive_node;
++  interactive_node.node_id = node_data.node_id;
++  interactive_node.type = node_data.node_type;
++  interactive_node.name = node_data.name;
++  
++  // Set the bounding rectangle
++  browser_os::Rect rect;
++  rect.x = node_data.absolute_bounds.x();
++  rect.y = node_data.absolute_bounds.y();
++  rect.width = node_data.absolute_bounds.width();
++  rect.height = node_data.absolute_bounds.height();
++  interactive_node.rect = std::move(rect);
++  
++  // Convert the typed attributes to a dictionary only here, at the API
++  // boundary
++  browser_os::InteractiveNode::Attributes attributes;
++  attributes.additional_properties = node_data.attributes.ToDict();
++  interactive_node.attributes = std::move(attributes);
++  
++  snapshot.elements.push_back(std::move(interactive_node));
++}
++
++// static
++void SnapshotProcessor::OnRangeProcessed(
++    scoped_refptr<ProcessingContext> context,
++    size_t begin,
++    size_t end) {
++  // Emit ranges in position order so the stream stays in nodeId order. Hold
++  // early finishers until the gap before them is filled.
++  context->finished_ranges.emplace(begin, end);
++  for (auto it = context->finished_ranges.begin();
++       it != context->finished_ranges.end() &&
++       it->first == context->next_to_emit;
++       it = context->finished_ranges.erase(it)) {
++    browser_os::InteractiveSnapshot chunk;
++    chunk.elements.reserve(it->second - it->first);
++    for (size_t i = it->first; i < it->second; ++i) {
++      if (context->slots[i]) {
++        AppendProcessedNode(*context->slots[i], context->tab_id,
++                            context->tree_id, chunk);
 +      }
 +    }
-+    
-+    // Add path and depth using offset_container_id chain
-+    auto [path, depth] = BuildPathAndDepth(node_data.id, node_map);
-+    if (!path.empty()) {
-+      data.attributes["path"] = path;
++    context->next_to_emit = it->second;
++    if (!chunk.elements.empty()) {
++      context->chunk_callback.Run(std::move(chunk.elements));
 +    }
-+    data.attributes["depth"] = std::to_string(depth);
-+    
-+    // Set viewport status based on offscreen flag
-+    // Note: offscreen=false means the node IS in viewport (at least partially visible)
-+    // offscreen=true means the node is NOT in viewport (completely hidden)
-+    data.attributes["in_viewport"] = is_offscreen ? "false" : "true";
-+    
-+    results.push_back(std::move(data));
 +  }
-+  
-+  return results;
 +}
 +
-+// Helper to handle batch processing results
-+void SnapshotProcessor::OnBatchProcessed(
-+    scoped_refptr<ProcessingContext> context,
-+    std::vector<ProcessedNode> batch_results) {
-+  // Process batch results
-+  for (const auto& node_data : batch_results) {
-+    // Store mapping from our nodeId to AX node ID, bounds, and attributes
-+    NodeInfo info;
-+    info.ax_node_id = node_data.node_data->id;
-+    info.ax_tree_id = context->tree_id;  // Store tree ID for change detection
-+    info.bounds = node_data.absolute_bounds;
-+    info.attributes = node_data.attributes;  // Store all computed attributes
-+    info.node_type = node_data.node_type;  // Store node type for efficient filtering
-+    // Extract in_viewport from attributes (stored as "true"/"false" string)
-+    auto viewport_it = node_data.attributes.find("in_viewport");
-+    info.in_viewport = (viewport_it != node_data.attributes.end() && viewport_it->second == "true");
-+    GetNodeIdMappings()[context->tab_id][node_data.node_id] = info;
-+    
-+    // Log the mapping for debugging
-+    VLOG(2) << "Node ID Mapping: Interactive nodeId=" << node_data.node_id 
-+            << " -> AX node ID=" << info.ax_node_id 
-+            << " (name: " << node_data.name << ")";
-+    
-+    // Create interactive node
-+    browser_os::InteractiveNode interactive_node;
-+    interactive_node.node_id = node_data.node_id;
-+    interactive_node.type = node_data.node_type;
-+    interactive_node.name = node_data.name;
-+    
-+    // Set the bounding rectangle
-+    browser_os::Rect rect;
-+    rect.x = node_data.absolute_bounds.x();
-+    rect.y = node_data.absolute_bounds.y();
-+    rect.width = node_data.absolute_bounds.width();
-+    rect.height = node_data.absolute_bounds.height();
-+    interactive_node.rect = std::move(rect);
-+    
-+    // Create attributes dictionary by iterating over all key-value pairs
-+    if (!node_data.attributes.empty()) {
-+      browser_os::InteractiveNode::Attributes attributes;
-+      
-+      // Iterate over all attributes and add them to the dictionary
-+      for (const auto& [key, value] : node_data.attributes) {
-+        attributes.additional_properties.Set(key, value);
++// static
++void SnapshotProcessor::OnAllRangesProcessed(
++    scoped_refptr<ProcessingContext> context) {
++  if (!context->chunk_callback) {
++    // Slots are already in nodeId order
++    context->snapshot.elements.reserve(context->slots.size());
++    for (const auto& slot : context->slots) {
++      if (slot) {
++        AppendProcessedNode(*slot, context->tab_id, context->tree_id,
++                            context->snapshot);
 +      }
-+      
-+      interactive_node.attributes = std::move(attributes);
 +    }
-+    
-+    context->snapshot.elements.push_back(std::move(interactive_node));
 +  }
-+  
-+  context->processed_batches++;
-+  
-+  // Check if all batches are complete
-+  if (context->processed_batches == context->total_batches) {
-+    // Sort elements by node_id to maintain consistent ordering
-+    std::sort(context->snapshot.elements.begin(), 
-+              context->snapshot.elements.end(),
-+              [](const browser_os::InteractiveNode& a, 
-+                 const browser_os::InteractiveNode& b) {
-+                return a.node_id < b.node_id;
-+              });
++  DCHECK(context->finished_ranges.empty());
 +
-+    // Leave hierarchical_structure empty for now as requested
-+    context->snapshot.hierarchical_structure = "";
++  // Outline the merged nodes under their landmarks
++  size_t node_count = 0;
++  size_t name_bytes = 0;
++  for (const auto& slot : context->slots) {
++    if (slot) {
++      ++node_count;
++      name_bytes += slot->name.size();
++    }
++  }
++  context->outline.Reserve(node_count, name_bytes);
++  for (size_t i = 0; i < context->slots.size(); ++i) {
++    if (const auto& slot = context->slots[i]) {
++      context->outline.AppendNode(context->landmark_ids[i], slot->node_id,
++                                  slot->attributes.role, slot->name);
++    }
++  }
++  context->snapshot.hierarchical_structure = context->outline.Finish();
 +
-+    base::TimeDelta processing_time = base::TimeTicks::Now() - context->start_time;
-+    LOG(INFO) << "[PERF] Interactive snapshot processed in " 
-+              << processing_time.InMilliseconds() << " ms"
-+              << " (nodes: " << context->snapshot.elements.size() << ")";
++  base::TimeDelta processing_time = base::TimeTicks::Now() - context->start_time;
++  LogPerfRecord("interactive_snapshot", context->node_store->size(),
++                node_count, processing_time);
 +
-+    // Set processing time in the snapshot
-+    context->snapshot.processing_time_ms = processing_time.InMilliseconds();
++  // Set processing time in the snapshot
++  context->snapshot.processing_time_ms = processing_time.InMilliseconds();
 +
-+    SnapshotProcessingResult result;
-+    result.snapshot = std::move(context->snapshot);
-+    result.nodes_processed = context->total_nodes;
-+    result.processing_time_ms = processing_time.InMilliseconds();
-+    
-+    // Run callback (context will be deleted when last ref is released)
-+    std::move(context->callback).Run(std::move(result));
++  SnapshotProcessingResult result;
++  result.snapshot = std::move(context->snapshot);
++  result.nodes_processed = context->total_nodes;
++  result.processing_time_ms = processing_time.InMilliseconds();
++  
++  // Run callback (context will be deleted when last ref is released)
++  std::move(context->callback).Run(std::move(result));
++}
++
++// static
++gfx::RectF SnapshotProcessor::GetScopeRegion(const gfx::Size& viewport_size,
++                                             std::optional<int> screens_ahead) {
++  if (!screens_ahead || viewport_size.IsEmpty()) {
++    return gfx::RectF();
 +  }
++  int screens = 1 + std::max(0, *screens_ahead);
++  return gfx::RectF(0, 0, viewport_size.width(),
++                    static_cast<float>(viewport_size.height()) * screens);
++}
++
++// static
++bool SnapshotProcessor::IntersectsRegion(const gfx::RectF& bounds,
++                                         const gfx::RectF& region) {
++  if (region.IsEmpty()) {
++    return true;
++  }
++  // Zero-sized nodes (e.g. focusable wrappers) still count if they sit
++  // inside the region.
++  return bounds.IsEmpty() ? region.InclusiveContains(bounds.origin())
++                          : region.Intersects(bounds);
 +}
 +
-+// Main processing function
 +// Helper function to extract viewport info from WebContents
 +// Returns viewport size and device scale factor
-+static std::pair<gfx::Size, float> ExtractViewportInfo(
++// static
++std::pair<gfx::Size, float> SnapshotProcessor::ExtractViewportInfo(
 +    content::WebContents* web_contents) {
 +  gfx::Size viewport_size;
 +  float device_scale_factor = 1.0f;
@@ -531,30 +619,23 @@ index 0000000000000..885942336dcd6
 +  return {viewport_size, device_scale_factor};
 +}
 +
++// Main processing function
 +void SnapshotProcessor::ProcessAccessibilityTree(
 +    const ui::AXTreeUpdate& tree_update,
 +    int tab_id,
 +    uint32_t snapshot_id,
 +    content::WebContents* web_contents,
++    std::optional<int> screens_ahead,
++    ChunkCallback chunk_callback,
 +    base::OnceCallback<void(SnapshotProcessingResult)> callback) {
 +  base::TimeTicks start_time = base::TimeTicks::Now();
 +  
 +  // Extract viewport info from WebContents on UI thread
 +  auto [viewport_size, device_scale_factor] = ExtractViewportInfo(web_contents);
 +  
-+  // Build node ID map, parent map and children map for efficient lookup
-+  std::unordered_map<int32_t, ui::AXNodeData> node_map;
-+  std::unordered_map<int32_t, int32_t> parent_map;
-+  std::unordered_map<int32_t, std::vector<int32_t>> children_map;
-+  
-+  for (const auto& node : tree_update.nodes) {
-+    node_map[node.id] = node;
-+    // Build parent and children relationships
-+    for (int32_t child_id : node.child_ids) {
-+      parent_map[child_id] = node.id;
-+      children_map[node.id].push_back(child_id);
-+    }
-+  }
++  // Build the shared node store once. Batch tasks hold a reference to it
++  // instead of receiving their own copy of the node map.
++  scoped_refptr<AXNodeStore> node_store = AXNodeStore::Create(tree_update);
 +  
 +  // Clear previous mappings for this tab
 +  GetNodeIdMappings()[tab_id].clear();
@@ -579,12 +660,10 @@ index 0000000000000..885942336dcd6
 +  context->snapshot.snapshot_id = snapshot_id;
 +  context->snapshot.timestamp = base::Time::Now().InMillisecondsFSinceUnixEpoch();
 +  context->tab_id = tab_id;
-+  context->node_map = std::move(node_map);
-+  context->parent_map = std::move(parent_map); 
-+  context->children_map = std::move(children_map);
-+  context->ax_tree = std::move(ax_tree);  // Store AXTree for bounds computation
++  context->node_store = std::move(node_store);
 +  context->device_scale_factor = device_scale_factor;  // For CSS pixel conversion
 +  context->viewport_size = viewport_size;  // For visibility checks
++  context->region = GetScopeRegion(viewport_size, screens_ahead);
 +  context->start_time = start_time;
 +  
 +  // Store the tree ID for change detection
@@ -592,23 +671,62 @@ index 0000000000000..885942336dcd6
 +    context->tree_id = tree_update.tree_data.tree_id;
 +  }
 +  
-+  // Viewport size is passed in but not currently used for viewport bounds calculation
-+  // TODO: Implement proper viewport detection if needed
++  context->chunk_callback = std::move(chunk_callback);
 +  context->callback = std::move(callback);
-+  context->processed_batches = 0;
 +  
-+  // Collect all nodes to process and filter
-+  std::vector<ui::AXNodeData> nodes_to_process;
-+  for (const auto& node : tree_update.nodes) {
++  // Collect the store indices of all nodes to process
++  std::vector<size_t> nodes_to_process;
++  std::vector<const ui::AXNode*> ax_nodes;
++  for (size_t i = 0; i < context->node_store->size(); ++i) {
 +    // Skip invisible, ignored, or non-interactive nodes
-+    if (ShouldSkipNode(node)) {
++    const ui::AXNodeData& node_data = context->node_store->at(i);
++    if (ShouldSkipNode(node_data)) {
 +      continue;
 +    }
-+    nodes_to_process.push_back(node);
++    nodes_to_process.push_back(i);
++    ax_nodes.push_back(ax_tree->GetFromId(node_data.id));
++  }
++  
++  // Compute all bounds in one sweep. Container offsets and clips are shared
++  // across the sweep, so each node costs one offset and intersection.
++  AXBoundsPass bounds_pass(ax_tree.get());
++  
++  // Cull nodes outside the requested scope before any per-node work. Clipped
++  // bounds collapse to the container edge once a node scrolls out of view,
++  // so the scope is tested against unclipped bounds.
++  if (!context->region.IsEmpty()) {
++    std::vector<AXBoundsPass::NodeBounds> unclipped = bounds_pass.ComputeAll(
++        ax_nodes, /*clip_bounds=*/false, device_scale_factor);
++    size_t kept = 0;
++    for (size_t i = 0; i < nodes_to_process.size(); ++i) {
++      if (IntersectsRegion(unclipped[i].bounds, context->region)) {
++        nodes_to_process[kept] = nodes_to_process[i];
++        ax_nodes[kept] = ax_nodes[i];
++        ++kept;
++      }
++    }
++    nodes_to_process.resize(kept);
++    ax_nodes.resize(kept);
++    LOG(INFO) << "[browseros] Snapshot scope " << context->region.ToString()
++              << " kept " << nodes_to_process.size() << " nodes";
 +  }
 +  
++  // Use clipped bounds so the center lies within the visible area of
++  // scrolled/clip containers. This matches how clicks should target
++  // on-screen rects.
++  std::vector<AXBoundsPass::NodeBounds> node_bounds =
++      bounds_pass.ComputeAll(ax_nodes, /*clip_bounds=*/true,
++                             device_scale_factor);
++  
 +  context->total_nodes = nodes_to_process.size();
 +  
++  // Resolve landmark ancestors for the outline while the tree is available
++  context->landmark_ids.reserve(ax_nodes.size());
++  for (const ui::AXNode* ax_node : ax_nodes) {
++    context->landmark_ids.push_back(
++        context->outline.NearestLandmark(ax_node));
++  }
++  
 +  // Handle empty case
 +  if (nodes_to_process.empty()) {
 +    base::TimeDelta processing_time = base::TimeTicks::Now() - start_time;
@@ -622,33 +740,48 @@ index 0000000000000..885942336dcd6
 +    return;
 +  }
 +  
-+  // Process nodes in batches using ThreadPool
-+  const size_t batch_size = 100;  // Process 100 nodes per batch
-+  size_t num_batches = (nodes_to_process.size() + batch_size - 1) / batch_size;
-+  context->total_batches = num_batches;
-+  
-+  for (size_t i = 0; i < nodes_to_process.size(); i += batch_size) {
-+    size_t end = std::min(i + batch_size, nodes_to_process.size());
-+    std::vector<ui::AXNodeData> batch(
-+        std::make_move_iterator(nodes_to_process.begin() + i),
-+        std::make_move_iterator(nodes_to_process.begin() + end));
-+    uint32_t start_node_id = i + 1;  // Node IDs start at 1
-+    
-+    // Post task to ThreadPool and handle result on UI thread
-+    base::ThreadPool::PostTaskAndReplyWithResult(
-+        FROM_HERE,
-+        {base::TaskPriority::USER_VISIBLE},
-+        base::BindOnce(&SnapshotProcessor::ProcessNodeBatch, 
-+                       std::move(batch), 
-+                       context->node_map,
-+                       context->ax_tree.get(),  // Pass AXTree pointer for bounds computation
-+                       start_node_id,
-+                       context->device_scale_factor),  // Pass DSF for CSS pixel conversion
-+        base::BindOnce(&SnapshotProcessor::OnBatchProcessed,
-+                       context));
++  // Summarize each container's text once; nodes under the same container
++  // share the result by reference
++  std::unordered_set<int32_t> container_ids;
++  for (size_t index : nodes_to_process) {
++    int32_t container_id =
++        context->node_store->at(index).relative_bounds.offset_container_id;
++    if (container_id >= 0) {
++      container_ids.insert(container_id);
++    }
 +  }
++  const AXNodeStore* store = context->node_store.get();
++  context->context_summaries = base::MakeRefCounted<SharedContextSummaries>(
++      BuildContextSummaries(container_ids, [store](int32_t id) {
++        return store->Find(id);
++      }));
++  
++  // Fan out over the thread pool. Workers claim ranges until none are left
++  // and write into preallocated slots; the UI thread hears back once, plus
++  // once per range when streaming.
++  context->node_indices = std::move(nodes_to_process);
++  context->node_bounds = std::move(node_bounds);
++  context->slots.resize(context->node_indices.size());
++  
++  RangeScheduler::Plan plan = RangeScheduler::PlanFor(context->total_nodes);
++  LOG(INFO) << "[browseros] Processing " << context->total_nodes
++            << " nodes on " << plan.workers << " workers, grain "
++            << plan.grain;
++  
++  RangeScheduler::RangeCallback range_done;
++  if (context->chunk_callback) {
++    range_done =
++        base::BindRepeating(&SnapshotProcessor::OnRangeProcessed, context);
++  }
++  // Workers only borrow the context; the completion callbacks keep it alive
++  // until the last of them runs.
++  RangeScheduler::Run(
++      context->total_nodes,
++      base::BindRepeating(&SnapshotProcessor::ProcessRange,
++                          base::Unretained(context.get())),
++      std::move(range_done),
++      base::BindOnce(&SnapshotProcessor::OnAllRangesProcessed, context));
 +}
 +
-+
 +}  // namespace api
 +}  // namespace extensions
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/extensions/api/browser_os/browser_os_snapshot_processor.h b/chrome/browser/extensions/api/browser_os/browser_os_snapshot_processor.h
 new file mode 100644
-index 0000000000000..5c85cd73b26f3
+index 0000000000000..1bbfd5520c304
 --- /dev/null
 +++ b/chrome/browser/extensions/api/browser_os/browser_os_snapshot_processor.h
-@@ -0,0 +1,111 @@
+@@ -0,0 +1,185 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -12,14 +12,25 @@ index 0000000000000..5c85cd73b26f3
 +#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_SNAPSHOT_PROCESSOR_H_
 +
 +#include <cstdint>
++#include <optional>
 +#include <string>
 +#include <unordered_map>
++#include <unordered_set>
++#include <utility>
 +#include <vector>
 +
 +#include "base/functional/callback.h"
++#include "base/functional/function_ref.h"
 +#include "base/memory/raw_ptr.h"
++#include "base/memory/ref_counted.h"
++#include "base/memory/ref_counted_memory.h"
++#include "base/memory/scoped_refptr.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_bounds_pass.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_node_attributes.h"
 +#include "chrome/common/extensions/api/browser_os.h"
++#include "ui/accessibility/ax_mode.h"
 +#include "ui/gfx/geometry/rect_f.h"
++#include "ui/gfx/geometry/size.h"
 +
 +namespace content {
 +class WebContents;
@@ -28,15 +39,22 @@ index 0000000000000..5c85cd73b26f3
 +namespace ui {
 +class AXNode;
 +class AXTree;
++class AXTreeID;
 +struct AXNodeData;
 +struct AXTreeUpdate;
-+enum class AXCoordinateSystem;
-+enum class AXClippingBehavior;
 +}  // namespace ui
 +
 +namespace extensions {
 +namespace api {
 +
++class AXNodeStore;
++
++// Accessibility mode of every interactive snapshot, whether taken fresh or
++// from the live engine's resident tree, so both paths see the same nodes
++inline constexpr ui::AXMode kInteractiveSnapshotAXMode(
++    ui::AXMode::kWebContents | ui::AXMode::kExtendedProperties |
++    ui::AXMode::kInlineTextBoxes);
++
 +// Result of snapshot processing
 +struct SnapshotProcessingResult {
 +  browser_os::InteractiveSnapshot snapshot;
@@ -61,10 +79,26 @@ index 0000000000000..5c85cd73b26f3
 +    browser_os::InteractiveNodeType node_type;
 +    std::string name;
 +    gfx::RectF absolute_bounds;
-+    // All attributes stored as key-value pairs
-+    std::unordered_map<std::string, std::string> attributes;
++    // Typed attributes; converted to a dictionary in AppendProcessedNode
++    NodeAttributes attributes;
 +  };
 +
++  // Resolves an AX node id to its data, or nullptr if the node is unknown.
++  // Lets per-node processing run against either a snapshot AXNodeStore or a
++  // live ui::AXTree.
++  using NodeLookup = base::FunctionRef<const ui::AXNodeData*(int32_t)>;
++
++  // Bounded text summaries of offset containers by container id, used for
++  // the "context" attribute. A null entry means the container has no text.
++  using ContextSummaries =
++      std::unordered_map<int32_t, scoped_refptr<base::RefCountedString>>;
++  using SharedContextSummaries = base::RefCountedData<ContextSummaries>;
++
++  // Receives the elements of a snapshot in nodeId order while it is still
++  // being processed. Each call continues where the previous one ended.
++  using ChunkCallback = base::RepeatingCallback<void(
++      std::vector<browser_os::InteractiveNode> elements)>;
++
 +  SnapshotProcessor() = default;
 +  ~SnapshotProcessor() = default;
 +
@@ -72,40 +106,80 @@ index 0000000000000..5c85cd73b26f3
 +  // This function processes the accessibility tree into an interactive snapshot
 +  // using parallel processing on the thread pool. Extracts viewport info from
 +  // web_contents on UI thread before processing.
++  // |screens_ahead| limits the snapshot to the viewport plus that many
++  // viewport heights below it; nullopt snapshots the whole page.
++  // If |chunk_callback| is set, elements are handed to it range by range as
++  // soon as all earlier ranges are done, and the snapshot passed to
++  // |callback| has no elements.
 +  static void ProcessAccessibilityTree(
 +      const ui::AXTreeUpdate& tree_update,
 +      int tab_id,
 +      uint32_t snapshot_id,
 +      content::WebContents* web_contents,
++      std::optional<int> screens_ahead,
++      ChunkCallback chunk_callback,
 +      base::OnceCallback<void(SnapshotProcessingResult)> callback);
 +
-+  // Process a batch of nodes (exposed for testing)
-+  // The ax_tree is used to compute accurate bounds for each node
-+  // device_scale_factor is used to convert physical pixels to CSS pixels
-+  static std::vector<ProcessedNode> ProcessNodeBatch(
-+      const std::vector<ui::AXNodeData>& nodes_to_process,
-+      const std::unordered_map<int32_t, ui::AXNodeData>& node_map,
-+      ui::AXTree* ax_tree,
-+      uint32_t start_node_id,
-+      float device_scale_factor = 1.0f);
++  // Process a single node. Returns false if the node is not interactive and
++  // should not appear in the snapshot. Fills everything in |data| except
++  // node_id, which the caller assigns. |bounds| are the node's clipped bounds
++  // in CSS pixels. |context_summaries| must cover the node's offset container.
++  static bool ProcessNode(const ui::AXNodeData& node_data,
++                          NodeLookup lookup,
++                          const AXBoundsPass::NodeBounds& bounds,
++                          const ContextSummaries& context_summaries,
++                          ProcessedNode& data);
++
++  // Summarizes the text under each of |container_ids| in document order,
++  // capped at |max_chars|. Nested containers share one pre-order walk, and
++  // each walk stops once the innermost open container has enough text, so
++  // siblings under one container never repeat the work.
++  static ContextSummaries BuildContextSummaries(
++      const std::unordered_set<int32_t>& container_ids,
++      NodeLookup lookup,
++      size_t max_chars = 200);
++
++  // Stores the tab's NodeInfo mapping for |node_data| and appends the
++  // corresponding InteractiveNode to |snapshot|. Must run on the UI thread.
++  static void AppendProcessedNode(const ProcessedNode& node_data,
++                                  int tab_id,
++                                  const ui::AXTreeID& tree_id,
++                                  browser_os::InteractiveSnapshot& snapshot);
++
++  // Returns the region, in CSS pixels relative to the top-left of the
++  // viewport, covered by the viewport and |screens_ahead| viewport heights
++  // below it. Returns an empty rect (no culling) if |screens_ahead| is nullopt
++  // or the viewport size is unknown.
++  static gfx::RectF GetScopeRegion(const gfx::Size& viewport_size,
++                                   std::optional<int> screens_ahead);
++
++  // Returns true if |bounds| (unclipped, CSS pixels) intersect |region|, or
++  // if |region| is empty.
++  static bool IntersectsRegion(const gfx::RectF& bounds,
++                               const gfx::RectF& region);
++
++  // Returns the visible viewport size and device scale factor of
++  // |web_contents|. Must run on the UI thread.
++  static std::pair<gfx::Size, float> ExtractViewportInfo(
++      content::WebContents* web_contents);
 +
 + private:
 +  // Internal processing context
 +  struct ProcessingContext;
 +  
-+  // Compute absolute bounds for a node using AXTree and convert to CSS pixels
-+  // This implements the same logic as BrowserAccessibility::GetBoundsRect
-+  // Returns bounds in CSS pixels by applying device_scale_factor
-+  static gfx::RectF GetNodeBounds(ui::AXTree* tree, 
-+                                   const ui::AXNode* node,
-+                                   const ui::AXCoordinateSystem coordinate_system,
-+                                   const ui::AXClippingBehavior clipping_behavior,
-+                                   float device_scale_factor = 1.0f,
-+                                   bool* out_offscreen = nullptr);
-+  
-+  // Batch processing callback
-+  static void OnBatchProcessed(scoped_refptr<ProcessingContext> context,
-+                               std::vector<ProcessedNode> batch_results);
++  // Processes positions [begin, end) of the context's node list into its
++  // output slots. Runs on the thread pool, concurrently with other ranges.
++  static void ProcessRange(ProcessingContext* context,
++                           size_t begin,
++                           size_t end);
++
++  // Streaming only: emits every finished range that continues the stream.
++  static void OnRangeProcessed(scoped_refptr<ProcessingContext> context,
++                               size_t begin,
++                               size_t end);
++
++  // Merges the output slots into the snapshot and runs the callback.
++  static void OnAllRangesProcessed(scoped_refptr<ProcessingContext> context);
 +
 +  SnapshotProcessor(const SnapshotProcessor&) = delete;
 +  SnapshotProcessor& operator=(const SnapshotProcessor&) = delete;
@@ -0,0 +1,126 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_text_sanitizer.cc b/chrome/browser/extensions/api/browser_os/browser_os_text_sanitizer.cc
+new file mode 100644
+index 0000000000000..1d9ac99adf754
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_text_sanitizer.cc
+@@ -0,0 +1,120 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_text_sanitizer.h"
++
++#include <bit>
++#include <cstdint>
++
++#include "base/strings/utf_string_conversion_utils.h"
++#include "base/third_party/icu/icu_utf.h"
++#include "build/build_config.h"
++
++#if defined(ARCH_CPU_X86_FAMILY)
++#include <emmintrin.h>
++#elif defined(ARCH_CPU_ARM64)
++#include <arm_neon.h>
++#endif
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++bool IsPrintableAscii(uint8_t c) {
++  return c >= 0x20 && c < 0x7f;
++}
++
++// Length of the run of printable ASCII at the start of |data|.
++size_t PrintableAsciiPrefix(const char* data, size_t size) {
++  size_t i = 0;
++#if defined(ARCH_CPU_X86_FAMILY)
++  // Signed compares: bytes >= 0x80 are negative and fail the lower bound
++  const __m128i lower = _mm_set1_epi8(0x1f);
++  const __m128i upper = _mm_set1_epi8(0x7f);
++  for (; i + 16 <= size; i += 16) {
++    __m128i block =
++        _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
++    __m128i printable = _mm_and_si128(_mm_cmpgt_epi8(block, lower),
++                                      _mm_cmplt_epi8(block, upper));
++    uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(printable));
++    if (mask != 0xffff) {
++      return i + std::countr_one(mask);
++    }
++  }
++#elif defined(ARCH_CPU_ARM64)
++  const int8x16_t lower = vdupq_n_s8(0x1f);
++  const int8x16_t upper = vdupq_n_s8(0x7f);
++  for (; i + 16 <= size; i += 16) {
++    int8x16_t block = vld1q_s8(reinterpret_cast<const int8_t*>(data + i));
++    uint8x16_t printable =
++        vandq_u8(vcgtq_s8(block, lower), vcltq_s8(block, upper));
++    if (vminvq_u8(printable) == 0) {
++      break;  // The scalar loop finds the position
++    }
++  }
++#endif
++  while (i < size && IsPrintableAscii(static_cast<uint8_t>(data[i]))) {
++    ++i;
++  }
++  return i;
++}
++
++bool IsControl(base_icu::UChar32 code_point) {
++  return code_point < 0x20 || (code_point >= 0x7f && code_point < 0xa0);
++}
++
++}  // namespace
++
++void AppendSanitizedText(std::string_view input, std::string& output) {
++  output.reserve(output.size() + input.size());
++  const char* data = input.data();
++  size_t size = input.size();
++  size_t i = 0;
++  while (i < size) {
++    size_t run = PrintableAsciiPrefix(data + i, size - i);
++    output.append(data + i, run);
++    i += run;
++    if (i == size) {
++      break;
++    }
++
++    uint8_t c = static_cast<uint8_t>(data[i]);
++    if (c == '\t' || c == '\n') {
++      output.push_back(static_cast<char>(c));
++      ++i;
++      continue;
++    }
++    if (c < 0x80) {
++      output.push_back(' ');
++      ++i;
++      continue;
++    }
++
++    // Leaves |last| on the final byte of the sequence, valid or not
++    size_t start = i;
++    size_t last = i;
++    base_icu::UChar32 code_point;
++    bool valid = base::ReadUnicodeCharacter(data, size, &last, &code_point) &&
++                 base::IsValidCharacter(code_point);
++    i = last + 1;
++    if (!valid) {
++      continue;
++    }
++    if (IsControl(code_point)) {
++      output.push_back(' ');
++    } else {
++      output.append(data + start, i - start);
++    }
++  }
++}
++
++std::string SanitizeText(std::string_view input) {
++  std::string output;
++  AppendSanitizedText(input, output);
++  return output;
++}
++
++}  // namespace api
++}  // namespace extensions
@@ -0,0 +1,38 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_text_sanitizer.h b/chrome/browser/extensions/api/browser_os/browser_os_text_sanitizer.h
+new file mode 100644
+index 0000000000000..8d0aa508a3702
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_text_sanitizer.h
+@@ -0,0 +1,32 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_TEXT_SANITIZER_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_TEXT_SANITIZER_H_
++
++#include <string>
++#include <string_view>
++
++namespace extensions {
++namespace api {
++
++// Makes page text safe to return to extensions while keeping every valid
++// character, including non-Latin scripts.
++//
++// Valid UTF-8 is kept as is, except that control characters other than tab
++// and newline (C0, DEL and C1) become a space, so words they separated stay
++// apart. Invalid bytes, surrogates and noncharacters are dropped. Runs of
++// printable ASCII are checked 16 bytes at a time where SSE2 or NEON is
++// available.
++//
++// Appends the result for |input| to |output|.
++void AppendSanitizedText(std::string_view input, std::string& output);
++
++// Same, returning a new string.
++std::string SanitizeText(std::string_view input);
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_TEXT_SANITIZER_H_
@@ -0,0 +1,161 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_text_sanitizer_perftest.cc b/chrome/browser/extensions/api/browser_os/browser_os_text_sanitizer_perftest.cc
+new file mode 100644
+index 0000000000000..101aa7d304bea
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_text_sanitizer_perftest.cc
+@@ -0,0 +1,155 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include <optional>
++#include <string>
++#include <string_view>
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_ax_corpus.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_perftest_util.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_text_sanitizer.h"
++#include "testing/gtest/include/gtest/gtest.h"
++#include "testing/perf/perf_result_reporter.h"
++#include "ui/accessibility/ax_node_data.h"
++#include "ui/accessibility/ax_tree_update.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++constexpr size_t kInputBytes = 1 << 20;
++constexpr int kIterations = 50;
++
++// The per-byte loop SanitizeText replaced, which also turned every non-ASCII
++// byte into a space
++std::string LegacySanitize(const std::string& input) {
++  std::string output;
++  output.reserve(input.size());
++  for (char c : input) {
++    if ((c >= 32 && c <= 126) || c == '\t' || c == '\n') {
++      output.push_back(c);
++    } else {
++      output.push_back(' ');
++    }
++  }
++  return output;
++}
++
++std::string Repeat(std::string_view pattern) {
++  std::string text;
++  text.reserve(kInputBytes + pattern.size());
++  while (text.size() < kInputBytes) {
++    text.append(pattern);
++  }
++  return text;
++}
++
++// Every name in the news corpus, as the snapshot sanitizes them
++std::string NewsPageNames() {
++  std::optional<ui::AXTreeUpdate> update = LoadAXCorpus(kNewsPageCorpus);
++  if (!update) {
++    return std::string();
++  }
++  std::string names;
++  for (const ui::AXNodeData& node : update->nodes) {
++    names += node.GetStringAttribute(ax::mojom::StringAttribute::kName);
++    names += '\n';
++  }
++  return names;
++}
++
++void ReportThroughput(const std::string& metric,
++                      const std::string& story,
++                      size_t bytes,
++                      const PerfMeasurement& measurement) {
++  perf_test::PerfResultReporter reporter(metric, story);
++  reporter.RegisterImportantMetric(".ns_per_byte", "ns");
++  reporter.RegisterImportantMetric(".throughput", "MB/s");
++  reporter.RegisterImportantMetric(".allocations", "count");
++  double seconds = measurement.time_per_run.InSecondsF();
++  // MeasureRuns was given the input size in bytes as its node count
++  reporter.AddResult(".ns_per_byte", measurement.ns_per_node);
++  if (seconds > 0) {
++    reporter.AddResult(".throughput", bytes / seconds / (1024 * 1024));
++  }
++  if (ScopedAllocationCounter::IsSupported()) {
++    reporter.AddResult(".allocations", measurement.allocations_per_run);
++  }
++}
++
++struct SanitizerInput {
++  const char* story;
++  std::string (*make)();
++};
++
++const SanitizerInput kInputs[] = {
++    {"ascii",
++     [] { return Repeat("Sign in to continue reading the full article. "); }},
++    {"latin_accents",
++     [] { return Repeat("Café, crème brûlée et déjà-vu. "); }},
++    {"mixed_script",
++     [] { return Repeat("Hello مرحبا ሰላም 你好 καλημέρα \U0001F600 "); }},
++    {"controls", [] { return Repeat("Line\r\none\ttwo\x01\x7f\xC2\x85 "); }},
++    {"invalid_heavy",
++     [] { return Repeat("a\xFF\xC0\xAF" "b\xED\xA0\x80\xE2\x82" "c "); }},
++    {"news_names", &NewsPageNames},
++};
++
++class BrowserOSTextSanitizerPerfTest
++    : public testing::TestWithParam<SanitizerInput> {
++ protected:
++  void SetUp() override {
++    input_ = GetParam().make();
++    ASSERT_FALSE(input_.empty()) << "No input for " << GetParam().story;
++  }
++
++  std::string input_;
++};
++
++// Appends into a reused buffer so the run measures the scan alone
++TEST_P(BrowserOSTextSanitizerPerfTest, Append) {
++  std::string output;
++  output.reserve(input_.size());
++  PerfMeasurement measurement =
++      MeasureRuns(input_.size(), kIterations, [&] {
++        output.clear();
++        AppendSanitizedText(input_, output);
++      });
++  EXPECT_LE(output.size(), input_.size());
++  ReportThroughput("BrowserOS.SanitizeText.Append", GetParam().story,
++                   input_.size(), measurement);
++}
++
++TEST_P(BrowserOSTextSanitizerPerfTest, SanitizeText) {
++  size_t size = 0;
++  PerfMeasurement measurement = MeasureRuns(
++      input_.size(), kIterations, [&] { size = SanitizeText(input_).size(); });
++  EXPECT_LE(size, input_.size());
++  ReportThroughput("BrowserOS.SanitizeText", GetParam().story, input_.size(),
++                   measurement);
++}
++
++TEST_P(BrowserOSTextSanitizerPerfTest, Legacy) {
++  size_t size = 0;
++  PerfMeasurement measurement =
++      MeasureRuns(input_.size(), kIterations,
++                  [&] { size = LegacySanitize(input_).size(); });
++  EXPECT_EQ(input_.size(), size);
++  ReportThroughput("BrowserOS.SanitizeText.Legacy", GetParam().story,
++                   input_.size(), measurement);
++}
++
++INSTANTIATE_TEST_SUITE_P(
++    All,
++    BrowserOSTextSanitizerPerfTest,
++    testing::ValuesIn(kInputs),
++    [](const testing::TestParamInfo<SanitizerInput>& info) {
++      return std::string(info.param.story);
++    });
++
++}  // namespace
++
++}  // namespace api
++}  // namespace extensions
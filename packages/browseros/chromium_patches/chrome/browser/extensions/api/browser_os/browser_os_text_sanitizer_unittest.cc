@@ -0,0 +1,151 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_text_sanitizer_unittest.cc b/chrome/browser/extensions/api/browser_os/browser_os_text_sanitizer_unittest.cc
+new file mode 100644
+index 0000000000000..5415f17d5c8f2
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_text_sanitizer_unittest.cc
+@@ -0,0 +1,145 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_text_sanitizer.h"
++
++#include <string>
++
++#include "testing/gtest/include/gtest/gtest.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++// Literals are split around hex escapes so a following letter is not read
++// as part of the escape
++
++TEST(BrowserOSTextSanitizerTest, KeepsPrintableAscii) {
++  EXPECT_EQ("", SanitizeText(""));
++  EXPECT_EQ("Sign in", SanitizeText("Sign in"));
++  const std::string all_printable =
++      " !\"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_`"
++      "abcdefghijklmnopqrstuvwxyz{|}~";
++  EXPECT_EQ(all_printable, SanitizeText(all_printable));
++}
++
++TEST(BrowserOSTextSanitizerTest, KeepsNonAsciiText) {
++  // Accented Latin, Greek, Arabic, Amharic, CJK and an emoji
++  const char* kTexts[] = {
++      "café naïve",
++      "καλημέρα",
++      "مرحبا",
++      "ሰላም",
++      "你好世界",
++      "Done \U0001F600",
++  };
++  for (const char* text : kTexts) {
++    EXPECT_EQ(text, SanitizeText(text));
++  }
++}
++
++TEST(BrowserOSTextSanitizerTest, ReplacesControlCharacters) {
++  EXPECT_EQ("a\tb\nc", SanitizeText("a\tb\nc"));
++  EXPECT_EQ("a b c d", SanitizeText("a\rb\x01" "c\x7f" "d"));
++  EXPECT_EQ(" x ", SanitizeText(std::string("\0x\0", 3)));
++  // C1 controls are two-byte sequences and become one space
++  EXPECT_EQ("a b", SanitizeText("a\xC2\x85" "b"));
++  EXPECT_EQ("a b", SanitizeText("a\xC2\x9F" "b"));
++  // U+00A0 is the first code point past C1 and is kept
++  EXPECT_EQ("a\xC2\xA0" "b", SanitizeText("a\xC2\xA0" "b"));
++}
++
++TEST(BrowserOSTextSanitizerTest, DropsInvalidBytes) {
++  EXPECT_EQ("ab", SanitizeText("a\xFF" "b"));
++  EXPECT_EQ("ab", SanitizeText("a\xFE\xFE" "b"));
++  // Lone continuation bytes
++  EXPECT_EQ("ab", SanitizeText("a\x80" "b"));
++  EXPECT_EQ("ab", SanitizeText("a\x80\xBF\x80" "b"));
++  // Lead bytes cut short by ASCII or by the end of the input
++  EXPECT_EQ("ab", SanitizeText("a\xC3" "b"));
++  EXPECT_EQ("ab", SanitizeText("a\xE2\x82" "b"));
++  EXPECT_EQ("ab", SanitizeText("a\xF0\x9F\x98" "b"));
++  EXPECT_EQ("a", SanitizeText("a\xE2\x82"));
++  // A valid character right after a bad byte survives
++  EXPECT_EQ("aé", SanitizeText("a\xFF\xC3\xA9"));
++}
++
++TEST(BrowserOSTextSanitizerTest, DropsOverlongSequences) {
++  // '/' as two, three and four bytes
++  EXPECT_EQ("ab", SanitizeText("a\xC0\xAF" "b"));
++  EXPECT_EQ("ab", SanitizeText("a\xE0\x80\xAF" "b"));
++  EXPECT_EQ("ab", SanitizeText("a\xF0\x80\x80\xAF" "b"));
++  // NUL as two bytes must not come back as a control or a space
++  EXPECT_EQ("ab", SanitizeText("a\xC0\x80" "b"));
++  // U+07FF as three bytes
++  EXPECT_EQ("ab", SanitizeText("a\xE0\x9F\xBF" "b"));
++}
++
++TEST(BrowserOSTextSanitizerTest, DropsSurrogatesAndOutOfRange) {
++  // U+D800, U+DBFF, U+DC00 and U+DFFF encoded directly
++  EXPECT_EQ("ab", SanitizeText("a\xED\xA0\x80" "b"));
++  EXPECT_EQ("ab", SanitizeText("a\xED\xAF\xBF" "b"));
++  EXPECT_EQ("ab", SanitizeText("a\xED\xB0\x80" "b"));
++  EXPECT_EQ("ab", SanitizeText("a\xED\xBF\xBF" "b"));
++  // A CESU-8 style surrogate pair for U+1F600
++  EXPECT_EQ("ab", SanitizeText("a\xED\xA0\xBD\xED\xB8\x80" "b"));
++  // U+D7FF, just below the surrogates, is kept
++  EXPECT_EQ("a\xED\x9F\xBF" "b", SanitizeText("a\xED\x9F\xBF" "b"));
++  // Past U+10FFFF
++  EXPECT_EQ("ab", SanitizeText("a\xF4\x90\x80\x80" "b"));
++  EXPECT_EQ("ab", SanitizeText("a\xF5\x80\x80\x80" "b"));
++}
++
++TEST(BrowserOSTextSanitizerTest, DropsNoncharacters) {
++  EXPECT_EQ("ab", SanitizeText("a\xEF\xBF\xBE" "b"));  // U+FFFE
++  EXPECT_EQ("ab", SanitizeText("a\xEF\xBF\xBF" "b"));  // U+FFFF
++  EXPECT_EQ("ab", SanitizeText("a\xEF\xB7\x90" "b"));  // U+FDD0
++  // U+FFFD itself is an ordinary character
++  EXPECT_EQ("a\xEF\xBF\xBD" "b", SanitizeText("a\xEF\xBF\xBD" "b"));
++}
++
++// The vector fast path works in 16-byte blocks; a byte that needs the slow
++// path must be handled the same wherever it falls
++TEST(BrowserOSTextSanitizerTest, SameResultAtEveryOffset) {
++  const struct {
++    std::string inserted;
++    std::string expected;
++  } kCases[] = {
++      {"\t", "\t"},
++      {"\x01", " "},
++      {"\x7f", " "},
++      {"\xC2\x85", " "},
++      {"\xC3\xA9", "\xC3\xA9"},
++      {"\xE2\x82\xAC", "\xE2\x82\xAC"},
++      {"\xF0\x9F\x98\x80", "\xF0\x9F\x98\x80"},
++      {"\xFF", ""},
++      {"\xC0\xAF", ""},
++      {"\xED\xA0\x80", ""},
++  };
++  const std::string ascii(40, 'x');
++  for (const auto& test_case : kCases) {
++    for (size_t offset = 0; offset <= ascii.size(); ++offset) {
++      SCOPED_TRACE(testing::Message() << "offset " << offset);
++      std::string input = ascii;
++      input.insert(offset, test_case.inserted);
++      std::string expected = ascii;
++      expected.insert(offset, test_case.expected);
++      EXPECT_EQ(expected, SanitizeText(input));
++    }
++  }
++}
++
++TEST(BrowserOSTextSanitizerTest, AppendKeepsExistingOutput) {
++  std::string output = "Name: ";
++  AppendSanitizedText("Jos\xC3\xA9\x01\xFF!", output);
++  EXPECT_EQ("Name: Jos\xC3\xA9 !", output);
++  AppendSanitizedText("", output);
++  EXPECT_EQ("Name: Jos\xC3\xA9 !", output);
++}
++
++}  // namespace
++
++}  // namespace api
++}  // namespace extensions
@@ -0,0 +1,73 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_timeout_history_observer.cc b/chrome/browser/extensions/api/browser_os/browser_os_timeout_history_observer.cc
+new file mode 100644
+index 0000000000000..faa17cbe0546e
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_timeout_history_observer.cc
+@@ -0,0 +1,67 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_timeout_history_observer.h"
++
++#include <set>
++#include <string>
++
++#include "base/logging.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_timeout_model.h"
++#include "components/history/core/browser/history_types.h"
++#include "url/origin.h"
++
++namespace extensions {
++namespace api {
++
++BrowserOSTimeoutHistoryObserver::BrowserOSTimeoutHistoryObserver(
++    PrefService* prefs,
++    history::HistoryService* history_service)
++    : prefs_(prefs) {
++  history_observation_.Observe(history_service);
++}
++
++BrowserOSTimeoutHistoryObserver::~BrowserOSTimeoutHistoryObserver() = default;
++
++void BrowserOSTimeoutHistoryObserver::Shutdown() {
++  history_observation_.Reset();
++}
++
++void BrowserOSTimeoutHistoryObserver::OnHistoryDeletions(
++    history::HistoryService* history_service,
++    const history::DeletionInfo& deletion_info) {
++  if (deletion_info.IsAllHistory()) {
++    VLOG(1) << "[browseros] History cleared, forgetting interaction timeouts";
++    BrowserOSTimeoutModel::ForgetAll(prefs_);
++    return;
++  }
++
++  // A range restricted to some URLs only removes those, which are listed
++  // in the deleted rows below
++  if (deletion_info.time_range().IsValid() &&
++      !deletion_info.restrict_urls().has_value()) {
++    BrowserOSTimeoutModel::ForgetUsedBetween(
++        prefs_, deletion_info.time_range().begin(),
++        deletion_info.time_range().end());
++  }
++
++  std::set<std::string> origins;
++  for (const history::URLRow& row : deletion_info.deleted_rows()) {
++    url::Origin origin = url::Origin::Create(row.url());
++    if (!origin.opaque()) {
++      origins.insert(origin.Serialize());
++    }
++  }
++  if (!origins.empty()) {
++    BrowserOSTimeoutModel::ForgetOrigins(prefs_, origins);
++  }
++}
++
++void BrowserOSTimeoutHistoryObserver::HistoryServiceBeingDeleted(
++    history::HistoryService* history_service) {
++  history_observation_.Reset();
++}
++
++}  // namespace api
++}  // namespace extensions
@@ -0,0 +1,61 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_timeout_history_observer.h b/chrome/browser/extensions/api/browser_os/browser_os_timeout_history_observer.h
+new file mode 100644
+index 0000000000000..6b60e450a8298
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_timeout_history_observer.h
+@@ -0,0 +1,55 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_TIMEOUT_HISTORY_OBSERVER_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_TIMEOUT_HISTORY_OBSERVER_H_
++
++#include "base/memory/raw_ptr.h"
++#include "base/scoped_observation.h"
++#include "components/history/core/browser/history_service.h"
++#include "components/history/core/browser/history_service_observer.h"
++#include "components/keyed_service/core/keyed_service.h"
++
++class PrefService;
++
++namespace extensions {
++namespace api {
++
++// Keeps the origins learned by BrowserOSTimeoutModel in step with browsing
++// history. Deleting all history forgets everything, a time range forgets the
++// origins last used in it, and deleted or expired URLs forget their origins.
++// Created with the profile, so deletions made before the first interaction
++// of a session are seen too.
++class BrowserOSTimeoutHistoryObserver : public KeyedService,
++                                        public history::HistoryServiceObserver {
++ public:
++  BrowserOSTimeoutHistoryObserver(PrefService* prefs,
++                                  history::HistoryService* history_service);
++  ~BrowserOSTimeoutHistoryObserver() override;
++
++  BrowserOSTimeoutHistoryObserver(const BrowserOSTimeoutHistoryObserver&) =
++      delete;
++  BrowserOSTimeoutHistoryObserver& operator=(
++      const BrowserOSTimeoutHistoryObserver&) = delete;
++
++  // KeyedService:
++  void Shutdown() override;
++
++  // history::HistoryServiceObserver:
++  void OnHistoryDeletions(history::HistoryService* history_service,
++                          const history::DeletionInfo& deletion_info) override;
++  void HistoryServiceBeingDeleted(
++      history::HistoryService* history_service) override;
++
++ private:
++  raw_ptr<PrefService> prefs_;
++  base::ScopedObservation<history::HistoryService,
++                          history::HistoryServiceObserver>
++      history_observation_{this};
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_TIMEOUT_HISTORY_OBSERVER_H_
@@ -0,0 +1,82 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_timeout_history_observer_factory.cc b/chrome/browser/extensions/api/browser_os/browser_os_timeout_history_observer_factory.cc
+new file mode 100644
+index 0000000000000..1818fc5651628
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_timeout_history_observer_factory.cc
+@@ -0,0 +1,76 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_timeout_history_observer_factory.h"
++
++#include <memory>
++
++#include "base/no_destructor.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_timeout_history_observer.h"
++#include "chrome/browser/history/history_service_factory.h"
++#include "chrome/browser/profiles/profile.h"
++#include "components/keyed_service/content/browser_context_dependency_manager.h"
++#include "components/keyed_service/core/service_access_type.h"
++#include "content/public/browser/browser_context.h"
++
++namespace extensions {
++namespace api {
++
++// static
++BrowserOSTimeoutHistoryObserver*
++BrowserOSTimeoutHistoryObserverFactory::GetForBrowserContext(
++    content::BrowserContext* context) {
++  return static_cast<BrowserOSTimeoutHistoryObserver*>(
++      GetInstance()->GetServiceForBrowserContext(context, true));
++}
++
++// static
++BrowserOSTimeoutHistoryObserverFactory*
++BrowserOSTimeoutHistoryObserverFactory::GetInstance() {
++  static base::NoDestructor<BrowserOSTimeoutHistoryObserverFactory> instance;
++  return instance.get();
++}
++
++BrowserOSTimeoutHistoryObserverFactory::BrowserOSTimeoutHistoryObserverFactory()
++    : BrowserContextKeyedServiceFactory(
++          "BrowserOSTimeoutHistoryObserver",
++          BrowserContextDependencyManager::GetInstance()) {
++  DependsOn(HistoryServiceFactory::GetInstance());
++}
++
++BrowserOSTimeoutHistoryObserverFactory::
++    ~BrowserOSTimeoutHistoryObserverFactory() = default;
++
++std::unique_ptr<KeyedService>
++BrowserOSTimeoutHistoryObserverFactory::BuildServiceInstanceForBrowserContext(
++    content::BrowserContext* context) const {
++  Profile* profile = Profile::FromBrowserContext(context);
++
++  // Incognito only learns into its in-memory pref overlay
++  if (profile->IsOffTheRecord()) {
++    return nullptr;
++  }
++
++  history::HistoryService* history_service =
++      HistoryServiceFactory::GetForProfile(profile,
++                                           ServiceAccessType::EXPLICIT_ACCESS);
++  if (!history_service) {
++    return nullptr;
++  }
++  return std::make_unique<BrowserOSTimeoutHistoryObserver>(profile->GetPrefs(),
++                                                           history_service);
++}
++
++bool BrowserOSTimeoutHistoryObserverFactory::
++    ServiceIsCreatedWithBrowserContext() const {
++  return true;
++}
++
++bool BrowserOSTimeoutHistoryObserverFactory::ServiceIsNULLWhileTesting()
++    const {
++  return true;
++}
++
++}  // namespace api
++}  // namespace extensions
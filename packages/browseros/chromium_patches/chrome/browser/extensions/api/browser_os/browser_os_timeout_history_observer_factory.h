@@ -0,0 +1,58 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_timeout_history_observer_factory.h b/chrome/browser/extensions/api/browser_os/browser_os_timeout_history_observer_factory.h
+new file mode 100644
+index 0000000000000..49f4cd4c7c19c
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_timeout_history_observer_factory.h
+@@ -0,0 +1,52 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_TIMEOUT_HISTORY_OBSERVER_FACTORY_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_TIMEOUT_HISTORY_OBSERVER_FACTORY_H_
++
++#include "base/no_destructor.h"
++#include "components/keyed_service/content/browser_context_keyed_service_factory.h"
++
++namespace content {
++class BrowserContext;
++}  // namespace content
++
++namespace extensions {
++namespace api {
++
++class BrowserOSTimeoutHistoryObserver;
++
++// Factory for the BrowserOSTimeoutHistoryObserver of each regular profile.
++class BrowserOSTimeoutHistoryObserverFactory
++    : public BrowserContextKeyedServiceFactory {
++ public:
++  BrowserOSTimeoutHistoryObserverFactory(
++      const BrowserOSTimeoutHistoryObserverFactory&) = delete;
++  BrowserOSTimeoutHistoryObserverFactory& operator=(
++      const BrowserOSTimeoutHistoryObserverFactory&) = delete;
++
++  // Returns the observer for |context|, or null for incognito profiles.
++  static BrowserOSTimeoutHistoryObserver* GetForBrowserContext(
++      content::BrowserContext* context);
++
++  // Returns the singleton factory instance.
++  static BrowserOSTimeoutHistoryObserverFactory* GetInstance();
++
++ private:
++  friend base::NoDestructor<BrowserOSTimeoutHistoryObserverFactory>;
++
++  BrowserOSTimeoutHistoryObserverFactory();
++  ~BrowserOSTimeoutHistoryObserverFactory() override;
++
++  // BrowserContextKeyedServiceFactory:
++  std::unique_ptr<KeyedService> BuildServiceInstanceForBrowserContext(
++      content::BrowserContext* context) const override;
++  bool ServiceIsCreatedWithBrowserContext() const override;
++  bool ServiceIsNULLWhileTesting() const override;
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_TIMEOUT_HISTORY_OBSERVER_FACTORY_H_
@@ -0,0 +1,273 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_timeout_model.cc b/chrome/browser/extensions/api/browser_os/browser_os_timeout_model.cc
+new file mode 100644
+index 0000000000000..b458351c9a3e8
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_timeout_model.cc
+@@ -0,0 +1,267 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_timeout_model.h"
++
++#include <algorithm>
++#include <cmath>
++#include <functional>
++#include <utility>
++
++#include "base/check.h"
++#include "base/notreached.h"
++#include "base/values.h"
++#include "chrome/common/pref_names.h"
++#include "components/prefs/pref_service.h"
++#include "components/prefs/scoped_user_pref_update.h"
++#include "url/origin.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++constexpr size_t kBucketCount = BrowserOSTimeoutModel::kBucketEdgesMs.size();
++using Counts = std::array<uint32_t, kBucketCount>;
++
++// Last use of an origin, in milliseconds since the Unix epoch
++const char kUsedKey[] = "used";
++
++constexpr std::array<InteractionKind, BrowserOSTimeoutModel::kKindCount>
++    kAllKinds = {InteractionKind::kClick, InteractionKind::kHtmlClick,
++                 InteractionKind::kType,  InteractionKind::kJavaScriptType,
++                 InteractionKind::kClear, InteractionKind::kKeyPress};
++
++// Reads the histogram of |kind| from an origin's dict. A missing or
++// malformed one reads as empty. Returns the sample count.
++uint32_t ReadCounts(const base::Value::Dict* origin_dict,
++                    InteractionKind kind,
++                    Counts& counts) {
++  counts.fill(0);
++  if (!origin_dict) {
++    return 0;
++  }
++  const base::Value::List* list =
++      origin_dict->FindList(BrowserOSTimeoutModel::KindName(kind));
++  if (!list || list->size() != kBucketCount) {
++    return 0;
++  }
++  uint32_t total = 0;
++  for (size_t i = 0; i < kBucketCount; ++i) {
++    int count = (*list)[i].is_int() ? (*list)[i].GetInt() : 0;
++    counts[i] = static_cast<uint32_t>(std::max(count, 0));
++    total += counts[i];
++  }
++  return total;
++}
++
++base::TimeDelta TimeoutFromCounts(const Counts& counts,
++                                  uint32_t total,
++                                  InteractionKind kind) {
++  if (total < BrowserOSTimeoutModel::kMinSamples) {
++    return BrowserOSTimeoutModel::DefaultTimeout(kind);
++  }
++  uint32_t rank = static_cast<uint32_t>(
++      std::ceil(BrowserOSTimeoutModel::kPercentile * total));
++  uint32_t seen = 0;
++  size_t bucket = kBucketCount - 1;
++  for (size_t i = 0; i < kBucketCount; ++i) {
++    seen += counts[i];
++    if (seen >= rank) {
++      bucket = i;
++      break;
++    }
++  }
++  return std::clamp(
++      base::Milliseconds(BrowserOSTimeoutModel::kBucketEdgesMs[bucket]),
++      BrowserOSTimeoutModel::kMinTimeout, BrowserOSTimeoutModel::kMaxTimeout);
++}
++
++// Drops the least recently used origin.
++void EvictOldest(base::Value::Dict& origins) {
++  std::string oldest;
++  double oldest_used = 0;
++  for (auto [key, value] : origins) {
++    double used = value.is_dict()
++                      ? value.GetDict().FindDouble(kUsedKey).value_or(0)
++                      : 0;
++    if (oldest.empty() || used < oldest_used) {
++      oldest = key;
++      oldest_used = used;
++    }
++  }
++  origins.Remove(oldest);
++}
++
++}  // namespace
++
++// static
++base::TimeDelta BrowserOSTimeoutModel::DefaultTimeout(InteractionKind kind) {
++  switch (kind) {
++    case InteractionKind::kClick:
++    case InteractionKind::kType:
++      return base::Milliseconds(300);
++    case InteractionKind::kHtmlClick:
++    case InteractionKind::kJavaScriptType:
++    case InteractionKind::kClear:
++    case InteractionKind::kKeyPress:
++      return base::Milliseconds(200);
++  }
++  NOTREACHED();
++}
++
++// static
++const char* BrowserOSTimeoutModel::KindName(InteractionKind kind) {
++  switch (kind) {
++    case InteractionKind::kClick:
++      return "click";
++    case InteractionKind::kHtmlClick:
++      return "htmlClick";
++    case InteractionKind::kType:
++      return "type";
++    case InteractionKind::kJavaScriptType:
++      return "javascriptType";
++    case InteractionKind::kClear:
++      return "clear";
++    case InteractionKind::kKeyPress:
++      return "keyPress";
++  }
++  NOTREACHED();
++}
++
++// static
++base::TimeDelta BrowserOSTimeoutModel::GetTimeout(PrefService* prefs,
++                                                  const url::Origin& origin,
++                                                  InteractionKind kind) {
++  if (!prefs || origin.opaque()) {
++    return DefaultTimeout(kind);
++  }
++  const base::Value::Dict* origin_dict =
++      prefs->GetDict(prefs::kBrowserOSInteractionTimeouts)
++          .FindDict(origin.Serialize());
++  Counts counts;
++  uint32_t total = ReadCounts(origin_dict, kind, counts);
++  return TimeoutFromCounts(counts, total, kind);
++}
++
++// static
++void BrowserOSTimeoutModel::RecordLatency(PrefService* prefs,
++                                          const url::Origin& origin,
++                                          InteractionKind kind,
++                                          base::TimeDelta latency) {
++  if (!prefs || origin.opaque()) {
++    return;
++  }
++  ScopedDictPrefUpdate update(prefs, prefs::kBrowserOSInteractionTimeouts);
++  base::Value::Dict& origins = update.Get();
++  std::string key = origin.Serialize();
++  if (!origins.FindDict(key) && origins.size() >= kMaxOrigins) {
++    EvictOldest(origins);
++  }
++  base::Value::Dict* origin_dict = origins.EnsureDict(key);
++  origin_dict->Set(kUsedKey,
++                   base::Time::Now().InMillisecondsFSinceUnixEpoch());
++
++  Counts counts;
++  uint32_t total = ReadCounts(origin_dict, kind, counts);
++  auto edge = std::lower_bound(kBucketEdgesMs.begin(), kBucketEdgesMs.end(),
++                               latency.InMilliseconds());
++  size_t bucket = std::min<size_t>(edge - kBucketEdgesMs.begin(),
++                                   kBucketCount - 1);
++  ++counts[bucket];
++  if (++total > kMaxSamples) {
++    // Keep every bucket that has samples, but let new ones outweigh them
++    for (uint32_t& count : counts) {
++      count = (count + 1) / 2;
++    }
++  }
++
++  base::Value::List list;
++  list.reserve(kBucketCount);
++  for (uint32_t count : counts) {
++    list.Append(static_cast<int>(count));
++  }
++  origin_dict->Set(KindName(kind), std::move(list));
++}
++
++// static
++std::vector<BrowserOSTimeoutModel::Entry> BrowserOSTimeoutModel::GetEntries(
++    PrefService* prefs,
++    const url::Origin* origin) {
++  const base::Value::Dict& origins =
++      prefs->GetDict(prefs::kBrowserOSInteractionTimeouts);
++
++  std::vector<std::pair<double, std::string>> keys;
++  if (origin) {
++    keys.emplace_back(0, origin->Serialize());
++  } else {
++    for (auto [key, value] : origins) {
++      if (value.is_dict()) {
++        keys.emplace_back(value.GetDict().FindDouble(kUsedKey).value_or(0),
++                          key);
++      }
++    }
++    std::sort(keys.begin(), keys.end(), std::greater<>());
++  }
++
++  std::vector<Entry> entries;
++  entries.reserve(keys.size() * kKindCount);
++  for (const auto& [used, key] : keys) {
++    const base::Value::Dict* origin_dict = origins.FindDict(key);
++    for (InteractionKind kind : kAllKinds) {
++      Counts counts;
++      Entry& entry = entries.emplace_back();
++      entry.origin = key;
++      entry.kind = kind;
++      entry.samples = ReadCounts(origin_dict, kind, counts);
++      entry.timeout = TimeoutFromCounts(counts, entry.samples, kind);
++      entry.learned = entry.samples >= kMinSamples;
++    }
++  }
++  return entries;
++}
++
++// static
++void BrowserOSTimeoutModel::ForgetUsedBetween(PrefService* prefs,
++                                              base::Time begin,
++                                              base::Time end) {
++  if (end.is_null()) {
++    end = base::Time::Max();
++  }
++  ScopedDictPrefUpdate update(prefs, prefs::kBrowserOSInteractionTimeouts);
++  std::vector<std::string> forget;
++  for (auto [key, value] : update.Get()) {
++    // Malformed entries go too
++    if (!value.is_dict()) {
++      forget.push_back(key);
++      continue;
++    }
++    base::Time used = base::Time::FromMillisecondsSinceUnixEpoch(
++        value.GetDict().FindDouble(kUsedKey).value_or(0));
++    if (used >= begin && used < end) {
++      forget.push_back(key);
++    }
++  }
++  for (const std::string& key : forget) {
++    update->Remove(key);
++  }
++}
++
++// static
++void BrowserOSTimeoutModel::ForgetOrigins(
++    PrefService* prefs,
++    const std::set<std::string>& origins) {
++  ScopedDictPrefUpdate update(prefs, prefs::kBrowserOSInteractionTimeouts);
++  for (const std::string& origin : origins) {
++    update->Remove(origin);
++  }
++}
++
++// static
++void BrowserOSTimeoutModel::ForgetAll(PrefService* prefs) {
++  prefs->ClearPref(prefs::kBrowserOSInteractionTimeouts);
++}
++
++}  // namespace api
++}  // namespace extensions
@@ -0,0 +1,126 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_timeout_model.h b/chrome/browser/extensions/api/browser_os/browser_os_timeout_model.h
+new file mode 100644
+index 0000000000000..00a3f664aa8d3
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_timeout_model.h
+@@ -0,0 +1,120 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_TIMEOUT_MODEL_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_TIMEOUT_MODEL_H_
++
++#include <array>
++#include <cstddef>
++#include <cstdint>
++#include <set>
++#include <string>
++#include <vector>
++
++#include "base/time/time.h"
++
++class PrefService;
++
++namespace url {
++class Origin;
++}  // namespace url
++
++namespace extensions {
++namespace api {
++
++// The ways an action can try to change a page, each with its own timeout.
++enum class InteractionKind {
++  kClick,           // Mouse click at a point
++  kHtmlClick,       // JavaScript click, the fallback for kClick
++  kType,            // Native text input
++  kJavaScriptType,  // JavaScript value assignment, the fallback for kType
++  kClear,
++  kKeyPress,
++};
++
++// Learns how long interactions take to change the page, per origin, and
++// derives change-detection timeouts from it.
++//
++// Each origin keeps a histogram of time-to-first-change per interaction
++// kind. Once an interaction has kMinSamples samples, its timeout is the
++// upper edge of the bucket holding the kPercentile-th latency, clamped to
++// [kMinTimeout, kMaxTimeout]; until then the fixed default is used. Counts
++// are halved once they pass kMaxSamples, so the model follows sites that
++// change.
++//
++// The histograms live in the browseros.interaction_timeouts profile pref,
++// bounded to the kMaxOrigins most recently used origins. Since that is a
++// record of visited sites, BrowserOSTimeoutHistoryObserver forgets origins
++// along with their browsing history. Incognito profiles write to their
++// in-memory pref overlay, so they read what regular browsing learned but
++// never persist anything. UI thread only.
++class BrowserOSTimeoutModel {
++ public:
++  static constexpr size_t kKindCount = 6;
++  static constexpr size_t kMinSamples = 8;
++  static constexpr uint32_t kMaxSamples = 200;
++  static constexpr size_t kMaxOrigins = 200;
++  static constexpr double kPercentile = 0.95;
++  static constexpr base::TimeDelta kMinTimeout = base::Milliseconds(100);
++  // Also how long a change is still waited for, for learning only, after
++  // the action already timed out
++  static constexpr base::TimeDelta kMaxTimeout = base::Seconds(5);
++
++  // Upper bucket edges in milliseconds. Latencies past the last edge count
++  // in the last bucket.
++  static constexpr std::array<int, 13> kBucketEdgesMs = {
++      50, 100, 150, 200, 300, 400, 600, 800, 1200, 1600, 2400, 3200, 5000};
++
++  // What the model knows about one interaction kind on one origin.
++  struct Entry {
++    std::string origin;
++    InteractionKind kind;
++    base::TimeDelta timeout;
++    uint32_t samples = 0;
++    // False while the default timeout is used
++    bool learned = false;
++  };
++
++  BrowserOSTimeoutModel() = delete;
++
++  // Fixed timeout used until enough samples are in.
++  static base::TimeDelta DefaultTimeout(InteractionKind kind);
++
++  // Name of |kind| in the pref and the API.
++  static const char* KindName(InteractionKind kind);
++
++  // Timeout for detecting a change from |kind| on |origin|.
++  static base::TimeDelta GetTimeout(PrefService* prefs,
++                                    const url::Origin& origin,
++                                    InteractionKind kind);
++
++  // Records that |kind| changed a page of |origin| after |latency|.
++  static void RecordLatency(PrefService* prefs,
++                            const url::Origin& origin,
++                            InteractionKind kind,
++                            base::TimeDelta latency);
++
++  // Every interaction kind of |origin|, or of all learned origins if
++  // |origin| is null, most recently used first.
++  static std::vector<Entry> GetEntries(PrefService* prefs,
++                                       const url::Origin* origin);
++
++  // Forgets every origin last used in [begin, end). A null |end| means no
++  // upper bound.
++  static void ForgetUsedBetween(PrefService* prefs,
++                                base::Time begin,
++                                base::Time end);
++
++  // Forgets the serialized |origins|.
++  static void ForgetOrigins(PrefService* prefs,
++                            const std::set<std::string>& origins);
++
++  // Forgets everything.
++  static void ForgetAll(PrefService* prefs);
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_TIMEOUT_MODEL_H_
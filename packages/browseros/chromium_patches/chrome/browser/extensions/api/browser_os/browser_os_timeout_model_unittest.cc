@@ -0,0 +1,276 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_timeout_model_unittest.cc b/chrome/browser/extensions/api/browser_os/browser_os_timeout_model_unittest.cc
+new file mode 100644
+index 0000000000000..0a237f9ea8972
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_timeout_model_unittest.cc
+@@ -0,0 +1,270 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_timeout_model.h"
++
++#include <set>
++#include <string>
++#include <vector>
++
++#include "base/strings/string_number_conversions.h"
++#include "base/test/task_environment.h"
++#include "base/time/time.h"
++#include "base/values.h"
++#include "chrome/common/pref_names.h"
++#include "components/prefs/scoped_user_pref_update.h"
++#include "components/prefs/testing_pref_service.h"
++#include "testing/gtest/include/gtest/gtest.h"
++#include "url/gurl.h"
++#include "url/origin.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++using Model = BrowserOSTimeoutModel;
++
++url::Origin Origin(const std::string& host) {
++  return url::Origin::Create(GURL("https://" + host + "/"));
++}
++
++class BrowserOSTimeoutModelTest : public testing::Test {
++ protected:
++  BrowserOSTimeoutModelTest() {
++    prefs_.registry()->RegisterDictionaryPref(
++        prefs::kBrowserOSInteractionTimeouts);
++  }
++
++  void Record(const url::Origin& origin,
++              InteractionKind kind,
++              int latency_ms,
++              size_t times = 1) {
++    for (size_t i = 0; i < times; ++i) {
++      Model::RecordLatency(&prefs_, origin, kind,
++                           base::Milliseconds(latency_ms));
++    }
++  }
++
++  base::TimeDelta Timeout(const url::Origin& origin, InteractionKind kind) {
++    return Model::GetTimeout(&prefs_, origin, kind);
++  }
++
++  Model::Entry EntryFor(const url::Origin& origin, InteractionKind kind) {
++    for (const Model::Entry& entry : Model::GetEntries(&prefs_, &origin)) {
++      if (entry.kind == kind) {
++        return entry;
++      }
++    }
++    ADD_FAILURE() << "No entry for " << Model::KindName(kind);
++    return Model::Entry();
++  }
++
++  // Origins in the order GetEntries lists them
++  std::vector<std::string> ListedOrigins() {
++    std::vector<std::string> origins;
++    for (const Model::Entry& entry : Model::GetEntries(&prefs_, nullptr)) {
++      if (origins.empty() || origins.back() != entry.origin) {
++        origins.push_back(entry.origin);
++      }
++    }
++    return origins;
++  }
++
++  base::test::TaskEnvironment task_environment_{
++      base::test::TaskEnvironment::TimeSource::MOCK_TIME};
++  TestingPrefServiceSimple prefs_;
++};
++
++TEST_F(BrowserOSTimeoutModelTest, DefaultUntilEnoughSamples) {
++  const url::Origin origin = Origin("a.test");
++  EXPECT_EQ(Model::DefaultTimeout(InteractionKind::kKeyPress),
++            Timeout(origin, InteractionKind::kKeyPress));
++
++  Record(origin, InteractionKind::kKeyPress, 550, Model::kMinSamples - 1);
++  EXPECT_EQ(Model::DefaultTimeout(InteractionKind::kKeyPress),
++            Timeout(origin, InteractionKind::kKeyPress));
++  Model::Entry entry = EntryFor(origin, InteractionKind::kKeyPress);
++  EXPECT_EQ(Model::kMinSamples - 1, entry.samples);
++  EXPECT_FALSE(entry.learned);
++
++  // 550 ms falls in the bucket up to 600 ms
++  Record(origin, InteractionKind::kKeyPress, 550);
++  EXPECT_EQ(base::Milliseconds(600),
++            Timeout(origin, InteractionKind::kKeyPress));
++  entry = EntryFor(origin, InteractionKind::kKeyPress);
++  EXPECT_TRUE(entry.learned);
++  EXPECT_EQ(base::Milliseconds(600), entry.timeout);
++}
++
++TEST_F(BrowserOSTimeoutModelTest, UsesPercentileBucket) {
++  const url::Origin origin = Origin("a.test");
++  // 19 of 20 fast: the 95th percentile is still fast
++  Record(origin, InteractionKind::kClick, 140, 19);
++  Record(origin, InteractionKind::kClick, 1500);
++  EXPECT_EQ(base::Milliseconds(150), Timeout(origin, InteractionKind::kClick));
++
++  // 19 of 21 fast: it is not
++  Record(origin, InteractionKind::kClick, 1500);
++  EXPECT_EQ(base::Milliseconds(1600),
++            Timeout(origin, InteractionKind::kClick));
++}
++
++TEST_F(BrowserOSTimeoutModelTest, ClampsToBounds) {
++  const url::Origin fast = Origin("fast.test");
++  Record(fast, InteractionKind::kClick, 10, Model::kMinSamples);
++  EXPECT_EQ(Model::kMinTimeout, Timeout(fast, InteractionKind::kClick));
++
++  // Past the last edge counts in the last bucket
++  const url::Origin slow = Origin("slow.test");
++  Record(slow, InteractionKind::kClick, 60000, Model::kMinSamples);
++  EXPECT_EQ(Model::kMaxTimeout, Timeout(slow, InteractionKind::kClick));
++}
++
++TEST_F(BrowserOSTimeoutModelTest, KindsAndOriginsAreSeparate) {
++  const url::Origin a = Origin("a.test");
++  const url::Origin b = Origin("b.test");
++  Record(a, InteractionKind::kClick, 1100, Model::kMinSamples);
++
++  EXPECT_EQ(base::Milliseconds(1200), Timeout(a, InteractionKind::kClick));
++  EXPECT_EQ(Model::DefaultTimeout(InteractionKind::kHtmlClick),
++            Timeout(a, InteractionKind::kHtmlClick));
++  EXPECT_EQ(Model::DefaultTimeout(InteractionKind::kClick),
++            Timeout(b, InteractionKind::kClick));
++  // Same host, other scheme
++  EXPECT_EQ(Model::DefaultTimeout(InteractionKind::kClick),
++            Timeout(url::Origin::Create(GURL("http://a.test/")),
++                    InteractionKind::kClick));
++}
++
++TEST_F(BrowserOSTimeoutModelTest, IgnoresOpaqueOriginsAndMissingPrefs) {
++  const url::Origin opaque;
++  Record(opaque, InteractionKind::kClick, 1100, Model::kMinSamples);
++  EXPECT_EQ(Model::DefaultTimeout(InteractionKind::kClick),
++            Timeout(opaque, InteractionKind::kClick));
++  EXPECT_TRUE(prefs_.GetDict(prefs::kBrowserOSInteractionTimeouts).empty());
++
++  Model::RecordLatency(nullptr, Origin("a.test"), InteractionKind::kClick,
++                       base::Milliseconds(1100));
++  EXPECT_EQ(Model::DefaultTimeout(InteractionKind::kType),
++            Model::GetTimeout(nullptr, Origin("a.test"),
++                              InteractionKind::kType));
++}
++
++TEST_F(BrowserOSTimeoutModelTest, HalvesPastMaxSamples) {
++  const url::Origin origin = Origin("a.test");
++  Record(origin, InteractionKind::kType, 140, Model::kMaxSamples);
++  EXPECT_EQ(Model::kMaxSamples,
++            EntryFor(origin, InteractionKind::kType).samples);
++
++  // 200 fast and 1 slow become 100 and 1
++  Record(origin, InteractionKind::kType, 1500);
++  EXPECT_EQ(101u, EntryFor(origin, InteractionKind::kType).samples);
++  EXPECT_EQ(base::Milliseconds(150), Timeout(origin, InteractionKind::kType));
++
++  // A site that slowed down takes over
++  Record(origin, InteractionKind::kType, 1500, Model::kMaxSamples);
++  EXPECT_EQ(base::Milliseconds(1600),
++            Timeout(origin, InteractionKind::kType));
++  EXPECT_LE(EntryFor(origin, InteractionKind::kType).samples,
++            Model::kMaxSamples);
++}
++
++TEST_F(BrowserOSTimeoutModelTest, EvictsLeastRecentlyUsedOrigin) {
++  auto origin = [](size_t i) {
++    return Origin("site" + base::NumberToString(i) + ".test");
++  };
++  for (size_t i = 0; i < Model::kMaxOrigins; ++i) {
++    Record(origin(i), InteractionKind::kClick, 100);
++    task_environment_.FastForwardBy(base::Seconds(1));
++  }
++  // site0 is used again, so site1 is now the oldest
++  Record(origin(0), InteractionKind::kClick, 100);
++  task_environment_.FastForwardBy(base::Seconds(1));
++  Record(origin(Model::kMaxOrigins), InteractionKind::kClick, 100);
++
++  std::vector<std::string> origins = ListedOrigins();
++  ASSERT_EQ(Model::kMaxOrigins, origins.size());
++  EXPECT_EQ(origin(Model::kMaxOrigins).Serialize(), origins[0]);
++  EXPECT_EQ(origin(0).Serialize(), origins[1]);
++  EXPECT_EQ(0u, EntryFor(origin(1), InteractionKind::kClick).samples);
++  EXPECT_EQ(1u, EntryFor(origin(2), InteractionKind::kClick).samples);
++}
++
++TEST_F(BrowserOSTimeoutModelTest, ListsEveryKindPerOrigin) {
++  Record(Origin("a.test"), InteractionKind::kClear, 100);
++  std::vector<Model::Entry> entries = Model::GetEntries(&prefs_, nullptr);
++  ASSERT_EQ(Model::kKindCount, entries.size());
++  std::set<std::string> names;
++  for (const Model::Entry& entry : entries) {
++    names.insert(Model::KindName(entry.kind));
++    EXPECT_EQ(entry.kind == InteractionKind::kClear ? 1u : 0u, entry.samples);
++  }
++  EXPECT_EQ((std::set<std::string>{"click", "htmlClick", "type",
++                                   "javascriptType", "clear", "keyPress"}),
++            names);
++
++  // An origin never seen still lists its defaults
++  const url::Origin unseen = Origin("b.test");
++  entries = Model::GetEntries(&prefs_, &unseen);
++  ASSERT_EQ(Model::kKindCount, entries.size());
++  for (const Model::Entry& entry : entries) {
++    EXPECT_EQ(0u, entry.samples);
++    EXPECT_EQ(Model::DefaultTimeout(entry.kind), entry.timeout);
++  }
++}
++
++TEST_F(BrowserOSTimeoutModelTest, Forgets) {
++  const url::Origin a = Origin("a.test");
++  const url::Origin b = Origin("b.test");
++  const url::Origin c = Origin("c.test");
++  base::Time start = base::Time::Now();
++  Record(a, InteractionKind::kClick, 100);
++  task_environment_.FastForwardBy(base::Hours(1));
++  Record(b, InteractionKind::kClick, 100);
++  Record(c, InteractionKind::kClick, 100);
++
++  // Everything used in the last half hour
++  Model::ForgetUsedBetween(&prefs_, start + base::Minutes(30), base::Time());
++  EXPECT_EQ((std::vector<std::string>{a.Serialize()}), ListedOrigins());
++
++  Record(b, InteractionKind::kClick, 100);
++  Record(c, InteractionKind::kClick, 100);
++  Model::ForgetOrigins(&prefs_, {a.Serialize(), c.Serialize()});
++  EXPECT_EQ((std::vector<std::string>{b.Serialize()}), ListedOrigins());
++
++  Model::ForgetAll(&prefs_);
++  EXPECT_TRUE(ListedOrigins().empty());
++}
++
++TEST_F(BrowserOSTimeoutModelTest, MalformedPrefReadsAsEmpty) {
++  const url::Origin origin = Origin("a.test");
++  {
++    ScopedDictPrefUpdate update(&prefs_, prefs::kBrowserOSInteractionTimeouts);
++    base::Value::Dict origin_dict;
++    // Too few buckets
++    origin_dict.Set("click", base::Value::List().Append(50).Append(50));
++    origin_dict.Set("type", "fast");
++    update->Set(origin.Serialize(), std::move(origin_dict));
++    update->Set("https://broken.test", 3);
++  }
++  EXPECT_EQ(Model::DefaultTimeout(InteractionKind::kClick),
++            Timeout(origin, InteractionKind::kClick));
++  EXPECT_EQ(Model::DefaultTimeout(InteractionKind::kType),
++            Timeout(origin, InteractionKind::kType));
++
++  // Recording starts the histogram over
++  Record(origin, InteractionKind::kClick, 100);
++  EXPECT_EQ(1u, EntryFor(origin, InteractionKind::kClick).samples);
++
++  // Entries that are not dicts are forgotten with any range
++  Model::ForgetUsedBetween(&prefs_, base::Time::Max(), base::Time());
++  EXPECT_FALSE(prefs_.GetDict(prefs::kBrowserOSInteractionTimeouts)
++                   .contains("https://broken.test"));
++}
++
++}  // namespace
++
++}  // namespace api
++}  // namespace extensions
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/ui/views/side_panel/browseros_simple_page_extractor.h b/chrome/browser/ui/views/side_panel/browseros_simple_page_extractor.h
 new file mode 100644
-index 0000000000000..b9cbddf65327e
+index 0000000000000..fffb8fa9c7159
 --- /dev/null
 +++ b/chrome/browser/ui/views/side_panel/browseros_simple_page_extractor.h
-@@ -0,0 +1,71 @@
+@@ -0,0 +1,81 @@
 +// Copyright 2025 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -13,6 +13,8 @@ index 0000000000000..b9cbddf65327e
 +
 +#include <string>
 +
++#include "chrome/browser/extensions/api/browser_os/browser_os_page_extractor.h"
++
 +namespace ui {
 +struct AXTreeUpdate;
 +}  // namespace ui
@@ -24,7 +26,8 @@ index 0000000000000..b9cbddf65327e
 +//
 +// Uses depth-first search (DFS) with semantic boundary detection to extract
 +// clean, structured text without duplication. Formats output as markdown-like
-+// text optimized for LLM consumption.
++// text optimized for LLM consumption. The walk is the shared
++// extensions::api::PageExtractor with a MarkdownSink.
 +//
 +// Extraction Strategy:
 +//   - Navigation/Banner: Extracted with spacing to separate from content
@@ -58,12 +61,19 @@ index 0000000000000..b9cbddf65327e
 +  //
 +  // Args:
 +  //   update: The accessibility tree snapshot from RequestAXTreeSnapshot()
++  //   options: Optional trimming. max_chars keeps only the best ranked
++  //            regions of the page that fit in about this many characters
++  //            (main content first, navigation and footers last);
++  //            boilerplate replaces headers, menus and footers that other
++  //            pages of the site repeat with a one-line reference
 +  //
 +  // Returns:
 +  //   Structured text with markdown-like formatting, or empty string if:
 +  //   - The tree is empty (update.nodes.empty())
 +  //   - The tree contains no readable text content
-+  static std::u16string ExtractStructuredText(const ui::AXTreeUpdate& update);
++  static std::u16string ExtractStructuredText(
++      const ui::AXTreeUpdate& update,
++      const extensions::api::PageExtractionOptions& options = {});
 +
 +  // Utility class - no instances allowed
 +  BrowserOSSimplePageExtractor() = delete;
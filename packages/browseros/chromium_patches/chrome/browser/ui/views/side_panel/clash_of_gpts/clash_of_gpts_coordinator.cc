@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_coordinator.cc b/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_coordinator.cc
 new file mode 100644
-index 0000000000000..6167eb277556d
+index 0000000000000..c17b589507997
 --- /dev/null
 +++ b/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_coordinator.cc
-@@ -0,0 +1,568 @@
+@@ -0,0 +1,601 @@
 +// Copyright 2025 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -39,6 +39,8 @@ index 0000000000000..6167eb277556d
 +#include "ui/events/keycodes/keyboard_codes.h"
 +#include "third_party/blink/public/common/input/web_input_event.h"
 +#include "components/metrics/browseros_metrics/browseros_metrics.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_extraction_cache.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_page_extractor.h"
 +
 +namespace {
 +
@@ -50,6 +52,21 @@ index 0000000000000..6167eb277556d
 +// Shared provider list preference (from third_party_llm)
 +const char kThirdPartyLlmProvidersPref[] = "browseros.third_party_llm.providers";
 +
++// Formats the page text for comparison across LLMs and copies it.
++void CopyPageText(const std::u16string& title,
++                  const GURL& url,
++                  const std::u16string& extracted_text) {
++  std::u16string formatted_output = u"----------- WEB PAGE CONTENT -----------\n\n";
++  formatted_output += u"TITLE: " + title + u"\n\n";
++  formatted_output += u"URL: " + base::UTF8ToUTF16(url.spec()) + u"\n\n";
++  formatted_output += u"CONTENT:\n\n" + extracted_text;
++  formatted_output += u"\n\n----------- USER PROMPT -----------\n\n";
++
++  // Copy to clipboard
++  ui::ScopedClipboardWriter clipboard_writer(ui::ClipboardBuffer::kCopyPaste);
++  clipboard_writer.WriteText(formatted_output);
++}
++
 +}  // namespace
 +
 +ClashOfGptsCoordinator::ClashOfGptsCoordinator(Browser* browser)
@@ -128,28 +145,44 @@ index 0000000000000..6167eb277556d
 +  std::u16string page_title = active_contents->GetTitle();
 +  GURL page_url = active_contents->GetVisibleURL();
 +
-+  // Request accessibility tree snapshot (similar to the side panel implementation)
-+  active_contents->RequestAXTreeSnapshot(
-+      base::BindOnce([](std::u16string title, GURL url, ui::AXTreeUpdate& update) {
-+        // Extract text from accessibility tree
-+        std::u16string extracted_text;
-+        // TODO: Implement text extraction similar to third_party_llm_panel_coordinator.cc
-+        
-+        // Format the output for comparison across LLMs
-+        std::u16string formatted_output = u"----------- WEB PAGE CONTENT -----------\n\n";
-+        formatted_output += u"TITLE: " + title + u"\n\n";
-+        formatted_output += u"URL: " + base::UTF8ToUTF16(url.spec()) + u"\n\n";
-+        formatted_output += u"CONTENT:\n\n" + extracted_text;
-+        formatted_output += u"\n\n----------- USER PROMPT -----------\n\n";
-+
-+        // Copy to clipboard
-+        ui::ScopedClipboardWriter clipboard_writer(ui::ClipboardBuffer::kCopyPaste);
-+        clipboard_writer.WriteText(formatted_output);
-+      }, page_title, page_url),
-+      ui::AXMode::kWebContents,
-+      0,  // max_nodes (0 = no limit)
-+      base::Seconds(5),  // timeout
-+      content::WebContents::AXTreeSnapshotPolicy::kSameOriginDirectDescendants);
++  // Reuse the text of an unchanged page
++  using extensions::api::BrowserOSExtractionCache;
++  BrowserOSExtractionCache::CreateForWebContents(active_contents);
++  auto* cache = BrowserOSExtractionCache::FromWebContents(active_contents);
++  if (const BrowserOSExtractionCache::Entry* entry =
++          cache->Get(BrowserOSExtractionCache::kPlainTextVariant)) {
++    CopyPageText(page_title, page_url, entry->text);
++  } else {
++    // Request accessibility tree snapshot (similar to the side panel implementation)
++    active_contents->RequestAXTreeSnapshot(
++        base::BindOnce(
++            [](std::u16string title, GURL url,
++               base::WeakPtr<content::WebContents> contents,
++               BrowserOSExtractionCache::Key cache_key,
++               ui::AXTreeUpdate& update) {
++              // Extract text from accessibility tree
++              extensions::api::PlainTextSink sink;
++              extensions::api::PageExtractionSink* sinks[] = {&sink};
++              extensions::api::PageExtractor::Run(update, sinks);
++              std::u16string extracted_text = sink.TakeText();
++
++              if (contents) {
++                BrowserOSExtractionCache::Entry entry;
++                entry.text = extracted_text;
++                BrowserOSExtractionCache::FromWebContents(contents.get())
++                    ->Put(cache_key,
++                          BrowserOSExtractionCache::kPlainTextVariant,
++                          std::move(entry));
++              }
++              CopyPageText(title, url, extracted_text);
++            },
++            page_title, page_url, active_contents->GetWeakPtr(),
++            cache->BeginExtraction()),
++        ui::AXMode::kWebContents,
++        0,  // max_nodes (0 = no limit)
++        base::Seconds(5),  // timeout
++        content::WebContents::AXTreeSnapshotPolicy::kSameOriginDirectDescendants);
++  }
 +
 +  // Show feedback in the UI
 +  if (view_) {
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/ui/views/side_panel/third_party_llm/third_party_llm_panel_coordinator.cc b/chrome/browser/ui/views/side_panel/third_party_llm/third_party_llm_panel_coordinator.cc
 new file mode 100644
-index 0000000000000..9b7d7f0c48175
+index 0000000000000..8d1a0f810bce6
 --- /dev/null
 +++ b/chrome/browser/ui/views/side_panel/third_party_llm/third_party_llm_panel_coordinator.cc
-@@ -0,0 +1,1163 @@
+@@ -0,0 +1,1103 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -63,6 +63,7 @@ index 0000000000000..9b7d7f0c48175
 +#include "chrome/browser/ui/chrome_pages.h"
 +#include "chrome/app/chrome_command_ids.h"
 +#include "chrome/browser/ui/browser_tabstrip.h"
++#include "base/timer/elapsed_timer.h"
 +#include "base/timer/timer.h"
 +#include "base/task/sequenced_task_runner.h"
 +#include "components/input/native_web_keyboard_event.h"
@@ -76,6 +77,9 @@ index 0000000000000..9b7d7f0c48175
 +#include "third_party/blink/public/common/mediastream/media_stream_request.h"
 +#include "content/public/browser/render_frame_host.h"
 +#include "components/metrics/browseros_metrics/browseros_metrics.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_extraction_cache.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_page_extractor.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_perf.h"
 +#include "chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_coordinator.h"
 +
 +namespace {
@@ -592,10 +596,21 @@ index 0000000000000..9b7d7f0c48175
 +  page_title_ = active_contents->GetTitle();
 +  page_url_ = active_contents->GetVisibleURL();
 +  
++  // Reuse the text of an unchanged page
++  using extensions::api::BrowserOSExtractionCache;
++  BrowserOSExtractionCache::CreateForWebContents(active_contents);
++  auto* cache = BrowserOSExtractionCache::FromWebContents(active_contents);
++  if (const BrowserOSExtractionCache::Entry* entry =
++          cache->Get(BrowserOSExtractionCache::kPlainTextVariant)) {
++    CopyPageContent(entry->text);
++    return;
++  }
++
 +  // Request accessibility tree snapshot
 +  active_contents->RequestAXTreeSnapshot(
 +      base::BindOnce(&ThirdPartyLlmPanelCoordinator::OnAccessibilityTreeReceived,
-+                     weak_factory_.GetWeakPtr()),
++                     weak_factory_.GetWeakPtr(), active_contents->GetWeakPtr(),
++                     cache->BeginExtraction()),
 +      ui::AXMode::kWebContents,  // Request web contents mode
 +      0,  // max_nodes (0 = no limit)
 +      base::Seconds(5),  // timeout
@@ -679,24 +694,34 @@ index 0000000000000..9b7d7f0c48175
 +}
 +
 +void ThirdPartyLlmPanelCoordinator::OnAccessibilityTreeReceived(
++    base::WeakPtr<content::WebContents> contents,
++    extensions::api::BrowserOSExtractionCache::Key cache_key,
 +    ui::AXTreeUpdate& update) {
-+  // Build a map of node IDs to node data for easy lookup
-+  std::map<ui::AXNodeID, const ui::AXNodeData*> node_map;
-+  for (const auto& node_data : update.nodes) {
-+    node_map[node_data.id] = &node_data;
-+  }
-+  
-+  // Find the root node
-+  ui::AXNodeID root_id = update.root_id;
-+  if (node_map.find(root_id) == node_map.end()) {
++  // Extract text from the accessibility tree
++  base::ElapsedTimer timer;
++  extensions::api::PlainTextSink sink;
++  extensions::api::PageExtractionSink* sinks[] = {&sink};
++  if (!extensions::api::PageExtractor::Run(update, sinks)) {
 +    LOG(ERROR) << "Root node not found in tree update";
 +    return;
 +  }
-+  
-+  // Extract text from the accessibility tree recursively
-+  std::u16string extracted_text;
-+  ExtractTextFromNodeData(node_map[root_id], node_map, &extracted_text);
-+  
++  std::u16string extracted_text = sink.TakeText();
++  extensions::api::LogPerfRecord("plain_text", update.nodes.size(),
++                                 extracted_text.size(), timer.Elapsed());
++
++  if (contents) {
++    using extensions::api::BrowserOSExtractionCache;
++    BrowserOSExtractionCache::Entry entry;
++    entry.text = extracted_text;
++    BrowserOSExtractionCache::FromWebContents(contents.get())
++        ->Put(cache_key, BrowserOSExtractionCache::kPlainTextVariant,
++              std::move(entry));
++  }
++  CopyPageContent(std::move(extracted_text));
++}
++
++void ThirdPartyLlmPanelCoordinator::CopyPageContent(
++    std::u16string extracted_text) {
 +  // Clean up text - remove excessive whitespace
 +  if (!extracted_text.empty()) {
 +    // Simple cleanup of multiple spaces
@@ -776,91 +801,6 @@ index 0000000000000..9b7d7f0c48175
 +}
 +
 +
-+void ThirdPartyLlmPanelCoordinator::ExtractTextFromNodeData(
-+    const ui::AXNodeData* node,
-+    const std::map<ui::AXNodeID, const ui::AXNodeData*>& node_map,
-+    std::u16string* output) {
-+  if (!node || !output) {
-+    return;
-+  }
-+  
-+  // Skip UI elements and navigation
-+  if (node->role == ax::mojom::Role::kButton ||
-+      node->role == ax::mojom::Role::kNavigation ||
-+      node->role == ax::mojom::Role::kBanner ||
-+      node->role == ax::mojom::Role::kComplementary ||
-+      node->role == ax::mojom::Role::kContentInfo ||
-+      node->role == ax::mojom::Role::kForm ||
-+      node->role == ax::mojom::Role::kSearch ||
-+      node->role == ax::mojom::Role::kMenu ||
-+      node->role == ax::mojom::Role::kMenuBar ||
-+      node->role == ax::mojom::Role::kMenuItem ||
-+      node->role == ax::mojom::Role::kToolbar) {
-+    // For these elements, still traverse children but don't extract their text
-+    for (ui::AXNodeID child_id : node->child_ids) {
-+      auto it = node_map.find(child_id);
-+      if (it != node_map.end()) {
-+        ExtractTextFromNodeData(it->second, node_map, output);
-+      }
-+    }
-+    return;
-+  }
-+  
-+  // Check if this is a text-containing element
-+  bool is_text_element = (node->role == ax::mojom::Role::kStaticText ||
-+                         node->role == ax::mojom::Role::kInlineTextBox);
-+  
-+  // Extract text if this is a text element
-+  if (is_text_element) {
-+    std::u16string text;
-+    if (node->HasStringAttribute(ax::mojom::StringAttribute::kName)) {
-+      text = node->GetString16Attribute(ax::mojom::StringAttribute::kName);
-+    }
-+    
-+    if (text.empty() && node->HasStringAttribute(ax::mojom::StringAttribute::kValue)) {
-+      text = node->GetString16Attribute(ax::mojom::StringAttribute::kValue);
-+    }
-+    
-+    if (!text.empty()) {
-+      // Add appropriate spacing
-+      if (!output->empty() && output->back() != ' ' && output->back() != '\n') {
-+        *output += u" ";
-+      }
-+      *output += text;
-+    }
-+  }
-+  
-+  // Handle line breaks
-+  if (node->role == ax::mojom::Role::kLineBreak) {
-+    *output += u"\n";
-+  }
-+  
-+  // Add paragraph breaks for block-level elements
-+  bool needs_paragraph_break = (node->role == ax::mojom::Role::kParagraph ||
-+                               node->role == ax::mojom::Role::kHeading ||
-+                               node->role == ax::mojom::Role::kListItem ||
-+                               node->role == ax::mojom::Role::kBlockquote ||
-+                               node->role == ax::mojom::Role::kArticle ||
-+                               node->role == ax::mojom::Role::kSection);
-+  
-+  if (needs_paragraph_break && !output->empty() && output->back() != '\n') {
-+    *output += u"\n\n";
-+  }
-+  
-+  // Recursively process children for all elements
-+  for (ui::AXNodeID child_id : node->child_ids) {
-+    auto it = node_map.find(child_id);
-+    if (it != node_map.end()) {
-+      ExtractTextFromNodeData(it->second, node_map, output);
-+    }
-+  }
-+  
-+  // Add paragraph break after block-level elements if they had content
-+  if (needs_paragraph_break && !output->empty() && output->back() != '\n') {
-+    *output += u"\n\n";
-+  }
-+}
-+
 +bool ThirdPartyLlmPanelCoordinator::HandleKeyboardEvent(
 +    content::WebContents* source,
 +    const input::NativeWebKeyboardEvent& event) {
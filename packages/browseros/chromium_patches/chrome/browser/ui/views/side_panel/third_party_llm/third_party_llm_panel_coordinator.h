@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/ui/views/side_panel/third_party_llm/third_party_llm_panel_coordinator.h b/chrome/browser/ui/views/side_panel/third_party_llm/third_party_llm_panel_coordinator.h
 new file mode 100644
-index 0000000000000..ef7c13f156ea7
+index 0000000000000..cec2d3739d94a
 --- /dev/null
 +++ b/chrome/browser/ui/views/side_panel/third_party_llm/third_party_llm_panel_coordinator.h
-@@ -0,0 +1,237 @@
+@@ -0,0 +1,238 @@
 +// Copyright 2026 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -20,6 +20,7 @@ index 0000000000000..ef7c13f156ea7
 +#include "base/scoped_multi_source_observation.h"
 +#include "base/scoped_observation.h"
 +#include "base/timer/timer.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_extraction_cache.h"
 +#include "chrome/browser/ui/browser_list_observer.h"
 +#include "chrome/browser/profiles/profile_observer.h"
 +#include "components/prefs/pref_change_registrar.h"
@@ -61,7 +62,6 @@ index 0000000000000..ef7c13f156ea7
 +}  // namespace content
 +
 +namespace ui {
-+struct AXNodeData;
 +struct AXTreeUpdate;
 +}  // namespace ui
 +
@@ -164,12 +164,13 @@ index 0000000000000..ef7c13f156ea7
 +  void OnOpenInNewTab();
 +  void OnCopyContent();
 +  void OnScreenshotContent();
-+  void OnAccessibilityTreeReceived(ui::AXTreeUpdate& update);
++  void OnAccessibilityTreeReceived(
++      base::WeakPtr<content::WebContents> contents,
++      extensions::api::BrowserOSExtractionCache::Key cache_key,
++      ui::AXTreeUpdate& update);
++  // Formats |extracted_text| with the page title and URL and copies it.
++  void CopyPageContent(std::u16string extracted_text);
 +  void OnScreenshotCaptured(const gfx::Image& image);
-+  void ExtractTextFromNodeData(
-+      const ui::AXNodeData* node,
-+      const std::map<ui::AXNodeID, const ui::AXNodeData*>& node_map,
-+      std::u16string* output);
 +  void HideFeedbackLabel();
 +  void ShowOptionsMenu();
 +
@@ -11,7 +11,7 @@ index 1a4683393ff24..834756f0847ea 100644
  
  // Profile avatar and name
  inline constexpr char kProfileAvatarIndex[] = "profile.avatar_index";
-@@ -4302,6 +4304,29 @@ inline constexpr char kNonMilestoneUpdateToastVersion[] =
+@@ -4302,6 +4304,34 @@ inline constexpr char kNonMilestoneUpdateToastVersion[] =
      "toast.non_milestone_update_toast_version";
  #endif  // !BUILDFLAG(IS_ANDROID)
  
@@ -37,6 +37,11 @@ index 1a4683393ff24..834756f0847ea 100644
 +// Boolean that controls whether toolbar labels are shown for BrowserOS actions
 +inline constexpr char kBrowserOSShowToolbarLabels[] =
 +    "browseros.show_toolbar_labels";
++
++// Dictionary of per-origin latency histograms from which interaction
++// change-detection timeouts are derived
++inline constexpr char kBrowserOSInteractionTimeouts[] =
++    "browseros.interaction_timeouts";
 +
  }  // namespace prefs
  
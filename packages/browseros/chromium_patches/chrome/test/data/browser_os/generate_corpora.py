@@ -0,0 +1,234 @@
+diff --git a/chrome/test/data/browser_os/generate_corpora.py b/chrome/test/data/browser_os/generate_corpora.py
+new file mode 100644
+index 0000000000000..a6b26657cd33e
+--- /dev/null
++++ b/chrome/test/data/browser_os/generate_corpora.py
+@@ -0,0 +1,228 @@
++#!/usr/bin/env python3
++# Copyright 2025 The Chromium Authors
++# Use of this source code is governed by a BSD-style license that can be
++# found in the LICENSE file.
++"""Writes the synthetic accessibility tree corpora used by browser_os tests.
++
++Each corpus is one flattened AXTreeUpdate in the text format read by
++chrome/browser/extensions/api/browser_os/browser_os_ax_corpus.h: one node per
++line in preorder, as
++
++  <id> TAB <parent id or -> TAB <role> TAB <attributes or -> TAB <name>
++
++A node without a c= attribute has its parent's offset container, so the
++container is only written where it changes. The output is deterministic, so regenerating only changes the files when
++this script changes.
++
++  python3 generate_corpora.py
++"""
++
++import os
++import random
++
++HERE = os.path.dirname(os.path.abspath(__file__))
++
++WORDS = ('the city council said on tuesday that a new plan for housing and '
++         'transport would be put to a vote next month after years of debate '
++         'over costs schools parks water energy markets rates growth jobs '
++         'report study data team season match final league weather storm '
++         'coast river bridge station museum festival film music book').split()
++
++
++class Corpus:
++
++  def __init__(self, title):
++    self.title = title
++    self.lines = []
++    self.next_id = 1
++    self.container_of = {None: None}
++
++  def add(self, parent, role, name='', **attrs):
++    node_id = self.next_id
++    self.next_id += 1
++    container = attrs.get('c', self.container_of[parent])
++    self.container_of[node_id] = container
++    if container == self.container_of[parent]:
++      attrs.pop('c', None)
++    fields = []
++    for key, value in attrs.items():
++      if value is True:
++        fields.append(key)
++      elif value is not None:
++        fields.append('%s=%s' % (key, value))
++    self.lines.append('%d\t%s\t%s\t%s\t%s' %
++                      (node_id, '-' if parent is None else parent, role,
++                       ' '.join(fields) or '-', name))
++    return node_id
++
++  def write(self, filename):
++    with open(os.path.join(HERE, filename), 'w') as f:
++      f.write('# %s, %d nodes. Generated by generate_corpora.py.\n' %
++              (self.title, len(self.lines)))
++      f.write('\n'.join(self.lines))
++      f.write('\n')
++
++
++def bounds(x, y, w, h):
++  return '%d,%d,%d,%d' % (x, y, w, h)
++
++
++def sentence(rng, words):
++  return ' '.join(rng.choice(WORDS) for _ in range(words)).capitalize() + '.'
++
++
++def small_form():
++  c = Corpus('Sign-in form')
++  root = c.add(None, 'rootWebArea', 'Sign in', b=bounds(0, 0, 1280, 800))
++  banner = c.add(root, 'banner', b=bounds(0, 0, 1280, 60), c=root)
++  c.add(banner, 'link', 'Home', tag='a', url='https://example.com/',
++        b=bounds(16, 16, 60, 24), c=root, focusable=True)
++  c.add(banner, 'link', 'Help', tag='a', url='https://example.com/help',
++        b=bounds(1180, 16, 60, 24), c=root, focusable=True)
++  main = c.add(root, 'main', b=bounds(0, 60, 1280, 700), c=root)
++  c.add(main, 'heading', 'Sign in to your account', tag='h1', level=1,
++        b=bounds(440, 100, 400, 40), c=root)
++  form = c.add(main, 'form', tag='form', b=bounds(440, 160, 400, 360), c=root)
++  for label, kind in (('Email', 'email'), ('Password', 'password')):
++    y = 180 if kind == 'email' else 260
++    c.add(form, 'labelText', label, tag='label', b=bounds(440, y, 400, 20),
++          c=form)
++    c.add(form, 'textField', label, tag='input', type=kind,
++          b=bounds(0, y - 140, 400, 32), c=form, focusable=True,
++          editable=True)
++  c.add(form, 'checkBox', 'Keep me signed in', tag='input', type='checkbox',
++        b=bounds(0, 200, 20, 20), c=form, focusable=True)
++  c.add(form, 'button', 'Sign in', tag='button', b=bounds(0, 250, 400, 40),
++        c=form, focusable=True)
++  c.add(form, 'link', 'Forgot password?', tag='a',
++        url='https://example.com/reset', b=bounds(0, 310, 160, 20), c=form,
++        focusable=True)
++  footer = c.add(root, 'contentInfo', tag='footer',
++                 b=bounds(0, 760, 1280, 40), c=root)
++  c.add(footer, 'staticText', '(c) Example Inc.', b=bounds(16, 770, 200, 20),
++        c=root)
++  c.add(root, 'genericContainer', 'Hidden tooltip', invisible=True)
++  c.write('small_form.axtree')
++
++
++def news_page(target_nodes=5000):
++  rng = random.Random(5000)
++  c = Corpus('News front page')
++  root = c.add(None, 'rootWebArea', 'Daily News', b=bounds(0, 0, 1280, 720))
++  banner = c.add(root, 'banner', tag='header', b=bounds(0, 0, 1280, 120),
++                 c=root)
++  nav = c.add(banner, 'navigation', 'Sections', tag='nav',
++              b=bounds(0, 80, 1280, 40), c=root)
++  nav_list = c.add(nav, 'list', tag='ul', b=bounds(0, 80, 1280, 40), c=root)
++  for i in range(40):
++    item = c.add(nav_list, 'listItem', tag='li',
++                 b=bounds(i * 32, 80, 32, 40), c=root)
++    c.add(item, 'link', rng.choice(WORDS).capitalize(), tag='a',
++          url='https://news.example/section/%d' % i,
++          b=bounds(i * 32, 80, 32, 40), c=root, focusable=True)
++  main = c.add(root, 'main', tag='main', b=bounds(0, 120, 960, 20000),
++               c=root)
++  y = 0
++  story = 0
++  while c.next_id < target_nodes - 200:
++    article = c.add(main, 'article', tag='article',
++                    b=bounds(0, 120 + y, 960, 600), c=root)
++    c.add(article, 'heading', sentence(rng, 8), tag='h2', level=2,
++          b=bounds(16, 16, 928, 32), c=article)
++    c.add(article, 'image', 'Photo: ' + sentence(rng, 5), tag='img',
++          b=bounds(16, 56, 320, 180), c=article)
++    for p in range(rng.randint(3, 6)):
++      para = c.add(article, 'paragraph', tag='p',
++                   b=bounds(16, 250 + p * 60, 928, 56), c=article)
++      c.add(para, 'staticText', sentence(rng, rng.randint(12, 30)),
++            b=bounds(16, 250 + p * 60, 928, 56), c=article)
++      if rng.random() < 0.3:
++        c.add(para, 'link', sentence(rng, 3), tag='a',
++              url='https://news.example/story/%d/%d' % (story, p),
++              b=bounds(16, 290 + p * 60, 200, 16), c=article,
++              focusable=True)
++    c.add(article, 'button', 'Share', tag='button',
++          b=bounds(16, 560, 80, 24), c=article, focusable=True)
++    c.add(article, 'button', 'Save', tag='button',
++          b=bounds(104, 560, 80, 24), c=article, focusable=True)
++    y += 620
++    story += 1
++  aside = c.add(root, 'complementary', 'Most read', tag='aside',
++                b=bounds(960, 120, 320, 2000), c=root)
++  for i in range(20):
++    c.add(aside, 'link', sentence(rng, 6), tag='a',
++          url='https://news.example/top/%d' % i,
++          b=bounds(976, 140 + i * 40, 288, 32), c=root, focusable=True)
++  footer = c.add(root, 'contentInfo', tag='footer',
++                 b=bounds(0, 120 + y, 1280, 200), c=root)
++  while c.next_id <= target_nodes:
++    i = c.next_id
++    c.add(footer, 'link', 'Footer link %d' % i, tag='a',
++          url='https://news.example/about/%d' % i,
++          b=bounds((i % 8) * 160, 140 + y + (i // 8 % 8) * 20, 150, 18),
++          c=root, focusable=True)
++  c.write('news_5k.axtree')
++
++
++def grid(target_nodes=50000):
++  c = Corpus('Spreadsheet grid')
++  root = c.add(None, 'rootWebArea', 'Inventory', b=bounds(0, 0, 1280, 720))
++  main = c.add(root, 'main', tag='main', b=bounds(0, 0, 1280, 720), c=root)
++  table = c.add(main, 'grid', 'Inventory', tag='table',
++                b=bounds(0, 40, 1280, 680), c=root, scrollable=True)
++  header = c.add(table, 'row', tag='tr', b=bounds(0, 0, 1280, 24), c=table)
++  columns = ('Select', 'SKU', 'Item', 'Stock', 'Price', 'Updated')
++  for i, column in enumerate(columns):
++    c.add(header, 'columnHeader', column, tag='th',
++          b=bounds(i * 200, 0, 200, 24), c=table)
++  row = 0
++  # Each row adds 1 + 1 + 1 + 5 * 2 nodes
++  while c.next_id + 13 <= target_nodes:
++    y = 24 + row * 24
++    tr = c.add(table, 'row', b=bounds(0, y, 1280, 24), c=table)
++    select = c.add(tr, 'gridCell', b=bounds(0, y, 200, 24))
++    c.add(select, 'checkBox', 'Select row %d' % (row + 1),
++          b=bounds(4, y + 4, 16, 16), focusable=True)
++    for i, value in enumerate(('SKU-%05d' % row, 'Item %d' % row,
++                               str(row * 7 % 500),
++                               '%d.%02d' % (row % 90 + 1, row % 100),
++                               '2025-%02d-%02d' % (row % 12 + 1,
++                                                   row % 28 + 1))):
++      cell = c.add(tr, 'gridCell', b=bounds((i + 1) * 200, y, 200, 24))
++      c.add(cell, 'staticText', value)
++    row += 1
++  while c.next_id <= target_nodes:
++    c.add(main, 'staticText', 'Total %d' % c.next_id,
++          b=bounds(0, 0, 200, 20), c=root)
++  c.write('grid_50k.axtree')
++
++
++def iframe_nest(depth=32):
++  c = Corpus('Nested iframes, %d levels' % depth)
++  parent = c.add(None, 'rootWebArea', 'Embed level 0',
++                 b=bounds(0, 0, 1280, 720))
++  for level in range(1, depth + 1):
++    container = parent
++    c.add(parent, 'heading', 'Level %d' % level, tag='h2', level=2,
++          b=bounds(8, 8, 400, 24), c=container)
++    para = c.add(parent, 'paragraph', tag='p', b=bounds(8, 40, 400, 40),
++                 c=container)
++    c.add(para, 'staticText', 'Content embedded at depth %d.' % level,
++          b=bounds(8, 40, 400, 40), c=container)
++    c.add(parent, 'link', 'Open level %d' % level, tag='a',
++          url='https://frame%d.example/' % level, b=bounds(8, 88, 120, 20),
++          c=container, focusable=True)
++    c.add(parent, 'button', 'Close level %d' % level, tag='button',
++          b=bounds(136, 88, 80, 20), c=container, focusable=True)
++    frame = c.add(parent, 'iframe', tag='iframe', b=bounds(8, 120, 600, 400),
++                  c=container)
++    parent = c.add(frame, 'webArea', 'Embed level %d' % level,
++                   b=bounds(0, 0, 600, 400), c=frame)
++  c.write('iframe_nest.axtree')
++
++
++if __name__ == '__main__':
++  small_form()
++  news_page()
++  grid()
++  iframe_nest()
@@ -2,7 +2,7 @@ diff --git a/extensions/browser/extension_function_histogram_value.h b/extension
 index 6d9bd29ae220f..b0f0045a26410 100644
 --- a/extensions/browser/extension_function_histogram_value.h
 +++ b/extensions/browser/extension_function_histogram_value.h
-@@ -2011,6 +2011,29 @@ enum HistogramValue {
+@@ -2011,6 +2011,31 @@ enum HistogramValue {
    DEVELOPERPRIVATE_SHOWSITESETTINGS = 1948,
    ACCESSIBILITY_PRIVATE_PROCESSPENDINGSPOKENFEEDBACKEVENT = 1949,
    ACCESSIBILITY_PRIVATE_ENABLESPOKENFEEDBACKMV3KEYHANDLING = 1950,
@@ -29,6 +29,8 @@ index 6d9bd29ae220f..b0f0045a26410 100644
 +  BROWSER_OS_TYPEATCOORDINATES = 1971,
 +  SIDEPANEL_BROWSEROSTOGGLE = 1972,
 +  SIDEPANEL_BROWSEROSISOPEN = 1973,
++  BROWSER_OS_GETINTERACTIONTIMEOUTS = 1974,
++  BROWSER_OS_EXECUTEACTIONS = 1975,
    // Last entry: Add new entries above, then run:
    // tools/metrics/histograms/update_extension_histograms.py
    ENUM_BOUNDARY